@@ -27,6 +27,11 @@ void FGASCourseCardAbilitySet_GrantedHandles::AddAttributeSet(UGASCourseAttribut
 	}
 }
 
+bool FGASCourseCardAbilitySet_GrantedHandles::RemoveAbilitySpecHandle(const FGameplayAbilitySpecHandle& Handle)
+{
+	return AbilitySpecHandles.RemoveSingleSwap(Handle, EAllowShrinking::No) > 0;
+}
+
 void FGASCourseCardAbilitySet_GrantedHandles::TakeFromAbilitySystem(UAbilitySystemComponent* ASC)
 {
 	check(ASC);
@@ -36,12 +41,30 @@ void FGASCourseCardAbilitySet_GrantedHandles::TakeFromAbilitySystem(UAbilitySyst
 		return;
 	}
 
+	UGASCourseAbilitySystemComponent* OwningASC = Cast<UGASCourseAbilitySystemComponent>(ASC);
+
 	for (const FGameplayAbilitySpecHandle& Handle : AbilitySpecHandles)
 	{
-		if (Handle.IsValid())
+		if (!Handle.IsValid())
+		{
+			continue;
+		}
+
+		// Activations of an already granted card ability share its spec; only the last stack clears it
+		if (FGrantedCardAbilityConfig* Config = OwningASC ? OwningASC->CardAbilityConfigHandles.Find(Handle) : nullptr)
 		{
-			ASC->ClearAbility(Handle);
+			if (Config->AbilityStackCount > 1)
+			{
+				--Config->AbilityStackCount;
+				if (const FGameplayAbilitySpec* Spec = OwningASC->FindAbilitySpecFromHandle(Handle); Spec && Spec->Ability)
+				{
+					OwningASC->OnActiveCardAbilityStackCountChanged.Broadcast(Config->AbilityStackCount, Spec->Ability->GetClass());
+				}
+				continue;
+			}
+			OwningASC->CardAbilityConfigHandles.Remove(Handle);
 		}
+		ASC->ClearAbility(Handle);
 	}
 
 	for (const FActiveGameplayEffectHandle& Handle : GameplayEffectHandles)
@@ -70,41 +93,47 @@ UBaseCardGameplayAbilitySet::UBaseCardGameplayAbilitySet(const FObjectInitialize
 {
 }
 
-bool UBaseCardGameplayAbilitySet::ActivateCard(UAbilitySystemComponent* ASC, int32 CardLevel, bool bAutoLoadThenActivate )
+bool UBaseCardGameplayAbilitySet::ActivateCard(UAbilitySystemComponent* ASC, FGASC_CardGrantHandle& OutGrantHandle, int32 CardLevel, bool bAutoLoadThenActivate)
 {
-	if (!ASC)
+	return ActivateCardInstance(ASC, CardLevel, FGuid(), OutGrantHandle, bAutoLoadThenActivate);
+}
+
+bool UBaseCardGameplayAbilitySet::ActivateCardInstance(UAbilitySystemComponent* ASC, int32 CardLevel,
+	const FGuid& CardInstanceId, FGASC_CardGrantHandle& OutGrantHandle, bool bAutoLoadThenActivate)
+{
+	OutGrantHandle.Invalidate();
+
+	UGASCourseAbilitySystemComponent* OwningASC = Cast<UGASCourseAbilitySystemComponent>(ASC);
+	if (!OwningASC)
 	{
 		return false;
 	}
 
 	// Authority rule (match your TakeFromAbilitySystem)
-	if (!ASC->IsOwnerActorAuthoritative())
+	if (!OwningASC->IsOwnerActorAuthoritative())
 	{
 		return false;
 	}
-	
-	//Store reference to passed in card level for use throughout class.
-	CardLevel_Internal = CardLevel;
-	
-	FGASCourseAbilitySet_GrantedHandles* OutGrantedHandles = new FGASCourseAbilitySet_GrantedHandles();
 
-	if (bCardDataLoaded)
+	if (!bCardDataLoaded && !bAutoLoadThenActivate)
 	{
-		GiveToAbilitySystem(ASC, CardLevel_Internal, OutGrantedHandles, nullptr);
-		return true;
+		// Caller chose to not auto-load; safe no-op
+		return false;
 	}
 
-	if (!bAutoLoadThenActivate)
+	// The ASC owns the record, so the level and grants of this activation never leak into other activations of the set
+	OutGrantHandle = OwningASC->AllocateCardGrant(this, CardLevel, CardInstanceId);
+
+	if (bCardDataLoaded)
 	{
-		// Caller chose to not auto-load; safe no-op
-		return false;
+		GiveToAbilitySystem(OwningASC, OutGrantHandle);
+		return true;
 	}
 
 	// Queue activation, then start load
 	FPendingActivation Pending;
-	Pending.ASC = ASC;
-	Pending.Handles = OutGrantedHandles;
-	Pending.SourceObject = nullptr;
+	Pending.ASC = OwningASC;
+	Pending.GrantHandle = OutGrantHandle;
 	PendingActivations.Add(Pending);
 
 	LoadCardDataAsync();
@@ -127,11 +156,6 @@ void UBaseCardGameplayAbilitySet::LoadCardDataAsync()
 	StartAsyncLoad_Internal();
 }
 
-void UBaseCardGameplayAbilitySet::OverrideCardLevel(float InCardLevelOverride)
-{
-	CardLevel_Internal = FMath::Clamp(InCardLevelOverride, 0.0f, 5.0f);
-}
-
 void UBaseCardGameplayAbilitySet::StartAsyncLoad_Internal()
 {
 	bCardDataLoading = true;
@@ -252,7 +276,14 @@ void UBaseCardGameplayAbilitySet::OnAsyncLoadComplete_Internal(bool bSuccess)
 	}
 	else
 	{
-		// Clear pending activations on failure to avoid stale pointers
+		// Nothing was granted; hand the reserved records back
+		for (const FPendingActivation& Pending : PendingActivations)
+		{
+			if (UGASCourseAbilitySystemComponent* ASC = Pending.ASC.Get())
+			{
+				ASC->RevokeCardGrant(Pending.GrantHandle);
+			}
+		}
 		PendingActivations.Reset();
 	}
 }
@@ -264,8 +295,7 @@ void UBaseCardGameplayAbilitySet::FlushPendingActivations()
 	{
 		FPendingActivation& P = PendingActivations[i];
 
-		UAbilitySystemComponent* ASC = P.ASC.Get();
-		UObject* SourceObj = P.SourceObject.Get();
+		UGASCourseAbilitySystemComponent* ASC = P.ASC.Get();
 
 		if (!ASC || !ASC->IsOwnerActorAuthoritative())
 		{
@@ -273,13 +303,24 @@ void UBaseCardGameplayAbilitySet::FlushPendingActivations()
 			continue;
 		}
 
-		GiveToAbilitySystem(ASC, CardLevel_Internal, P.Handles, SourceObj);
+		GiveToAbilitySystem(ASC, P.GrantHandle);
 		PendingActivations.RemoveAtSwap(i);
 	}
 }
 
+void UBaseCardGameplayAbilitySet::GiveToAbilitySystem(UGASCourseAbilitySystemComponent* ASC, const FGASC_CardGrantHandle& GrantHandle) const
+{
+	check(ASC);
+
+	// The activation may have been revoked while the card data was loading
+	if (FGASC_CardGrantRecord* Record = ASC->FindCardGrant(GrantHandle))
+	{
+		GiveToAbilitySystem(ASC, Record->CardLevel, &Record->GrantedHandles);
+	}
+}
+
 void UBaseCardGameplayAbilitySet::GiveToAbilitySystem(UAbilitySystemComponent* ASC, int32 CardLevel,
-                                                     FGASCourseAbilitySet_GrantedHandles* OutGrantedHandles,
+                                                     FGASCourseCardAbilitySet_GrantedHandles* OutGrantedHandles,
                                                      UObject* SourceObject) const
 {
 	check(ASC);
@@ -346,6 +387,12 @@ void UBaseCardGameplayAbilitySet::GiveToAbilitySystem(UAbilitySystemComponent* A
 			FGameplayAbilitySpec* FoundCardAbilitySpec = OwningASC->FindAbilitySpecFromClass(AbilityClass);
 			OwningASC->CardAbilityConfigHandles.FindChecked(FoundCardAbilitySpec->Handle).AbilityStackCount++;
 			OwningASC->OnActiveCardAbilityStackCountChanged.Broadcast(OwningASC->CardAbilityConfigHandles.FindChecked(FoundCardAbilitySpec->Handle).AbilityStackCount, AbilityClass);
+
+			// Record the shared spec too, so revoking this activation takes back its stack
+			if (OutGrantedHandles)
+			{
+				OutGrantedHandles->AddAbilitySpecHandle(FoundCardAbilitySpec->Handle);
+			}
 			continue;
 		}
 		
@@ -3,6 +3,8 @@
 
 #include "Game/Character/Components/DeckManagerComponent/DeckManagerComponent.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "GameFramework/PlayerState.h"
+#include "Game/Systems/Subsystems/DeckManager/DeckManagerGameInstanceSubsystem.h"
 
 namespace GASCourse_DeckManagerComponentCVars
 {
@@ -39,24 +41,43 @@ void UDeckManagerComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	AbilitySystemComponent = GetOwner()->FindComponentByClass<UAbilitySystemComponent>();
-	
-	// ...
-	
+
+	bool bDeckCreated = true;
+	if (UGameInstance* GameInstance = GetWorld()->GetGameInstance())
+	{
+		if (UDeckManagerGameInstanceSubsystem* DeckSubsystem = GameInstance->GetSubsystem<UDeckManagerGameInstanceSubsystem>())
+		{
+			DeckSubsystem->FindOrAddDeck(GetDeckId(), bDeckCreated);
+		}
+	}
+
+	// A deck carried over from a previous level keeps its state; only a new one starts from the authored piles
+	if (bDeckCreated)
+	{
+		GetDeck().Initialize(ActiveDeckInstance, CardBinderInstance, CurrentHandInstance, DeckGraveyardInstance);
+	}
+	PreloadCardData();
 }
 
 bool UDeckManagerComponent::ActivateCardByInstanceID(const FGuid& CardInstanceID)
 {
 	
-	FCardInstance* Card = CurrentHandInstance.FindByPredicate(
-		[&](const FCardInstance& C){ return C.CardInstanceId == CardInstanceID; });
+	EGASC_DeckPile CardPile = EGASC_DeckPile::ActiveDeck;
+	const FCardInstance* Card = GetDeck().FindCard(CardInstanceID, &CardPile);
 	
-	if (!Card)
+	if (!Card || CardPile != EGASC_DeckPile::Hand)
 	{
 		UE_LOGFMT(LogTemp, Warning, "Attempted to activate card with instance ID {0}}, but it was not found in the current hand.", *CardInstanceID.ToString());
 		return false;
 	}
 	
-	UCardDataAsset* CardAsset = Card->CardDataAsset.LoadSynchronous();
+	UCardDataAsset* CardAsset = Card->CardDataAsset.Get();
+	if (!CardAsset)
+	{
+		// Card data is pre-streamed with the deck; reaching this means the preload hasn't finished
+		UE_LOGFMT(LogTemp, Warning, "Card data for instance ID {0} was not resident yet, loading synchronously.", CardInstanceID.ToString());
+		CardAsset = Card->CardDataAsset.LoadSynchronous();
+	}
 	if (!CardAsset)
 	{
 		UE_LOG(LogTemp, Error, TEXT("Card asset was not found for instance ID %s"), *CardInstanceID.ToString());
@@ -69,23 +90,24 @@ bool UDeckManagerComponent::ActivateCardByInstanceID(const FGuid& CardInstanceID
 		return false;
 	}
 	
-	OnCardActivated.Broadcast(*Card);
-	UE_LOG(LogTemp, Warning, TEXT("Card level activated: %i"), Card->CardLevel);
-	CardAsset->CardData.CardAbilitySet->ActivateCard(AbilitySystemComponent, Card->CardLevel);
+	// Listeners may move or discard cards, which can reallocate the pile Card points into
+	const FCardInstance ActivatedCard = *Card;
+	OnCardActivated.Broadcast(ActivatedCard);
+	UE_LOG(LogTemp, Warning, TEXT("Card level activated: %i"), ActivatedCard.CardLevel);
+	FGASC_CardGrantHandle GrantHandle;
+	CardAsset->CardData.CardAbilitySet->ActivateCardInstance(AbilitySystemComponent, ActivatedCard.CardLevel, CardInstanceID, GrantHandle);
 	return true;
 }
 
 FCardInstance UDeckManagerComponent::DrawCardInstance()
 {
 	FCardInstance CardInstanceToDraw;
-	if (ActiveDeckInstance.IsEmpty())
+	if (!GetDeck().DrawCard(CardInstanceToDraw))
 	{
 		UE_LOGFMT(LogTemp, Warning, "Attempted to draw card from an empty active deck, early exit.");
 		return CardInstanceToDraw;
 	}
-	CardInstanceToDraw = ActiveDeckInstance.Pop();
-	CurrentHandInstance.Add(CardInstanceToDraw);
-	CardInstanceToDraw.CardDataAsset = CardInstanceToDraw.CardDataAsset.LoadSynchronous();
+	// No load here: the card data was streamed in with the deck
 	OnCardAddedToHand.Broadcast(CardInstanceToDraw);
 	
 	return CardInstanceToDraw;
@@ -98,7 +120,8 @@ void UDeckManagerComponent::ForceCardInstanceInHand(FCardInstance CardInstanceTo
 		UE_LOG(LogTemp, Error, TEXT("Card to add to hand is NULL"));
 		return;
 	}
-	CurrentHandInstance.Add(CardInstanceToAdd);
+	GetDeck().AddCard(CardInstanceToAdd, EGASC_DeckPile::Hand);
+	PreloadCardData();
 	OnCardAddedToHand.Broadcast(CardInstanceToAdd);
 }
 
@@ -116,3 +139,88 @@ void UDeckManagerComponent::FindAllCards(TArray<FAssetData>& OutAllCards)
 	AssetRegistry.GetAssets(Filter, OutAllCards);
 }
 
+bool UDeckManagerComponent::MoveCardToPile(const FGuid& CardInstanceID, EGASC_DeckPile ToPile)
+{
+	return GetDeck().MoveCard(CardInstanceID, ToPile);
+}
+
+bool UDeckManagerComponent::ShuffleCardIntoActiveDeck(const FGuid& CardInstanceID)
+{
+	return GetDeck().ShuffleCardIntoActiveDeck(CardInstanceID);
+}
+
+int32 UDeckManagerComponent::RevokeCardActivations(const FGuid& CardInstanceID)
+{
+	UGASCourseAbilitySystemComponent* ASC = Cast<UGASCourseAbilitySystemComponent>(AbilitySystemComponent);
+	return ASC ? ASC->RevokeCardGrantsForCardInstance(CardInstanceID) : 0;
+}
+
+void UDeckManagerComponent::ShuffleActiveDeck()
+{
+	GetDeck().ShuffleActiveDeck();
+}
+
+void UDeckManagerComponent::SetShuffleSeed(int32 Seed)
+{
+	GetDeck().SetShuffleSeed(Seed);
+}
+
+int32 UDeckManagerComponent::GetNumCardsInPile(EGASC_DeckPile Pile) const
+{
+	return GetDeck().GetNumCards(Pile);
+}
+
+int32 UDeckManagerComponent::GetNumCardsOfTypeInPile(TSoftObjectPtr<UCardDataAsset> CardDataAsset, EGASC_DeckPile Pile) const
+{
+	return GetDeck().CountCardsOfType(CardDataAsset, Pile);
+}
+
+TArray<FCardInstance> UDeckManagerComponent::GetCardsInPile(EGASC_DeckPile Pile) const
+{
+	return GetDeck().GetPile(Pile);
+}
+
+FName UDeckManagerComponent::GetDeckId() const
+{
+	// Unique net IDs persist across travel; offline there is a single local deck
+	if (const APlayerState* PlayerState = Cast<APlayerState>(GetOwner()))
+	{
+		if (PlayerState->GetUniqueId().IsValid())
+		{
+			return FName(*PlayerState->GetUniqueId().ToString());
+		}
+	}
+	return FName(TEXT("LocalDeck"));
+}
+
+FGASC_DeckEngine& UDeckManagerComponent::GetDeck() const
+{
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UGameInstance* GameInstance = World->GetGameInstance())
+		{
+			if (UDeckManagerGameInstanceSubsystem* DeckSubsystem = GameInstance->GetSubsystem<UDeckManagerGameInstanceSubsystem>())
+			{
+				if (FGASC_DeckEngine* Deck = DeckSubsystem->FindDeck(GetDeckId()))
+				{
+					return *Deck;
+				}
+			}
+		}
+	}
+	return FallbackDeck;
+}
+
+void UDeckManagerComponent::PreloadCardData() const
+{
+	if (const UWorld* World = GetWorld())
+	{
+		if (const UGameInstance* GameInstance = World->GetGameInstance())
+		{
+			if (UDeckManagerGameInstanceSubsystem* DeckSubsystem = GameInstance->GetSubsystem<UDeckManagerGameInstanceSubsystem>())
+			{
+				DeckSubsystem->PreloadCardData(GetDeckId());
+			}
+		}
+	}
+}
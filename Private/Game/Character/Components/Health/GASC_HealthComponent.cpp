@@ -4,19 +4,16 @@
 #include "Game/Character/Components/Health/GASC_HealthComponent.h"
 #include "MVVMGameSubsystem.h"
 #include "MVVMSubsystem.h"
-#include "Abilities/Tasks/AbilityTask_WaitAttributeChange.h"
+#include "AbilitySystemGlobals.h"
+#include "AbilitySystemComponent.h"
 #include "Game/GameplayAbilitySystem/AttributeSets/GASCourseHealthAttributeSet.h"
+#include "Game/HUD/ViewModels/Health/GASC_HealthViewModelSubsystem.h"
 #include "Game/HUD/ViewModels/Health/GASC_UVM_Health.h"
-#include "GASCourse/GASCourseCharacter.h"
-#include "Net/UnrealNetwork.h"
 
 // Sets default values for this component's properties
 UGASC_HealthComponent::UGASC_HealthComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = false;
-	SetIsReplicatedByDefault(true);
 	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
 }
 
@@ -24,77 +21,87 @@ void UGASC_HealthComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	InitializeViewModel();
-
-	Server_InitializeHealthAttributes();
-	Client_InitializeHealthAttributes();
+	OnOwnerAbilitySystemInitialized();
 }
 
-void UGASC_HealthComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void UGASC_HealthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(UGASC_HealthComponent, CurrentHealth);
-	DOREPLIFETIME(UGASC_HealthComponent, MaxHealth);
-}
+	if (bRegisteredInGlobalCollection)
+	{
+		if (UMVVMGameSubsystem* ViewModelGameSubsystem = UGameInstance::GetSubsystem<UMVVMGameSubsystem>(GetOwner()->GetGameInstance()))
+		{
+			FMVVMViewModelContext CharacterHealthViewModelContext;
+			CharacterHealthViewModelContext.ContextClass = CharacterHealthViewModelContextClass;
+			CharacterHealthViewModelContext.ContextName = CharacterHealthContextName;
 
-void UGASC_HealthComponent::OnRep_CurrentHealth()
-{
-	if(HealthViewModel)
+			UMVVMViewModelCollectionObject* GlobalViewModelCollection = ViewModelGameSubsystem->GetViewModelCollection();
+			if (GlobalViewModelCollection && GlobalViewModelCollection->FindViewModelInstance(CharacterHealthViewModelContext) == HealthViewModel)
+			{
+				GlobalViewModelCollection->RemoveViewModel(CharacterHealthViewModelContext);
+			}
+		}
+		bRegisteredInGlobalCollection = false;
+	}
+
+	if (UGASC_HealthViewModelSubsystem* HealthViewModelSubsystem = GetWorld()->GetSubsystem<UGASC_HealthViewModelSubsystem>())
 	{
-		HealthViewModel->SetCurrentHealth(CurrentHealth);
+		HealthViewModelSubsystem->ReleaseHealthViewModel(GetOwner());
 	}
+	HealthViewModel = nullptr;
+
+	Super::EndPlay(EndPlayReason);
 }
 
-void UGASC_HealthComponent::OnRep_MaxHealth()
+void UGASC_HealthComponent::OnOwnerAbilitySystemInitialized()
 {
-	if(HealthViewModel)
+	if (!HealthViewModel)
 	{
-		HealthViewModel->SetMaxHealth(MaxHealth);
+		return;
 	}
-}
 
-void UGASC_HealthComponent::Server_InitializeHealthAttributes_Implementation()
-{
-	if(AGASCourseCharacter* OwningCharacter = Cast<AGASCourseCharacter>(GetOwner()))
+	const TSubclassOf<UAttributeSet> RequiredAttributeSet = HealthAttributeSet ? TSubclassOf<UAttributeSet>(HealthAttributeSet) : UGASCourseHealthAttributeSet::StaticClass();
+	UAbilitySystemComponent* OwningASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner());
+	if (!OwningASC || !OwningASC->GetAttributeSet(RequiredAttributeSet))
 	{
-		if(UAbilitySystemComponent* OwningASC = Cast<UAbilitySystemComponent>(OwningCharacter->GetAbilitySystemComponent()))
-		{
-			if(const UGASCourseHealthAttributeSet* HealthAttributes = Cast<UGASCourseHealthAttributeSet>(OwningASC->GetAttributeSet(HealthAttributeSet)))
-			{
-				CurrentHealth = HealthAttributes->GetCurrentHealth();
-				MaxHealth = HealthAttributes->GetMaxHealth();
-				OnRep_CurrentHealth();
-				OnRep_MaxHealth();
-			}
-		}
+		// The ability system is not set up yet; the owner calls back in once it is
+		return;
+	}
+
+	if (UGASC_HealthViewModelSubsystem* HealthViewModelSubsystem = GetWorld()->GetSubsystem<UGASC_HealthViewModelSubsystem>())
+	{
+		HealthViewModelSubsystem->BindAbilitySystem(GetOwner(), OwningASC);
 	}
+
+	UpdateGlobalViewModelRegistration();
 }
 
-void UGASC_HealthComponent::Client_InitializeHealthAttributes_Implementation()
+void UGASC_HealthComponent::InitializeViewModel()
 {
-	if(AGASCourseCharacter* OwningCharacter = Cast<AGASCourseCharacter>(GetOwner()))
+	UGASC_HealthViewModelSubsystem* HealthViewModelSubsystem = GetWorld()->GetSubsystem<UGASC_HealthViewModelSubsystem>();
+	check(HealthViewModelSubsystem);
+
+	HealthViewModel = HealthViewModelSubsystem->AcquireHealthViewModel(GetOwner());
+	if (HealthViewModel)
 	{
-		if(UAbilitySystemComponent* OwningASC = Cast<UAbilitySystemComponent>(OwningCharacter->GetAbilitySystemComponent()))
-		{
-			if(const UGASCourseHealthAttributeSet* HealthAttributes = Cast<UGASCourseHealthAttributeSet>(OwningASC->GetAttributeSet(HealthAttributeSet)))
-			{
-				CurrentHealth = HealthAttributes->GetCurrentHealth();
-				MaxHealth = HealthAttributes->GetMaxHealth();
-				OnRep_CurrentHealth();
-				OnRep_MaxHealth();
-			}
-		}
+		OnHealthViewModelInstantiated.Broadcast(HealthViewModel);
+		HealthViewModelInstantiated(HealthViewModel);
 	}
 }
 
-void UGASC_HealthComponent::InitializeViewModel()
+void UGASC_HealthComponent::UpdateGlobalViewModelRegistration()
 {
+	const APawn* OwningPawn = Cast<APawn>(GetOwner());
+	if (bRegisteredInGlobalCollection || !HealthViewModel || !OwningPawn || !OwningPawn->IsPlayerControlled() || !OwningPawn->IsLocallyControlled())
+	{
+		return;
+	}
+
 	UMVVMGameSubsystem* ViewModelGameSubsystem = GetOwner()->GetGameInstance()->GetSubsystem<UMVVMGameSubsystem>();
 	check(ViewModelGameSubsystem);
 
 	UMVVMViewModelCollectionObject* GlobalViewModelCollection = ViewModelGameSubsystem->GetViewModelCollection();
 	check(GlobalViewModelCollection);
 
-	UGASC_UVM_Health* CharacterHealthViewModel = NewObject<UGASC_UVM_Health>();
 	FMVVMViewModelContext CharacterHealthViewModelContext;
 	CharacterHealthViewModelContext.ContextClass = CharacterHealthViewModelContextClass;
 	CharacterHealthViewModelContext.ContextName = CharacterHealthContextName;
@@ -105,19 +112,11 @@ void UGASC_HealthComponent::InitializeViewModel()
 			GlobalViewModelCollection->RemoveViewModel(CharacterHealthViewModelContext);
 		}
 		
-		GlobalViewModelCollection->AddViewModelInstance(CharacterHealthViewModelContext, CharacterHealthViewModel);
-		HealthViewModel = CharacterHealthViewModel;
-
-		OnHealthViewModelInstantiated.Broadcast(HealthViewModel);
-		HealthViewModelInstantiated(HealthViewModel);
+		GlobalViewModelCollection->AddViewModelInstance(CharacterHealthViewModelContext, HealthViewModel);
+		bRegisteredInGlobalCollection = true;
 	}
 }
 
 void UGASC_HealthComponent::HealthViewModelInstantiated_Implementation(UGASC_UVM_Health* InstantiatedViewModel)
 {
-	if (GetOwner()->HasAuthority())
-	{
-		Server_InitializeHealthAttributes();
-	}
-	Client_InitializeHealthAttributes();
-}
\ No newline at end of file
+}
@@ -22,6 +22,11 @@ void AGASCourseNPC_Base::PossessedBy(AController* NewController)
 		InitializeAbilitySystem(AbilitySystemComponent);
 		//RegisterViewModels();
 	}
+
+	if (CharacterHealthComponent)
+	{
+		CharacterHealthComponent->OnOwnerAbilitySystemInitialized();
+	}
 }
 
 void AGASCourseNPC_Base::BeginPlay()
@@ -42,4 +47,8 @@ void AGASCourseNPC_Base::OnRep_Controller()
 		GetAbilitySystemComponent()->RefreshAbilityActorInfo();
 	}
 
+	if (CharacterHealthComponent)
+	{
+		CharacterHealthComponent->OnOwnerAbilitySystemInitialized();
+	}
 }
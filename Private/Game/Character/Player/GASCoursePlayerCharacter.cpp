@@ -264,6 +264,11 @@ void AGASCoursePlayerCharacter::PossessedBy(AController* NewController)
 		InitializeAbilitySystem(AbilitySystemComponent);
 	}
 
+	if (CharacterHealthComponent)
+	{
+		CharacterHealthComponent->OnOwnerAbilitySystemInitialized();
+	}
+
 	if (AGASCoursePlayerController* PlayerController = Cast<AGASCoursePlayerController>(Controller))
 	{
 		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
@@ -325,6 +330,11 @@ void AGASCoursePlayerCharacter::OnRep_PlayerState()
 	
 	AbilitySystemComponent->RefreshAbilityActorInfo();
 
+	if (CharacterHealthComponent)
+	{
+		CharacterHealthComponent->OnOwnerAbilitySystemInitialized();
+	}
+
 }
 
 void AGASCoursePlayerCharacter::OnRep_Controller()
@@ -334,6 +344,12 @@ void AGASCoursePlayerCharacter::OnRep_Controller()
 	{
 		AbilitySystemComponent->RefreshAbilityActorInfo();
 	}
+
+	// Local control is only known once the controller arrives
+	if (CharacterHealthComponent)
+	{
+		CharacterHealthComponent->OnOwnerAbilitySystemInitialized();
+	}
 }
 
 void AGASCoursePlayerCharacter::BeginPlay()
@@ -4,12 +4,11 @@
 #include "Game/Character/Player/GASCoursePlayerController.h"
 
 #include "AbilitySystemBlueprintLibrary.h"
-#include "Blueprint/WidgetLayoutLibrary.h"
 #include "Game/GameplayAbilitySystem/GASCourseNativeGameplayTags.h"
 #include "GASCourse/GASCourseCharacter.h"
 #include "Components/StateTreeComponent.h"
 #include "Game/Systems/CardEnergy/ActiveCardEnergy/GASC_ActiveCardResourceManager.h"
-#include "Kismet/GameplayStatics.h"
+#include "Game/Systems/Targeting/GASC_CursorQuerySubsystem.h"
 
 AGASCoursePlayerController::AGASCoursePlayerController(const FObjectInitializer& ObjectInitializer)
 {
@@ -127,20 +126,13 @@ void AGASCoursePlayerController::OnRep_Pawn()
 	Super::OnRep_Pawn();
 }
 
-void AGASCoursePlayerController::Tick(float DeltaSeconds)
-{
-	Super::Tick(DeltaSeconds);
-	GetMousePositionInViewport();
-}
-
 void AGASCoursePlayerController::OnDamageDealtCallback(const FGameplayEventData& Payload)
 {
 	OnDamageDealt(Payload);
 	OnDamageDealtDelegate.Broadcast(Payload);
 }
 
-void AGASCoursePlayerController::GetMousePositionInViewport()
+UGASC_CursorQuerySubsystem* AGASCoursePlayerController::GetCursorQuery() const
 {
-	const FVector2D MousePositionInViewport = UWidgetLayoutLibrary::GetMousePositionOnViewport(this);
-	UGameplayStatics::DeprojectScreenToWorld(this, MousePositionInViewport, MousePositionDeprojectedToWorld, MouseDirectionDeprojectedToWorld);
+	return UGASC_CursorQuerySubsystem::Get(this);
 }
@@ -0,0 +1,228 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Deck/GASC_DeckEngine.h"
+
+void FGASC_DeckEngine::Initialize(const TArray<FCardInstance>& InActiveDeck, const TArray<FCardInstance>& InBinder,
+	const TArray<FCardInstance>& InHand, const TArray<FCardInstance>& InGraveyard)
+{
+	ActiveDeck.Reset();
+	Binder.Reset();
+	Hand.Reset();
+	Graveyard.Reset();
+	CardIndex.Reset();
+
+	const TPair<const TArray<FCardInstance>*, EGASC_DeckPile> Sources[] = {
+		{&InActiveDeck, EGASC_DeckPile::ActiveDeck},
+		{&InBinder, EGASC_DeckPile::Binder},
+		{&InHand, EGASC_DeckPile::Hand},
+		{&InGraveyard, EGASC_DeckPile::Graveyard}
+	};
+
+	for (const TPair<const TArray<FCardInstance>*, EGASC_DeckPile>& Source : Sources)
+	{
+		GetMutablePile(Source.Value).Reserve(Source.Key->Num());
+		for (const FCardInstance& Card : *Source.Key)
+		{
+			AddCard(Card, Source.Value);
+		}
+	}
+}
+
+void FGASC_DeckEngine::AddCard(FCardInstance Card, EGASC_DeckPile Pile)
+{
+	// Instances copied in the editor keep the GUID of the original
+	if (!Card.CardInstanceId.IsValid() || CardIndex.Contains(Card.CardInstanceId))
+	{
+		Card.CardInstanceId = FGuid::NewGuid();
+	}
+	PushCard(MoveTemp(Card), Pile);
+}
+
+bool FGASC_DeckEngine::RemoveCard(const FGuid& CardInstanceId, FCardInstance* OutCard)
+{
+	const FCardLocation* Location = CardIndex.Find(CardInstanceId);
+	if (!Location)
+	{
+		return false;
+	}
+
+	FCardInstance Card = TakeCard(Location->Pile, Location->Slot);
+	if (OutCard)
+	{
+		*OutCard = MoveTemp(Card);
+	}
+	return true;
+}
+
+bool FGASC_DeckEngine::MoveCard(const FGuid& CardInstanceId, EGASC_DeckPile ToPile)
+{
+	const FCardLocation* Location = CardIndex.Find(CardInstanceId);
+	if (!Location)
+	{
+		return false;
+	}
+
+	PushCard(TakeCard(Location->Pile, Location->Slot), ToPile);
+	return true;
+}
+
+const FCardInstance* FGASC_DeckEngine::FindCard(const FGuid& CardInstanceId, EGASC_DeckPile* OutPile) const
+{
+	const FCardLocation* Location = CardIndex.Find(CardInstanceId);
+	if (!Location)
+	{
+		return nullptr;
+	}
+
+	if (OutPile)
+	{
+		*OutPile = Location->Pile;
+	}
+	return &GetPile(Location->Pile)[Location->Slot];
+}
+
+bool FGASC_DeckEngine::DrawCard(FCardInstance& OutCard)
+{
+	if (ActiveDeck.IsEmpty())
+	{
+		return false;
+	}
+
+	OutCard = TakeCard(EGASC_DeckPile::ActiveDeck, ActiveDeck.Num() - 1);
+	PushCard(CopyTemp(OutCard), EGASC_DeckPile::Hand);
+	return true;
+}
+
+void FGASC_DeckEngine::SetShuffleSeed(int32 Seed)
+{
+	ShuffleStream.Initialize(Seed);
+}
+
+void FGASC_DeckEngine::ShuffleActiveDeck()
+{
+	// Fisher-Yates, driven by the deck's own stream so a seed reproduces the same order
+	for (int32 Slot = ActiveDeck.Num() - 1; Slot > 0; --Slot)
+	{
+		const int32 SwapSlot = ShuffleStream.RandRange(0, Slot);
+		if (SwapSlot != Slot)
+		{
+			ActiveDeck.Swap(Slot, SwapSlot);
+		}
+	}
+	ReindexPile(EGASC_DeckPile::ActiveDeck);
+}
+
+bool FGASC_DeckEngine::ShuffleCardIntoActiveDeck(const FGuid& CardInstanceId)
+{
+	const FCardLocation* Location = CardIndex.Find(CardInstanceId);
+	if (!Location)
+	{
+		return false;
+	}
+
+	// Inserted rather than swapped in, so the rest of the deck keeps its order and the next draw only changes if the
+	// card lands on top
+	FCardInstance Card = TakeCard(Location->Pile, Location->Slot);
+	const int32 TargetSlot = ShuffleStream.RandRange(0, ActiveDeck.Num());
+	ActiveDeck.Insert(MoveTemp(Card), TargetSlot);
+	ReindexPile(EGASC_DeckPile::ActiveDeck, TargetSlot);
+	return true;
+}
+
+const TArray<FCardInstance>& FGASC_DeckEngine::GetPile(EGASC_DeckPile Pile) const
+{
+	return const_cast<FGASC_DeckEngine*>(this)->GetMutablePile(Pile);
+}
+
+int32 FGASC_DeckEngine::CountCardsOfType(const TSoftObjectPtr<UCardDataAsset>& CardDataAsset, EGASC_DeckPile Pile) const
+{
+	int32 Count = 0;
+	for (const FCardInstance& Card : GetPile(Pile))
+	{
+		if (Card.CardDataAsset == CardDataAsset)
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
+void FGASC_DeckEngine::GatherCardDataPaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const TArray<FCardInstance>* Pile : {&ActiveDeck, &Binder, &Hand, &Graveyard})
+	{
+		for (const FCardInstance& Card : *Pile)
+		{
+			if (!Card.CardDataAsset.IsNull())
+			{
+				OutPaths.AddUnique(Card.CardDataAsset.ToSoftObjectPath());
+			}
+		}
+	}
+}
+
+void FGASC_DeckEngine::RebuildIndex()
+{
+	CardIndex.Reset();
+	ReindexPile(EGASC_DeckPile::ActiveDeck);
+	ReindexPile(EGASC_DeckPile::Binder);
+	ReindexPile(EGASC_DeckPile::Hand);
+	ReindexPile(EGASC_DeckPile::Graveyard);
+}
+
+TArray<FCardInstance>& FGASC_DeckEngine::GetMutablePile(EGASC_DeckPile Pile)
+{
+	switch (Pile)
+	{
+	case EGASC_DeckPile::Binder:
+		return Binder;
+	case EGASC_DeckPile::Hand:
+		return Hand;
+	case EGASC_DeckPile::Graveyard:
+		return Graveyard;
+	case EGASC_DeckPile::ActiveDeck:
+	default:
+		return ActiveDeck;
+	}
+}
+
+void FGASC_DeckEngine::PushCard(FCardInstance&& Card, EGASC_DeckPile Pile)
+{
+	TArray<FCardInstance>& PileCards = GetMutablePile(Pile);
+	const FGuid CardInstanceId = Card.CardInstanceId;
+	const int32 Slot = PileCards.Add(MoveTemp(Card));
+	CardIndex.Add(CardInstanceId, {Pile, Slot});
+}
+
+FCardInstance FGASC_DeckEngine::TakeCard(EGASC_DeckPile Pile, int32 Slot)
+{
+	TArray<FCardInstance>& PileCards = GetMutablePile(Pile);
+	FCardInstance Card = MoveTemp(PileCards[Slot]);
+	CardIndex.Remove(Card.CardInstanceId);
+
+	if (Pile == EGASC_DeckPile::ActiveDeck)
+	{
+		// Draw order matters here; taking the top card (the common case) shifts nothing
+		PileCards.RemoveAt(Slot, 1, EAllowShrinking::No);
+		ReindexPile(Pile, Slot);
+	}
+	else
+	{
+		PileCards.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+		if (PileCards.IsValidIndex(Slot))
+		{
+			CardIndex.FindChecked(PileCards[Slot].CardInstanceId).Slot = Slot;
+		}
+	}
+	return Card;
+}
+
+void FGASC_DeckEngine::ReindexPile(EGASC_DeckPile Pile, int32 FirstSlot)
+{
+	const TArray<FCardInstance>& PileCards = GetPile(Pile);
+	for (int32 Slot = FirstSlot; Slot < PileCards.Num(); ++Slot)
+	{
+		CardIndex.Add(PileCards[Slot].CardInstanceId, {Pile, Slot});
+	}
+}
@@ -187,28 +187,25 @@ void UGASCourseHealthAttributeSet::PostGameplayEffectExecute(const FGameplayEffe
 
 		SetCurrentHealth(FMath::Clamp(NewHealth, 0.0f, GetMaxHealth()));
 		
-		// 1. Get original context
-		FGameplayEffectContextHandle Original = Spec.GetEffectContext();
-
-		// 2. Duplicate into a writable one
-		FGameplayEffectContextHandle NewContext = Original.Duplicate();
-
-		// 3. Modify your custom data
-		FGASCourseGameplayEffectContext* MutableContext =
-			static_cast<FGASCourseGameplayEffectContext*>(NewContext.Get());
-			
-		MutableContext->DamageLogEntry.FinalDamageValue = NewHealth >= GetMaxHealth() ? GetMaxHealth() - GetCurrentHealth() : LocalDamage;
-		MutableContext->DamageLogEntry.bIsCriticalHit = bIsCritical;
-		MutableContext->DamageLogEntry.bIsDamageEffect = true;
-		MutableContext->DamageLogEntry.bIsOverTimeEffect = bIsDamageOverTime;
-		MutableContext->DamageLogEntry.bDamageResisted = bDamageResisted;
-		MutableContext->DamageLogEntry.HitContextTagsContainer.AppendTags(Spec.GetDynamicAssetTags());
-			
+#if GASC_WITH_DAMAGE_LOG
+		// Finish the execution's log record on a local copy; the context itself is never written here
 		if (UDamagePipelineDebugSubsystem* Debug = GetWorld()->GetSubsystem<UDamagePipelineDebugSubsystem>())
 		{
-			MutableContext->DamageLogEntry.DamageID = Debug->GenerateDebugDamageUniqueID();
-			Debug->LogDamageEvent(MutableContext->DamageLogEntry);
+			if (const FGASCourseGameplayEffectContext* SourceContext =
+				static_cast<const FGASCourseGameplayEffectContext*>(Spec.GetEffectContext().Get()))
+			{
+				FDamageLogEntry DamageLogEntry = SourceContext->DamageLogEntry;
+				DamageLogEntry.FinalDamageValue = NewHealth >= GetMaxHealth() ? GetMaxHealth() - GetCurrentHealth() : LocalDamage;
+				DamageLogEntry.bIsCriticalHit = bIsCritical;
+				DamageLogEntry.bIsDamageEffect = true;
+				DamageLogEntry.bIsOverTimeEffect = bIsDamageOverTime;
+				DamageLogEntry.bDamageResisted = bDamageResisted;
+				DamageLogEntry.HitContextTagsContainer.AppendTags(Spec.GetDynamicAssetTags());
+				DamageLogEntry.DamageID = Debug->GenerateDebugDamageUniqueID();
+				Debug->LogDamageEvent(DamageLogEntry);
+			}
 		}
+#endif
 
 		// ---------------- Damage pipeline event ----------------
 		if (UGASC_DamagePipelineSubsystem* DPS = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
@@ -238,9 +235,8 @@ void UGASCourseHealthAttributeSet::PostGameplayEffectExecute(const FGameplayEffe
 
 			ModContext.HitContext = HitCtx;
 
-			// Delegates broadcast synchronously -> pointer to HitCtx is safe
-			DPS->Internal_BroadcastDamageApplied(ModContext);
-			DPS->Internal_BroadcastDamageReceived(ModContext);
+			// Broadcasts now, or queues for the end-of-frame flush in batched mode (AssetTags is copied then)
+			DPS->Internal_SubmitDamageModification(ModContext, AssetTags);
 		}
 
 		// ---------------- Death handling ----------------
@@ -298,27 +294,24 @@ void UGASCourseHealthAttributeSet::PostGameplayEffectExecute(const FGameplayEffe
 			NewHealth = FMath::Clamp(NewHealth, 0.0f, GetMaxHealth());
 			SetCurrentHealth(NewHealth);
 			
-			// 1. Get original context
-			FGameplayEffectContextHandle Original = Spec.GetEffectContext();
-
-			// 2. Duplicate into a writable one
-			FGameplayEffectContextHandle NewContext = Original.Duplicate();
-
-			// 3. Modify your custom data
-			FGASCourseGameplayEffectContext* MutableContext =
-				static_cast<FGASCourseGameplayEffectContext*>(NewContext.Get());
-			
-			MutableContext->DamageLogEntry.FinalDamageValue = TrueHealthDelta;
-			MutableContext->DamageLogEntry.bIsCriticalHit = bIsCritical;
-			MutableContext->DamageLogEntry.bIsDamageEffect = false;
-			MutableContext->DamageLogEntry.bIsOverTimeEffect = bIsDamageOverTime;
-			MutableContext->DamageLogEntry.bLifeSteal = bLifeSteal;
-			
+#if GASC_WITH_DAMAGE_LOG
+			// Finish the execution's log record on a local copy; the context itself is never written here
 			if (UDamagePipelineDebugSubsystem* Debug = GetWorld()->GetSubsystem<UDamagePipelineDebugSubsystem>())
 			{
-				MutableContext->DamageLogEntry.DamageID = Debug->GenerateDebugDamageUniqueID();
-				Debug->LogDamageEvent(MutableContext->DamageLogEntry);
+				if (const FGASCourseGameplayEffectContext* SourceContext =
+					static_cast<const FGASCourseGameplayEffectContext*>(Spec.GetEffectContext().Get()))
+				{
+					FDamageLogEntry DamageLogEntry = SourceContext->DamageLogEntry;
+					DamageLogEntry.FinalDamageValue = TrueHealthDelta;
+					DamageLogEntry.bIsCriticalHit = bIsCritical;
+					DamageLogEntry.bIsDamageEffect = false;
+					DamageLogEntry.bIsOverTimeEffect = bIsDamageOverTime;
+					DamageLogEntry.bLifeSteal = bLifeSteal;
+					DamageLogEntry.DamageID = Debug->GenerateDebugDamageUniqueID();
+					Debug->LogDamageEvent(DamageLogEntry);
+				}
 			}
+#endif
 			
 			if (UGASC_DamagePipelineSubsystem* DPS = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 			{
@@ -347,8 +340,7 @@ void UGASCourseHealthAttributeSet::PostGameplayEffectExecute(const FGameplayEffe
 
 				ModContext.HitContext = HitCtx;
 
-				DPS->Internal_ForwardOnHealingReceived(ModContext);
-				DPS->Internal_ForwardOnHealingApplied(ModContext);
+				DPS->Internal_SubmitDamageModification(ModContext, AssetTags);
 
 				// ---- Gameplay events for UI / logic ----
 				if (SourceASC)
@@ -361,7 +353,7 @@ void UGASCourseHealthAttributeSet::PostGameplayEffectExecute(const FGameplayEffe
 					TargetHealedPayload.InstigatorTags = DynamicTags;
 					TargetHealedPayload.InstigatorTags.AddTag(DamageType_Healing);
 
-					// Use HandleGameplayEvent (sync) for better perf; swap to SendGameplayEventAsync if you truly need async BP.
+					// Use HandleGameplayEvent (sync) for better perf; swap to QueueGameplayEvent if these should be deferred to the frame's event flush.
 					TargetASC->HandleGameplayEvent(Event_Gameplay_OnTargetHealed, &TargetHealedPayload);
 					SourceASC->HandleGameplayEvent(Event_Gameplay_OnHealing, &TargetHealedPayload);
 				}
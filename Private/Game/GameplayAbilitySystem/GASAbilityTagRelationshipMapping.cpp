@@ -2,6 +2,7 @@
 
 
 #include "Game/GameplayAbilitySystem/GASAbilityTagRelationshipMapping.h"
+#include "Abilities/GameplayAbility.h"
 
 void UGASAbilityTagRelationshipMapping::GetAbilityTagsToBlockAndCancel(const FGameplayTagContainer& AbilityTags,
 	FGameplayTagContainer* OutTagsToBlock, FGameplayTagContainer* OutTagsToCancel) const
@@ -61,3 +62,66 @@ bool UGASAbilityTagRelationshipMapping::IsAbilityCancelledByTag(const FGameplayT
 
 	return false;
 }
+
+const FGASCourseCompiledActivationTags& UGASAbilityTagRelationshipMapping::GetCompiledActivationTags(const UGameplayAbility& Ability) const
+{
+	if (const FGASCourseCompiledActivationTags* Compiled = CompiledActivationTagsByClass.Find(Ability.GetClass()))
+	{
+		return *Compiled;
+	}
+
+	if (!bRelationshipsCompiled)
+	{
+		CompileRelationships();
+	}
+
+	FGASCourseCompiledActivationTags& Compiled = CompiledActivationTagsByClass.Add(Ability.GetClass());
+
+	// Same matching as GetRequiredAndBlockedActivationTags: a relationship applies if any ability tag is its tag or a child of it
+	for (const FGameplayTag& AbilityTag : Ability.GetAssetTags())
+	{
+		for (FGameplayTag Tag = AbilityTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+		{
+			for (auto It = RelationshipsByAbilityTag.CreateConstKeyIterator(Tag); It; ++It)
+			{
+				const FGASCourseAbilityTagRelationship& Relationship = AbilityTagRelationships[It.Value()];
+				Compiled.RequiredTags.AppendTags(Relationship.ActivationRequiredTags);
+				Compiled.BlockedTags.AppendTags(Relationship.ActivationBlockedTags);
+			}
+		}
+	}
+	return Compiled;
+}
+
+void UGASAbilityTagRelationshipMapping::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileRelationships();
+}
+
+#if WITH_EDITOR
+void UGASAbilityTagRelationshipMapping::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Abilities re-resolve their tags against the edited relationships on their next activation check
+	CompileRelationships();
+}
+#endif
+
+void UGASAbilityTagRelationshipMapping::CompileRelationships() const
+{
+	RelationshipsByAbilityTag.Reset();
+	CompiledActivationTagsByClass.Reset();
+
+	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
+	{
+		const FGASCourseAbilityTagRelationship& Relationship = AbilityTagRelationships[i];
+		if (Relationship.AbilityTag.IsValid())
+		{
+			RelationshipsByAbilityTag.Add(Relationship.AbilityTag, i);
+		}
+	}
+	bRelationshipsCompiled = true;
+}
@@ -9,12 +9,20 @@
 #include "Game/GameplayAbilitySystem/GASCourseNativeGameplayTags.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "GASCourse/GASCourseCharacter.h"
+#include "Game/Card/BaseCardGameplayAbilitySet.h"
 
 UGASCourseAbilitySystemComponent::UGASCourseAbilitySystemComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	ReplicationProxyEnabled = true;
 	SetIsReplicated(true);
+
+	// Queued gameplay events are handled once per frame, after every actor and component tick that could queue them.
+	// Tickable subsystems run after all tick groups, so those that queue events (melee traces) flush them themselves.
+	GameplayEventQueueTickFunction.bCanEverTick = true;
+	GameplayEventQueueTickFunction.bStartWithTickEnabled = false;
+	GameplayEventQueueTickFunction.bTickEvenWhenPaused = true;
+	GameplayEventQueueTickFunction.TickGroup = TG_LastDemotable;
 }
 
 void UGASCourseAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AActor* InAvatarActor)
@@ -149,17 +157,19 @@ void UGASCourseAbilitySystemComponent::GetAdditionalActivationTagRequirements(co
 	}
 }
 
+const FGASCourseCompiledActivationTags* UGASCourseAbilitySystemComponent::GetCompiledActivationTagRequirements(const UGameplayAbility& Ability) const
+{
+	return AbilityTagRelationshipMapping ? &AbilityTagRelationshipMapping->GetCompiledActivationTags(Ability) : nullptr;
+}
+
 void UGASCourseAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& InputTag)
 {
 	if (InputTag.IsValid())
 	{
-		for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+		for (auto It = InputTagToSpecHandles.CreateConstKeyIterator(InputTag); It; ++It)
 		{
-			if (AbilitySpec.Ability && (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag)))
-			{
-				InputPressedSpecHandles.AddUnique(AbilitySpec.Handle);
-				InputHeldSpecHandles.AddUnique(AbilitySpec.Handle);
-			}
+			InputPressedSpecHandles.AddUnique(It.Value());
+			InputHeldSpecHandles.AddUnique(It.Value());
 		}
 	}
 }
@@ -168,17 +178,68 @@ void UGASCourseAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTa
 {
 	if (InputTag.IsValid())
 	{
-		for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+		for (auto It = InputTagToSpecHandles.CreateConstKeyIterator(InputTag); It; ++It)
 		{
-			if (AbilitySpec.Ability && (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag)))
-			{
-				InputReleasedSpecHandles.AddUnique(AbilitySpec.Handle);
-				InputHeldSpecHandles.Remove(AbilitySpec.Handle);
-			}
+			InputReleasedSpecHandles.AddUnique(It.Value());
+			InputHeldSpecHandles.Remove(It.Value());
 		}
 	}
 }
 
+void UGASCourseAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+
+	AddToInputTagIndex(AbilitySpec);
+}
+
+void UGASCourseAbilitySystemComponent::OnRep_ActivateAbilities()
+{
+	Super::OnRep_ActivateAbilities();
+
+	// Replicated specs can have their dynamic tags changed in place, which has no per-spec callback
+	RebuildInputTagIndex();
+}
+
+void UGASCourseAbilitySystemComponent::AddToInputTagIndex(const FGameplayAbilitySpec& AbilitySpec)
+{
+	const FGameplayTagContainer& SpecTags = AbilitySpec.GetDynamicSpecSourceTags();
+	if (!AbilitySpec.Ability || SpecTags.IsEmpty())
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : SpecTags)
+	{
+		InputTagToSpecHandles.AddUnique(Tag, AbilitySpec.Handle);
+	}
+	IndexedSpecInputTags.Add(AbilitySpec.Handle, SpecTags);
+}
+
+void UGASCourseAbilitySystemComponent::RemoveFromInputTagIndex(const FGameplayAbilitySpecHandle& SpecHandle)
+{
+	FGameplayTagContainer IndexedTags;
+	if (!IndexedSpecInputTags.RemoveAndCopyValue(SpecHandle, IndexedTags))
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : IndexedTags)
+	{
+		InputTagToSpecHandles.RemoveSingle(Tag, SpecHandle);
+	}
+}
+
+void UGASCourseAbilitySystemComponent::RebuildInputTagIndex()
+{
+	InputTagToSpecHandles.Reset();
+	IndexedSpecInputTags.Reset();
+	for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+	{
+		AddToInputTagIndex(AbilitySpec);
+	}
+}
+
 void UGASCourseAbilitySystemComponent::AbilitySpecInputPressed(FGameplayAbilitySpec& Spec)
 {
 	Super::AbilitySpecInputPressed(Spec);
@@ -207,7 +268,6 @@ void UGASCourseAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool
 		return;
 	}
 
-	static TArray<FGameplayAbilitySpecHandle> AbilitiesToActivate;
 	AbilitiesToActivate.Reset();
 
 	//
@@ -443,60 +503,135 @@ void UGASCourseAbilitySystemComponent::WaitForAbilityCooldownEnd(UGameplayAbilit
 	}
 }
 
-void UGASCourseAbilitySystemComponent::SendGameplayEventAsync(FGameplayTag EventTag, const FGameplayEventData& EventData) const
+void UGASCourseAbilitySystemComponent::QueueGameplayEvent(FGameplayTag EventTag, FGameplayEventData EventData, bool bAllowMerge)
+{
+	if (bAllowMerge)
+	{
+		for (int32 EventIndex = NextQueuedGameplayEvent; EventIndex < QueuedGameplayEvents.Num(); ++EventIndex)
+		{
+			FQueuedGameplayEvent& QueuedEvent = QueuedGameplayEvents[EventIndex];
+			if (QueuedEvent.bAllowMerge && QueuedEvent.EventTag == EventTag
+				&& QueuedEvent.EventData.Instigator == EventData.Instigator && QueuedEvent.EventData.Target == EventData.Target)
+			{
+				const float MergedMagnitude = QueuedEvent.EventData.EventMagnitude + EventData.EventMagnitude;
+				QueuedEvent.EventData = MoveTemp(EventData);
+				QueuedEvent.EventData.EventMagnitude = MergedMagnitude;
+				return;
+			}
+		}
+	}
+
+	if (QueuedGameplayEvents.Num() == GameplayEventQueueCapacity)
+	{
+		if (bFlushingGameplayEvents)
+		{
+			HandleGameplayEvent(EventTag, &EventData);
+			return;
+		}
+		FlushGameplayEventQueue();
+	}
+
+	QueuedGameplayEvents.Add({EventTag, MoveTemp(EventData), bAllowMerge});
+
+	if (!GameplayEventQueueTickFunction.IsTickFunctionRegistered())
+	{
+		// Not ticking in a world (yet); nothing would ever flush the queue
+		FlushGameplayEventQueue();
+		return;
+	}
+	GameplayEventQueueTickFunction.SetTickFunctionEnable(true);
+}
+
+void UGASCourseAbilitySystemComponent::FlushGameplayEventQueue()
 {
+	if (bFlushingGameplayEvents)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FlushGameplayEventQueue);
+
+	bFlushingGameplayEvents = true;
+	while (NextQueuedGameplayEvent < QueuedGameplayEvents.Num())
+	{
+		FQueuedGameplayEvent& QueuedEvent = QueuedGameplayEvents[NextQueuedGameplayEvent++];
+		HandleGameplayEvent(QueuedEvent.EventTag, &QueuedEvent.EventData);
+	}
+	QueuedGameplayEvents.Reset();
+	NextQueuedGameplayEvent = 0;
+	bFlushingGameplayEvents = false;
 
-	TRACE_CPUPROFILER_EVENT_SCOPE(SendGameplayEventAsync);
-	
-	TWeakObjectPtr<UGASCourseAbilitySystemComponent> WeakThis = const_cast<UGASCourseAbilitySystemComponent*>(this);
+	if (GameplayEventQueueTickFunction.IsTickFunctionRegistered())
+	{
+		GameplayEventQueueTickFunction.SetTickFunctionEnable(false);
+	}
+}
 
-	FGameplayEventData EventDataCopy = EventData;
-	
-	UE::Tasks::Launch(
-		UE_SOURCE_LOCATION,
-		[WeakThis, EventTag, EventDataCopy]()
+void UGASCourseAbilitySystemComponent::RegisterComponentTickFunctions(bool bRegister)
+{
+	Super::RegisterComponentTickFunctions(bRegister);
+
+	if (bRegister)
+	{
+		if (SetupActorComponentTickFunction(&GameplayEventQueueTickFunction))
 		{
-			AsyncTask(ENamedThreads::GameThread, [WeakThis, EventTag, EventDataCopy]()
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(HandleGameplayEvent_Async)
-				if (UAbilitySystemComponent* ASC = WeakThis.Get())
-				{
-					ASC->HandleGameplayEvent(EventTag, &EventDataCopy);
-UE_LOG(LogAbilitySystemComponent, Display, TEXT("Async Gameplay Event Sent: %s"), *EventTag.GetTagName().ToString());
-				}
-			});
+			GameplayEventQueueTickFunction.Target = this;
 		}
-	);
+	}
+	else
+	{
+		if (GameplayEventQueueTickFunction.IsTickFunctionRegistered())
+		{
+			GameplayEventQueueTickFunction.UnRegisterTickFunction();
+		}
+
+		// Nothing is left to handle events for an unregistered component
+		QueuedGameplayEvents.Reset();
+		NextQueuedGameplayEvent = 0;
+	}
+}
+
+void FGASC_GameplayEventQueueTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType,
+	ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (IsValid(Target))
+	{
+		Target->FlushGameplayEventQueue();
+	}
+}
+
+FString FGASC_GameplayEventQueueTickFunction::DiagnosticMessage()
+{
+	return Target ? Target->GetFullName() + TEXT("[GameplayEventQueue]") : TEXT("<NULL>[GameplayEventQueue]");
+}
+
+FName FGASC_GameplayEventQueueTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return Target ? Target->GetClass()->GetFName() : NAME_None;
 }
 
 TSubclassOf<UGameplayAbility> UGASCourseAbilitySystemComponent::GetAbilityFromTaggedInput(FGameplayTag InputTag)
 {
-	TArray<FGameplayAbilitySpecHandle> OutAbilityHandles;
-	TSubclassOf<UGameplayAbility> OutAbility = nullptr;
-	GetAllAbilities(OutAbilityHandles);
-	for(FGameplayAbilitySpecHandle SpecHandle : OutAbilityHandles)
+	for (auto It = InputTagToSpecHandles.CreateConstKeyIterator(InputTag); It; ++It)
 	{
-		bool bInstanced = false;
-		if(const UGASCourseGameplayAbility* Ability = Cast<UGASCourseGameplayAbility>(UAbilitySystemBlueprintLibrary::GetGameplayAbilityFromSpecHandle(this, SpecHandle, bInstanced)))
+		if (const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(It.Value()))
 		{
-			if(Ability->GetDynamicAbilityTags().HasTagExact(InputTag))
+			if (Cast<UGASCourseGameplayAbility>(AbilitySpec->Ability))
 			{
-				return Ability->GetClass();
+				return AbilitySpec->Ability->GetClass();
 			}
 		}
 	}
 
-	return OutAbility;
+	return nullptr;
 }
 
 bool UGASCourseAbilitySystemComponent::IsActiveAbilityCardAlreadyGranted(TSubclassOf<UGameplayAbility> InAbilityClass) const
 {
 	//TODO: Do I need to scope this for only active ability card types? Or can this be reused for passive cards as well?
-	TArray<FGameplayAbilitySpecHandle> ActiveCardHandles;
-	CardAbilityConfigHandles.GetKeys(ActiveCardHandles);
-	for (const FGameplayAbilitySpecHandle Handle : ActiveCardHandles)
+	for (const TPair<FGameplayAbilitySpecHandle, FGrantedCardAbilityConfig>& CardConfig : CardAbilityConfigHandles)
 	{
-		if (const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(Handle))
+		if (const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(CardConfig.Key))
 		{
 			if (AbilitySpec->Ability && AbilitySpec->Ability->GetClass() == InAbilityClass)
 			{
@@ -505,4 +640,175 @@ bool UGASCourseAbilitySystemComponent::IsActiveAbilityCardAlreadyGranted(TSubcla
 		}
 	}
 	return false;
-}
\ No newline at end of file
+}
+
+float UGASCourseAbilitySystemComponent::GetAbilityStackCount(const FGameplayAttribute& CurrentStackAttribute) const
+{
+	return HasAttributeSetForAttribute(CurrentStackAttribute) ? GetNumericAttribute(CurrentStackAttribute) : 0.0f;
+}
+
+void UGASCourseAbilitySystemComponent::SetAbilityStackCount(const FGameplayAttribute& CurrentStackAttribute,
+	const FGameplayAttribute& MaxStackAttribute, float StackCount)
+{
+	if (HasAttributeSetForAttribute(MaxStackAttribute))
+	{
+		SetNumericAttributeBase(MaxStackAttribute, StackCount);
+	}
+	if (HasAttributeSetForAttribute(CurrentStackAttribute))
+	{
+		SetNumericAttributeBase(CurrentStackAttribute, StackCount);
+	}
+}
+
+float UGASCourseAbilitySystemComponent::ModifyAbilityStackCount(const FGameplayAttribute& CurrentStackAttribute,
+	const FGameplayAttribute& MaxStackAttribute, float Delta)
+{
+	if (!HasAttributeSetForAttribute(CurrentStackAttribute))
+	{
+		return 0.0f;
+	}
+
+	const float MaxStackCount = HasAttributeSetForAttribute(MaxStackAttribute) ? GetNumericAttribute(MaxStackAttribute) : TNumericLimits<float>::Max();
+	const float NewStackCount = FMath::Clamp(GetNumericAttributeBase(CurrentStackAttribute) + Delta, 0.0f, MaxStackCount);
+	SetNumericAttributeBase(CurrentStackAttribute, NewStackCount);
+	return NewStackCount;
+}
+
+FGASC_CardGrantHandle UGASCourseAbilitySystemComponent::AllocateCardGrant(const UBaseCardGameplayAbilitySet* CardAbilitySet,
+	int32 CardLevel, const FGuid& CardInstanceId)
+{
+	int32 RecordIndex;
+	if (!FreeCardGrantRecords.IsEmpty())
+	{
+		RecordIndex = FreeCardGrantRecords.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		RecordIndex = CardGrantRecords.AddDefaulted();
+	}
+
+	FGASC_CardGrantRecord& Record = CardGrantRecords[RecordIndex];
+	Record.CardAbilitySet = CardAbilitySet;
+	Record.CardInstanceId = CardInstanceId;
+	Record.CardLevel = CardLevel;
+	Record.bInUse = true;
+
+	FGASC_CardGrantHandle GrantHandle;
+	GrantHandle.Index = RecordIndex;
+	GrantHandle.Generation = Record.Generation;
+	return GrantHandle;
+}
+
+FGASC_CardGrantRecord* UGASCourseAbilitySystemComponent::FindCardGrant(const FGASC_CardGrantHandle& GrantHandle)
+{
+	if (!CardGrantRecords.IsValidIndex(GrantHandle.Index))
+	{
+		return nullptr;
+	}
+
+	FGASC_CardGrantRecord& Record = CardGrantRecords[GrantHandle.Index];
+	return Record.bInUse && Record.Generation == GrantHandle.Generation ? &Record : nullptr;
+}
+
+int32 UGASCourseAbilitySystemComponent::GetCardGrantLevel(const FGASC_CardGrantHandle& GrantHandle) const
+{
+	const FGASC_CardGrantRecord* Record = const_cast<UGASCourseAbilitySystemComponent*>(this)->FindCardGrant(GrantHandle);
+	return Record ? Record->CardLevel : INDEX_NONE;
+}
+
+bool UGASCourseAbilitySystemComponent::SetCardGrantLevel(const FGASC_CardGrantHandle& GrantHandle, int32 CardLevel)
+{
+	FGASC_CardGrantRecord* Record = FindCardGrant(GrantHandle);
+	if (!Record || !IsOwnerActorAuthoritative())
+	{
+		return false;
+	}
+
+	Record->CardLevel = CardLevel;
+	for (const FGameplayAbilitySpecHandle& SpecHandle : Record->GrantedHandles.GetAbilitySpecHandles())
+	{
+		if (FGameplayAbilitySpec* Spec = FindAbilitySpecFromHandle(SpecHandle))
+		{
+			Spec->Level = CardLevel;
+			MarkAbilitySpecDirty(*Spec);
+		}
+	}
+	return true;
+}
+
+bool UGASCourseAbilitySystemComponent::RevokeCardGrant(const FGASC_CardGrantHandle& GrantHandle)
+{
+	if (!FindCardGrant(GrantHandle))
+	{
+		return false;
+	}
+
+	ReleaseCardGrant(GrantHandle.Index);
+	return true;
+}
+
+int32 UGASCourseAbilitySystemComponent::RevokeCardGrantsForCardInstance(const FGuid& CardInstanceId)
+{
+	if (!CardInstanceId.IsValid())
+	{
+		return 0;
+	}
+
+	int32 NumRevoked = 0;
+	for (int32 RecordIndex = 0; RecordIndex < CardGrantRecords.Num(); ++RecordIndex)
+	{
+		const FGASC_CardGrantRecord& Record = CardGrantRecords[RecordIndex];
+		if (Record.bInUse && Record.CardInstanceId == CardInstanceId)
+		{
+			ReleaseCardGrant(RecordIndex);
+			++NumRevoked;
+		}
+	}
+	return NumRevoked;
+}
+
+int32 UGASCourseAbilitySystemComponent::RevokeCardGrantsFromSet(const UBaseCardGameplayAbilitySet* CardAbilitySet)
+{
+	int32 NumRevoked = 0;
+	for (int32 RecordIndex = 0; RecordIndex < CardGrantRecords.Num(); ++RecordIndex)
+	{
+		const FGASC_CardGrantRecord& Record = CardGrantRecords[RecordIndex];
+		if (Record.bInUse && Record.CardAbilitySet == CardAbilitySet)
+		{
+			ReleaseCardGrant(RecordIndex);
+			++NumRevoked;
+		}
+	}
+	return NumRevoked;
+}
+
+void UGASCourseAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnRemoveAbility(AbilitySpec);
+
+	RemoveFromInputTagIndex(AbilitySpec.Handle);
+
+	// Card abilities clear themselves when their last stack ends; drop the stale handle and recycle any record
+	// that has nothing left to take back
+	for (int32 RecordIndex = 0; RecordIndex < CardGrantRecords.Num(); ++RecordIndex)
+	{
+		FGASC_CardGrantRecord& Record = CardGrantRecords[RecordIndex];
+		if (Record.bInUse && Record.GrantedHandles.RemoveAbilitySpecHandle(AbilitySpec.Handle) && Record.GrantedHandles.IsEmpty())
+		{
+			ReleaseCardGrant(RecordIndex);
+		}
+	}
+}
+
+void UGASCourseAbilitySystemComponent::ReleaseCardGrant(int32 RecordIndex)
+{
+	FGASC_CardGrantRecord& Record = CardGrantRecords[RecordIndex];
+
+	// Marked free first so the OnRemoveAbility calls made while taking the grants back skip this record
+	Record.bInUse = false;
+	Record.GrantedHandles.TakeFromAbilitySystem(this);
+	Record.CardAbilitySet.Reset();
+	Record.CardInstanceId.Invalidate();
+	++Record.Generation;
+	FreeCardGrantRecords.Add(RecordIndex);
+}
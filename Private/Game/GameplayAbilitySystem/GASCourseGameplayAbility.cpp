@@ -340,38 +340,26 @@ bool UGASCourseGameplayAbility::DoesAbilitySatisfyTagRequirements(const UAbility
 		bBlocked = true;
 	}
 
-	const UGASCourseAbilitySystemComponent* GASCourseASC = Cast<UGASCourseAbilitySystemComponent>(&AbilitySystemComponent);
-	static FGameplayTagContainer AllRequiredTags;
-	static FGameplayTagContainer AllBlockedTags;
-
-	AllRequiredTags = ActivationRequiredTags;
-	AllBlockedTags = ActivationBlockedTags;
+	// Checked straight against the ASC's tag counts, with the mapping's additions resolved once per ability class
+	if (AbilitySystemComponent.HasAnyMatchingGameplayTags(ActivationBlockedTags))
+	{
+		bBlocked = true;
+	}
 
-	// Expand our ability tags to add additional required/blocked tags
-	if (GASCourseASC)
+	if (!AbilitySystemComponent.HasAllMatchingGameplayTags(ActivationRequiredTags))
 	{
-		GASCourseASC->GetAdditionalActivationTagRequirements(GetAssetTags(), AllRequiredTags, AllBlockedTags);
+		bMissing = true;
 	}
 
-	// Check to see the required/blocked tags for this ability
-	if (AllBlockedTags.Num() || AllRequiredTags.Num())
+	const UGASCourseAbilitySystemComponent* GASCourseASC = Cast<UGASCourseAbilitySystemComponent>(&AbilitySystemComponent);
+	if (const FGASCourseCompiledActivationTags* MappedTags = GASCourseASC ? GASCourseASC->GetCompiledActivationTagRequirements(*this) : nullptr)
 	{
-		static FGameplayTagContainer AbilitySystemComponentTags;
-		
-		AbilitySystemComponentTags.Reset();
-		AbilitySystemComponent.GetOwnedGameplayTags(AbilitySystemComponentTags);
-		
-		if (AbilitySystemComponentTags.HasAny(AllBlockedTags))
+		if (AbilitySystemComponent.HasAnyMatchingGameplayTags(MappedTags->BlockedTags))
 		{
-			if (OptionalRelevantTags && AbilitySystemComponentTags.HasTag(Status_Death))
-			{
-				// If player is dead and was rejected due to blocking tags, give that feedback
-			}
-
 			bBlocked = true;
 		}
 
-		if (!AbilitySystemComponentTags.HasAll(AllRequiredTags))
+		if (!AbilitySystemComponent.HasAllMatchingGameplayTags(MappedTags->RequiredTags))
 		{
 			bMissing = true;
 		}
@@ -55,6 +55,9 @@ UE_DEFINE_GAMEPLAY_TAG_COMMENT(Status_Invulnerable_Reactions, "Status.Invulnerab
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(Status_CardEnergyCostOverride, "Status.Card.CostOverride",
 	"When applied, card cost will equal value set to GetCardEnergyCostOverrideAttribute.")
 
+UE_DEFINE_GAMEPLAY_TAG_COMMENT(Effect_Gameplay_Status, "Effect.Gameplay.Status",
+	"Root of the status tags looked up in the status effect table.")
+
 UE_DEFINE_GAMEPLAY_TAG(Data_IncomingDamage, "Data.IncomingDamage")
 UE_DEFINE_GAMEPLAY_TAG(Data_IncomingHealing, "Data.IncomingHealing")
 UE_DEFINE_GAMEPLAY_TAG(Data_IncomingCardEnergyXP, "Data.IncomingCardEnergyXP")
@@ -74,6 +77,9 @@ UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_HealingLifeSteal, "Data.Healing.LifeSteal",
 UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_CardCost, "Data.Card.Cost",
 	"Used to inform card cost execution class of the base cost of the activated card.")
 
+UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_AbilityStackCount, "Data.Ability.StackCount",
+	"Stack count written to an ability's max and current stack attributes by the stack initialization effect.")
+
 UE_DEFINE_GAMEPLAY_TAG(DamageType_Root, "Damage.Type")
 UE_DEFINE_GAMEPLAY_TAG(DamageType_Physical, "Damage.Type.Physical")
 UE_DEFINE_GAMEPLAY_TAG(DamageType_Elemental, "Damage.Type.Elemental")
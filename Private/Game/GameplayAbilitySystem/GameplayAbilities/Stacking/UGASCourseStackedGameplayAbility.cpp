@@ -6,6 +6,8 @@
 #include "AbilitySystemGlobals.h"
 #include "Game/GameplayAbilitySystem/GASCourseNativeGameplayTags.h"
 #include "Game/GameplayAbilitySystem/AttributeSets/GASC_AbilityStacksAttributeSet.h"
+#include "Game/GameplayAbilitySystem/GameplayEffect/Ability/GASC_AbilityStackInitEffect.h"
+#include "Game/GameplayAbilitySystem/GASCourseAbilitySystemComponent.h"
 
 UGASCourseStackedGameplayAbility::UGASCourseStackedGameplayAbility(const FObjectInitializer& ObjectInitializer)
 {
@@ -49,7 +51,7 @@ void UGASCourseStackedGameplayAbility::OnGiveAbility(const FGameplayAbilityActor
                                                      const FGameplayAbilitySpec& Spec)
 {
 	Super::OnGiveAbility(ActorInfo, Spec);
-	InitializeStackCountAttributes();
+	InitializeStackCountAttributes(ActorInfo, Spec);
 }
 
 bool UGASCourseStackedGameplayAbility::CanActivateAbility(const FGameplayAbilitySpecHandle Handle,
@@ -88,37 +90,35 @@ bool UGASCourseStackedGameplayAbility::CanActivateAbility(const FGameplayAbility
 		Super::CanActivateAbility(Handle, ActorInfo, SourceTags, TargetTags, OptionalRelevantTags));
 }
 
-void UGASCourseStackedGameplayAbility::InitializeStackCountAttributes()
+void UGASCourseStackedGameplayAbility::InitializeStackCountAttributes(const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilitySpec& Spec) const
 {
 	if (!MaxStackAttribute.IsValid() || !CurrentStackAttribute.IsValid())
 	{
 		UE_LOG(LogTemp, Error, TEXT("MaxStackAttribute OR CurrentStackAttribute are invalid, please check your setup"));
 		return;
 	}
-	
-	UGameplayEffect* GEStackChange = 
-	NewObject<UGameplayEffect>(GetTransientPackage(), FName(TEXT("StackChange")));
-	
-	GEStackChange->DurationPolicy = EGameplayEffectDurationType::Instant;
 
-	const int32 Index = GEStackChange->Modifiers.Num();
-	GEStackChange->Modifiers.SetNum(Index + 2);
-
-	FGameplayModifierInfo& MaxStackInfo = GEStackChange->Modifiers[Index];
-	MaxStackInfo.ModifierMagnitude = FScalableFloat(MaxNumberOfStacks.GetValue());
-	MaxStackInfo.ModifierOp = EGameplayModOp::Override;
+	UAbilitySystemComponent* ASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+	if (!ASC)
+	{
+		return;
+	}
 
-	FGameplayModifierInfo& CurrentStackInfo = GEStackChange->Modifiers[Index + 1];
-	CurrentStackInfo.ModifierMagnitude = FScalableFloat(MaxNumberOfStacks.GetValue());
-	CurrentStackInfo.ModifierOp = EGameplayModOp::Override;
+	const float StackCount = MaxNumberOfStacks.GetValue();
 
-	MaxStackInfo.Attribute = MaxStackAttribute;
-	CurrentStackInfo.Attribute = CurrentStackAttribute;
+	if (!ActorInfo->IsNetAuthority())
+	{
+		// Clients only need the charges locally until the server's replicated attributes arrive
+		if (UGASCourseAbilitySystemComponent* GASCourseASC = Cast<UGASCourseAbilitySystemComponent>(ASC))
+		{
+			GASCourseASC->SetAbilityStackCount(CurrentStackAttribute, MaxStackAttribute, StackCount);
+		}
+		return;
+	}
 
-	FGameplayEffectContext* ContextHandle = UAbilitySystemGlobals::Get().AllocGameplayEffectContext();
-	const FGameplayEffectSpecHandle StackEffectHandle = FGameplayEffectSpecHandle(new FGameplayEffectSpec(GEStackChange, FGameplayEffectContextHandle(ContextHandle), 1.0f));
-	
-	GetAbilitySystemComponentFromActorInfo()->ApplyGameplayEffectSpecToSelf(*StackEffectHandle.Data.Get());
+	// The effect reads the stack attributes from the ability in its context
+	FGameplayEffectSpec StackSpec(GetDefault<UGASC_AbilityStackInitEffect>(), MakeEffectContext(Spec.Handle, ActorInfo), 1.0f);
+	StackSpec.SetSetByCallerMagnitude(Data_AbilityStackCount, StackCount);
+	ASC->ApplyGameplayEffectSpecToSelf(StackSpec);
 }
-
-
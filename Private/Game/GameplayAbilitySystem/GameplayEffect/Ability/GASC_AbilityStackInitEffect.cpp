@@ -0,0 +1,38 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/GameplayAbilitySystem/GameplayEffect/Ability/GASC_AbilityStackInitEffect.h"
+#include "Game/GameplayAbilitySystem/GASCourseGameplayAbility.h"
+#include "Game/GameplayAbilitySystem/GASCourseNativeGameplayTags.h"
+
+void UGASC_AbilityStackInitExecution::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+	FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
+{
+	const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
+	const UGASCourseGameplayAbility* Ability = Cast<UGASCourseGameplayAbility>(Spec.GetContext().GetAbility());
+	if (!Ability)
+	{
+		return;
+	}
+
+	const float StackCount = Spec.GetSetByCallerMagnitude(Data_AbilityStackCount, true, 0.0f);
+
+	if (Ability->GetMaxStackAttribute().IsValid())
+	{
+		OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(Ability->GetMaxStackAttribute(), EGameplayModOp::Override, StackCount));
+	}
+	if (Ability->GetCurrentStackAttribute().IsValid())
+	{
+		OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(Ability->GetCurrentStackAttribute(), EGameplayModOp::Override, StackCount));
+	}
+}
+
+UGASC_AbilityStackInitEffect::UGASC_AbilityStackInitEffect(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FGameplayEffectExecutionDefinition ExecDef;
+	ExecDef.CalculationClass = UGASC_AbilityStackInitExecution::StaticClass();
+	Executions.Add(ExecDef);
+}
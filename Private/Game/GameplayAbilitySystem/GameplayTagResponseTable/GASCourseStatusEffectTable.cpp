@@ -3,6 +3,8 @@
 
 #include "Game/GameplayAbilitySystem/GameplayTagResponseTable/GASCourseStatusEffectTable.h"
 #include "AbilitySystemComponent.h"
+#include "GameplayTagsManager.h"
+#include "Game/GameplayAbilitySystem/GASCourseNativeGameplayTags.h"
 
 UGASCourseStatusEffectTable::UGASCourseStatusEffectTable(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -13,47 +15,126 @@ UGASCourseStatusEffectTable::UGASCourseStatusEffectTable(const FObjectInitialize
 void UGASCourseStatusEffectTable::PostLoad()
 {
 	Super::PostLoad();
+
+	CompileEntries();
+
+#if WITH_EDITOR
+	if (!ObjectsReplacedHandle.IsValid())
+	{
+		ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddUObject(this, &ThisClass::OnObjectsReplaced);
+	}
+#endif
 }
 
-void UGASCourseStatusEffectTable::ApplyGameplayStatusEffect(UAbilitySystemComponent* TargetASC,
-	UAbilitySystemComponent* InstigatorASC, const FGameplayTagContainer& StatusEffectTags)
+void UGASCourseStatusEffectTable::BeginDestroy()
 {
-	FGameplayTagEventResponseTableEntry FoundStatusEffectEntry;
-	FGameplayTag FoundStatusTag;
-	if(HasMatchingStatusEffectTag(StatusEffectTags, FoundStatusEffectEntry, FoundStatusTag))
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	ObjectsReplacedHandle.Reset();
+#endif
+
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UGASCourseStatusEffectTable::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileEntries();
+}
+
+void UGASCourseStatusEffectTable::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	for (const TMap<FGameplayTag, FResponseArray>& CompiledEntry : CompiledEntries)
 	{
-		for(FGameplayTagEventResponsePair StatusEffectPair : FoundStatusEffectEntry.StatusEffectTypes)
+		for (const TPair<FGameplayTag, FResponseArray>& Responses : CompiledEntry)
 		{
-			if(StatusEffectPair.StatusEffectStateTag == FoundStatusTag)
+			for (const FGASC_CompiledStatusEffectResponse& Response : Responses.Value)
 			{
-				FActiveGameplayEffectHandle StatusEffectHandle = InstigatorASC->ApplyGameplayEffectToTarget(StatusEffectPair.ResponseGameplayEffect.GetDefaultObject(), TargetASC);
+				if (ReplacementMap.Contains(Response.Effect))
+				{
+					CompileEntries();
+					return;
+				}
 			}
 		}
 	}
 }
+#endif
+
+void UGASCourseStatusEffectTable::ApplyGameplayStatusEffect(UAbilitySystemComponent* TargetASC,
+	UAbilitySystemComponent* InstigatorASC, const FGameplayTagContainer& StatusEffectTags)
+{
+	if (!TargetASC || !InstigatorASC)
+	{
+		return;
+	}
+
+	if (const FResponseArray* Responses = FindResponseEffects(StatusEffectTags))
+	{
+		for (const FGASC_CompiledStatusEffectResponse& Response : *Responses)
+		{
+			InstigatorASC->ApplyGameplayEffectToTarget(Response.Effect, TargetASC, Response.Level);
+		}
+	}
+}
 
-bool UGASCourseStatusEffectTable::HasMatchingStatusEffectTag(const FGameplayTagContainer& StatusEffectTags,
-	FGameplayTagEventResponseTableEntry& FoundStatusEffectEntry, FGameplayTag& FoundTag)
+const UGASCourseStatusEffectTable::FResponseArray* UGASCourseStatusEffectTable::FindResponseEffects(const FGameplayTagContainer& StatusEffectTags) const
 {
-	bool bHasFoundTag = false;
+	// One lookup per incoming tag; the incoming container usually holds just the entry tag and the status tag
+	int32 WinningEntry = INDEX_NONE;
+	FGameplayTag StatusTag;
+	for (const FGameplayTag& Tag : StatusEffectTags)
+	{
+		if (!StatusTag.IsValid() && Tag.MatchesTag(Effect_Gameplay_Status))
+		{
+			StatusTag = Tag;
+		}
+		if (const int32* EntryIndex = CompiledEntryByTag.Find(Tag))
+		{
+			WinningEntry = FMath::Max(WinningEntry, *EntryIndex);
+		}
+	}
 
-	for(FGameplayTagEventResponseTableEntry Entry :Entries)
+	if (WinningEntry == INDEX_NONE || !StatusTag.IsValid())
 	{
-		if(StatusEffectTags.HasTag(Entry.StatusEffectTag))
+		return nullptr;
+	}
+	return CompiledEntries[WinningEntry].Find(StatusTag);
+}
+
+void UGASCourseStatusEffectTable::CompileEntries()
+{
+	CompiledEntryByTag.Reset();
+	CompiledEntries.Reset();
+	CompiledEntries.SetNum(Entries.Num());
+
+	UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		const FGameplayTagEventResponseTableEntry& Entry = Entries[EntryIndex];
+		if (!Entry.StatusEffectTag.IsValid())
+		{
+			continue;
+		}
+
+		// Later entries overwrite earlier ones, so each tag resolves to the last entry it matches
+		CompiledEntryByTag.Add(Entry.StatusEffectTag, EntryIndex);
+		for (const FGameplayTag& ChildTag : TagsManager.RequestGameplayTagChildren(Entry.StatusEffectTag))
+		{
+			CompiledEntryByTag.Add(ChildTag, EntryIndex);
+		}
+
+		for (const FGameplayTagEventResponsePair& StatusEffectPair : Entry.StatusEffectTypes)
 		{
-			FoundStatusEffectEntry = Entry;
-			for(FGameplayTag StatusTag : StatusEffectTags.GetGameplayTagArray())
+			if (!StatusEffectPair.StatusEffectStateTag.IsValid() || !StatusEffectPair.ResponseGameplayEffect)
 			{
-				ensure(StatusTag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Effect.Gameplay.Status"))));
-				if(StatusTag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Effect.Gameplay.Status"))))
-				{
-					FoundTag = StatusTag;
-					bHasFoundTag = true;
-					break;
-				}
+				continue;
 			}
+
+			CompiledEntries[EntryIndex].FindOrAdd(StatusEffectPair.StatusEffectStateTag).Add(
+				{StatusEffectPair.ResponseGameplayEffect.GetDefaultObject(), UGameplayEffect::INVALID_LEVEL});
 		}
 	}
-
-	return bHasFoundTag;
 }
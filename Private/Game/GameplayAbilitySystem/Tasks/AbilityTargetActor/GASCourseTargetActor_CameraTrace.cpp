@@ -7,8 +7,8 @@
 #include "Abilities/GameplayAbility.h"
 #include "GASCourse/GASCourse.h"
 #include "Game/Character/Player/GASCoursePlayerController.h"
+#include "Game/Systems/Targeting/GASC_CursorQuerySubsystem.h"
 #include "Game/GameplayAbilitySystem/GameplayAbilities/Aimcast/GASCourseAimcastGameplayAbility.h"
-#include "Engine/OverlapResult.h"
 
 AGASCourseTargetActor_CameraTrace::AGASCourseTargetActor_CameraTrace(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
@@ -26,6 +26,13 @@ AGASCourseTargetActor_CameraTrace::AGASCourseTargetActor_CameraTrace(const FObje
 void AGASCourseTargetActor_CameraTrace::StartTargeting(UGameplayAbility* InAbility)
 {
 	Super::StartTargeting(InAbility);
+
+	OverlapObjectQueryParams = FCollisionObjectQueryParams();
+	for (const ECollisionChannel QueryChannel : QueryChannels)
+	{
+		OverlapObjectQueryParams.AddObjectTypesToQuery(QueryChannel);
+	}
+	LastOutlineQueryTime = -UE_BIG_NUMBER;
 }
 
 void AGASCourseTargetActor_CameraTrace::ConfirmTargetingAndContinue()
@@ -70,17 +77,53 @@ void AGASCourseTargetActor_CameraTrace::Tick(float DeltaSeconds)
 	Super::Tick(DeltaSeconds);
 	if (SourceActor && SourceActor->GetLocalRole() != ENetRole::ROLE_SimulatedProxy)
 	{
+		FVector RayStart;
+		FVector RayDirection;
+		if (!GetCursorRay(RayStart, RayDirection) || !ShouldRefreshTargetOutline(RayStart, RayDirection))
+		{
+			return;
+		}
+
+		LastOutlineRayStart = RayStart;
+		LastOutlineRayDirection = RayDirection;
+		LastOutlineQueryTime = GetWorld()->GetTimeSeconds();
+
 		const FHitResult HitResult = PerformTrace(SourceActor);
 		const FVector EndPoint = HitResult.Component.IsValid() ? HitResult.ImpactPoint : HitResult.TraceEnd;
 
 		if(TargetOutlineData.bEnableTargetingOutline)
 		{
-			DrawTargetOutline(ActorsToOutline, PerformOverlap(EndPoint));
-			ActorsToOutline = PerformOverlap(EndPoint);
+			constexpr bool bTraceComplex = false;
+			const FCollisionQueryParams Params(SCENE_QUERY_STAT(RadiusTargetingOverlap), bTraceComplex);
+			OverlapMultiByObjectTypes(EndPoint, FQuat::Identity, FCollisionShape::MakeSphere(CollisionRadius), Params);
+			DrawTargetOutline(OverlapActors);
 		}
 	}
 }
 
+UGASC_CursorQuerySubsystem* AGASCourseTargetActor_CameraTrace::GetCursorQuery() const
+{
+	const APlayerController* PC = OwningAbility ? OwningAbility->GetCurrentActorInfo()->PlayerController.Get() : nullptr;
+	return UGASC_CursorQuerySubsystem::Get(PC);
+}
+
+bool AGASCourseTargetActor_CameraTrace::GetCursorRay(FVector& OutRayStart, FVector& OutRayDirection) const
+{
+	UGASC_CursorQuerySubsystem* CursorQuery = GetCursorQuery();
+	return CursorQuery && CursorQuery->GetCursorRay(OutRayStart, OutRayDirection);
+}
+
+bool AGASCourseTargetActor_CameraTrace::ShouldRefreshTargetOutline(const FVector& RayStart, const FVector& RayDirection) const
+{
+	if (GetWorld()->GetTimeSeconds() - LastOutlineQueryTime >= MaxOutlineQueryInterval)
+	{
+		return true;
+	}
+
+	// The direction tolerance is small because MaxRange magnifies any angular change at the far end of the ray
+	return !RayStart.Equals(LastOutlineRayStart, CursorRayMoveThreshold) || !RayDirection.Equals(LastOutlineRayDirection, UE_KINDA_SMALL_NUMBER);
+}
+
 void AGASCourseTargetActor_CameraTrace::SendTargetDataBacktoServer(const FGameplayAbilityTargetDataHandle& InData,
 	FGameplayTag ApplicationTag)
 {
@@ -115,26 +158,43 @@ void AGASCourseTargetActor_CameraTrace::SendCancelledTargetDataBackToServer(
 
 FHitResult AGASCourseTargetActor_CameraTrace::PerformTrace(AActor* InSourceActor)
 {
-	
-	bool bTraceComplex = false;
-
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(AGASCourseTargetActor_CameraTrace), bTraceComplex);
-	Params.bReturnPhysicalMaterial = true;
-	Params.AddIgnoredActor(InSourceActor);
 	UWorld *ThisWorld = GetWorld();
 	FHitResult ReturnHitResult;
-	
-	AGASCoursePlayerController* PC = Cast<AGASCoursePlayerController>(OwningAbility->GetCurrentActorInfo()->PlayerController.Get());
-	check(PC);
+	bLastTraceWasGood = false;
 
-	
-	FVector TraceStart = PC->MousePositionDeprojectedToWorld;
-	FVector TraceEnd = TraceStart + PC->MouseDirectionDeprojectedToWorld * MaxRange;
-	
+	// No cursor ray (no local player controller, or the cursor is off the viewport): nothing valid to target
+	UGASC_CursorQuerySubsystem* CursorQuery = GetCursorQuery();
+	FVector TraceStart;
+	FVector TraceDirection;
+	if (!CursorQuery || !CursorQuery->GetCursorRay(TraceStart, TraceDirection))
+	{
+		if (AGameplayAbilityWorldReticle* LocalReticleActor = ReticleActor.Get())
+		{
+			LocalReticleActor->SetIsTargetValid(false);
+		}
+		return ReturnHitResult;
+	}
+	FVector TraceEnd = TraceStart + TraceDirection * MaxRange;
 
-	bLastTraceWasGood = false;
-	
-	LineTraceWithFilter(ReturnHitResult, InSourceActor->GetWorld(), Filter, TraceStart, TraceEnd, TraceChannel, Params);
+	ReturnHitResult.TraceStart = TraceStart;
+	ReturnHitResult.TraceEnd = TraceEnd;
+
+	// Same selection as LineTraceWithFilter, but over the cursor hits shared with every other consumer this frame
+	for (const FHitResult& Hit : CursorQuery->GetCursorHits(TraceChannel, MaxRange))
+	{
+		AActor* HitActor = Hit.HitObjectHandle.FetchActor();
+		if (HitActor == InSourceActor)
+		{
+			continue;
+		}
+
+		if (!Hit.HitObjectHandle.IsValid() || Filter.FilterPassesForActor(HitActor))
+		{
+			ReturnHitResult = Hit;
+			ReturnHitResult.bBlockingHit = true; // treat it as a blocking hit
+			break;
+		}
+	}
 	//TODO: Maybe try using AimWithPlayerController?
 	//AimWithPlayerController(InSourceActor, Params, TraceStart, TraceEnd);
 	//Default to end of trace line if we don't hit anything.
@@ -178,41 +238,40 @@ TArray<TWeakObjectPtr<AActor>> AGASCourseTargetActor_CameraTrace::PerformOverlap
 	Params.bReturnPhysicalMaterial = false;
 	
 	TArray<TWeakObjectPtr<AActor>>	HitActors;
-	if(QueryChannels.Num() == 0)
+	if (OverlapMultiByObjectTypes(Origin, FQuat::Identity, FCollisionShape::MakeSphere(CollisionRadius), Params))
 	{
-		return HitActors;
+		HitActors.Reserve(OverlapActors.Num());
+		for (AActor* HitActor : OverlapActors)
+		{
+			HitActors.Add(HitActor);
+		}
 	}
-	
-	OverlapMultiByObjectTypes(HitActors, Origin, FQuat::Identity, FCollisionShape::MakeSphere(CollisionRadius), Params);
 	return HitActors;
 }
 
-bool AGASCourseTargetActor_CameraTrace::OverlapMultiByObjectTypes(TArray<TWeakObjectPtr<AActor>>& OutHitActors, const FVector& Pos,
-                                                                  const FQuat& Rot, const FCollisionShape& OverlapCollisionShape, const FCollisionQueryParams& Params) const
+bool AGASCourseTargetActor_CameraTrace::OverlapMultiByObjectTypes(const FVector& Pos, const FQuat& Rot,
+	const FCollisionShape& OverlapCollisionShape, const FCollisionQueryParams& Params)
 {
-	TArray<FOverlapResult> Overlaps;
-	bool bTraceSuccessful = false;
+	OverlapActors.Reset();
+	OverlapResults.Reset();
 	
-	if(QueryChannels.Num() == 0)
+	if(!OverlapObjectQueryParams.IsValid() || !SourceActor)
 	{
-		return bTraceSuccessful;
+		return false;
 	}
-	
-	for(const ECollisionChannel QueryChannel : QueryChannels)
+
+	SourceActor->GetWorld()->OverlapMultiByObjectType(OverlapResults, Pos, Rot, OverlapObjectQueryParams, OverlapCollisionShape, Params);
+	for (const FOverlapResult& Overlap : OverlapResults)
 	{
-		SourceActor->GetWorld()->OverlapMultiByObjectType(Overlaps, Pos, Rot, FCollisionObjectQueryParams(QueryChannel), OverlapCollisionShape, Params);
-		for(int32 i = 0; i < Overlaps.Num(); ++i)
+		//Should this check to see if these pawns are in the AimTarget list?
+		AActor* HitActor = Overlap.OverlapObjectHandle.FetchActor<AActor>();
+		if (HitActor && !OverlapActors.Contains(HitActor) && Filter.FilterPassesForActor(HitActor))
 		{
-			//Should this check to see if these pawns are in the AimTarget list?
-			AActor* HitActor = Overlaps[i].OverlapObjectHandle.FetchActor<AActor>();
-			if (HitActor && !OutHitActors.Contains(HitActor) && Filter.FilterPassesForActor(HitActor))
-			{
-				OutHitActors.Add(HitActor);
-			}
+			OverlapActors.Add(HitActor);
 		}
 	}
 
-	return bTraceSuccessful = OutHitActors.Num() > 0 ? true : false;
+	return !OverlapActors.IsEmpty();
 }
 
 FGameplayAbilityTargetDataHandle AGASCourseTargetActor_CameraTrace::MakeTargetData(
@@ -227,66 +286,64 @@ FGameplayAbilityTargetDataHandle AGASCourseTargetActor_CameraTrace::MakeTargetDa
 	return FGameplayAbilityTargetDataHandle();
 }
 
-void AGASCourseTargetActor_CameraTrace::DrawTargetOutline(TArray<TWeakObjectPtr<AActor>> InHitActors,
-	TArray<TWeakObjectPtr<AActor>> InLatestHitActors)
+void AGASCourseTargetActor_CameraTrace::DrawTargetOutline(const TSet<AActor*>& LatestHitActors)
 {
 	if(TargetOutlineData.CharacterClassToOutline == nullptr)
 	{
 		return;
 	}
 
-	if(InHitActors.IsEmpty())
+	// Actors that left the overlap (or were destroyed) lose their outline
+	for (TSet<TWeakObjectPtr<AActor>>::TIterator It = OutlinedActors.CreateIterator(); It; ++It)
 	{
-		return;
-	}
-	
-	for(const TWeakObjectPtr<AActor>& Actor : InHitActors)
-	{
-		if (Actor.IsValid())
+		AActor* OutlinedActor = It->Get();
+		if (!OutlinedActor || !LatestHitActors.Contains(OutlinedActor))
 		{
-			if(Actor->IsA(TargetOutlineData.CharacterClassToOutline))
+			if (OutlinedActor)
 			{
-				const AGASCourseCharacter* Character = Cast<AGASCourseCharacter>(Actor);
-				if(USkeletalMeshComponent* Mesh = Character->GetComponentByClass<USkeletalMeshComponent>())
-				{
-					Mesh->SetRenderCustomDepth(false);
-					Mesh->SetCustomDepthStencilValue(STENCIL_NONE);
-				}
+				SetActorOutlined(*OutlinedActor, false);
 			}
+			It.RemoveCurrent();
 		}
 	}
-	
-	for(const TWeakObjectPtr<AActor>& Actor : InLatestHitActors)
+
+	// Only actors entering the overlap get their custom depth state written
+	for (AActor* Actor : LatestHitActors)
 	{
-		if(Actor->IsA(TargetOutlineData.CharacterClassToOutline))
+		if (!Actor->IsA(TargetOutlineData.CharacterClassToOutline))
 		{
-			const AGASCourseCharacter* Character = Cast<AGASCourseCharacter>(Actor);
-			if(USkeletalMeshComponent* Mesh = Character->GetComponentByClass<USkeletalMeshComponent>())
-			{
-				Mesh->SetRenderCustomDepth(true);
-				Mesh->SetCustomDepthStencilValue(STENCIL_ENEMY_OUTLINE);
-			}
+			continue;
+		}
+
+		bool bAlreadyOutlined = false;
+		OutlinedActors.Add(Actor, &bAlreadyOutlined);
+		if (!bAlreadyOutlined)
+		{
+			SetActorOutlined(*Actor, true);
 		}
 	}
 }
 
-void AGASCourseTargetActor_CameraTrace::ClearTargetOutline(TArray<TWeakObjectPtr<AActor>> InHitActors)
+void AGASCourseTargetActor_CameraTrace::ClearTargetOutline()
 {
-	if(TargetOutlineData.CharacterClassToOutline == nullptr)
-	{
-		return;
-	}
-	
-	for(const TWeakObjectPtr<AActor>& Actor : InHitActors)
+	for (const TWeakObjectPtr<AActor>& Actor : OutlinedActors)
 	{
-		if(Actor->IsA(TargetOutlineData.CharacterClassToOutline))
+		if (AActor* OutlinedActor = Actor.Get())
 		{
-			const AGASCourseCharacter* Character = Cast<AGASCourseCharacter>(Actor);
-			if(USkeletalMeshComponent* Mesh = Character->GetComponentByClass<USkeletalMeshComponent>())
-			{
-				Mesh->SetRenderCustomDepth(false);
-				Mesh->SetCustomDepthStencilValue(STENCIL_NONE);
-			}
+			SetActorOutlined(*OutlinedActor, false);
 		}
 	}
+	OutlinedActors.Reset();
+
+	// Targeting may continue after a confirm; make the next tick query again
+	LastOutlineQueryTime = -UE_BIG_NUMBER;
+}
+
+void AGASCourseTargetActor_CameraTrace::SetActorOutlined(AActor& Actor, bool bOutlined) const
+{
+	if(USkeletalMeshComponent* Mesh = Actor.GetComponentByClass<USkeletalMeshComponent>())
+	{
+		Mesh->SetRenderCustomDepth(bOutlined);
+		Mesh->SetCustomDepthStencilValue(bOutlined ? STENCIL_ENEMY_OUTLINE : STENCIL_NONE);
+	}
 }
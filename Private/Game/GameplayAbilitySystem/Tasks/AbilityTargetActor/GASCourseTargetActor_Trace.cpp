@@ -187,12 +187,12 @@ FGameplayAbilityTargetDataHandle AGASCourseTargetActor_Trace::MakeTargetData(con
 	return StartLocation.MakeTargetDataHandleFromHitResult(OwningAbility, HitResult);
 }
 
-void AGASCourseTargetActor_Trace::DrawTargetOutline(TArray<TWeakObjectPtr<AActor>> InHitActors, TArray<TWeakObjectPtr<AActor>> InLatestHitActors)
+void AGASCourseTargetActor_Trace::DrawTargetOutline(const TSet<AActor*>& LatestHitActors)
 {
 
 }
 
-void AGASCourseTargetActor_Trace::ClearTargetOutline(TArray<TWeakObjectPtr<AActor>> InHitActors)
+void AGASCourseTargetActor_Trace::ClearTargetOutline()
 {
 	
 }
@@ -246,7 +246,7 @@ void AGASCourseTargetActor_Trace::ConfirmTargetingAndContinue()
 	UpdateLooseGameplayTagsDuringTargeting(Status_Block_PointClickMovementInput, 0);
 	UpdateLooseGameplayTagsDuringTargeting(Status_Gameplay_Targeting, 0);
 	ShowMouseCursor(true);
-	ClearTargetOutline(ActorsToOutline);
+	ClearTargetOutline();
 	
 }
 
@@ -256,7 +256,7 @@ void AGASCourseTargetActor_Trace::CancelTargeting()
 	UpdateLooseGameplayTagsDuringTargeting(Status_Block_PointClickMovementInput, 0);
 	UpdateLooseGameplayTagsDuringTargeting(Status_Gameplay_Targeting, 0);
 	ShowMouseCursor(true);
-	ClearTargetOutline(ActorsToOutline);
+	ClearTargetOutline();
 }
 
 void AGASCourseTargetActor_Trace::ConfirmTargeting()
@@ -266,7 +266,7 @@ void AGASCourseTargetActor_Trace::ConfirmTargeting()
 	UpdateLooseGameplayTagsDuringTargeting(Status_Block_PointClickMovementInput, 0);
 	UpdateLooseGameplayTagsDuringTargeting(Status_Gameplay_Targeting, 0);
 	ShowMouseCursor(true);
-	ClearTargetOutline(ActorsToOutline);
+	ClearTargetOutline();
 }
 
 bool AGASCourseTargetActor_Trace::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
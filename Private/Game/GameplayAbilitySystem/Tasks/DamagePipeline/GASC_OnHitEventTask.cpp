@@ -96,8 +96,9 @@ void UGASC_OnHitEventTask::Activate()
 			LocalDelegate.BindUFunction(this, FName("HandleHitReceived"));
 		}
 
-		// Register into unified system
-		Pipeline->RegisterActorOnHit(this, HitEventToListenFor, LocalDelegate);
+		// Register into unified system, keyed on the target so we only see its own hits
+		Pipeline->RegisterActorOnHit(this, HitEventToListenFor, LocalDelegate, Target);
+		RegisteredTargetKey = FObjectKey(Target);
 	}
 
 	ReadyForActivation();
@@ -109,21 +110,13 @@ void UGASC_OnHitEventTask::Activate()
 
 void UGASC_OnHitEventTask::OnDestroy(bool AbilityEnded)
 {
-	if (UGASC_DamagePipelineSubsystem* Pipeline = GetWorld()->GetSubsystem<UGASC_DamagePipelineSubsystem>())
+	UGASC_DamagePipelineSubsystem* Pipeline = GetWorld() ? GetWorld()->GetSubsystem<UGASC_DamagePipelineSubsystem>() : nullptr;
+	if (Pipeline && RegisteredTargetKey != FObjectKey())
 	{
-		// Must rebuild the same delegate to unregister
-		FOnHitApplied_Event LocalDelegate;
-
-		if (HitEventToListenFor == EHitEventType::OnHitApplied)
-		{
-			LocalDelegate.BindUFunction(this, FName("HandleHitApplied"));
-		}
-		else
-		{
-			LocalDelegate.BindUFunction(this, FName("HandleHitReceived"));
-		}
-
-		Pipeline->UnRegisterActorOnHit(this, HitEventToListenFor, LocalDelegate);
+		// Unregister from the bucket we registered in, even if the target has been destroyed since
+		const FName CallbackName = HitEventToListenFor == EHitEventType::OnHitApplied ? FName("HandleHitApplied") : FName("HandleHitReceived");
+		Pipeline->UnRegisterActorOnHitForKey(this, HitEventToListenFor, CallbackName, RegisteredTargetKey);
+		RegisteredTargetKey = FObjectKey();
 	}
 
 	Super::OnDestroy(AbilityEnded);
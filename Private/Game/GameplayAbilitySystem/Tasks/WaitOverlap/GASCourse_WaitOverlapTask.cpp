@@ -2,8 +2,6 @@
 
 
 #include "Game/GameplayAbilitySystem/Tasks/WaitOverlap/GASCourse_WaitOverlapTask.h"
-#include "Game/Character/NPC/GASCourseNPC_Base.h"
-#include "Components/SphereComponent.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GASCourse_WaitOverlapTask)
 
@@ -13,32 +11,27 @@ UGASCourse_WaitOverlapTask::UGASCourse_WaitOverlapTask(const FObjectInitializer&
 	
 }
 
-void UGASCourse_WaitOverlapTask::OnComponentOverlapCallback(UPrimitiveComponent* OverlappedComponent,
-	AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
-	const FHitResult& SweepResult)
+void UGASCourse_WaitOverlapTask::OnOverlapWatchTriggered(const FGameplayAbilityTargetDataHandle& TargetData)
 {
-	if(OtherActor && !OverlappedActors.Contains(OtherActor))
+	if (ShouldBroadcastAbilityTaskDelegates())
 	{
-		// Construct TargetData
-		FGameplayAbilityTargetData_SingleTargetHit * TargetData = new FGameplayAbilityTargetData_SingleTargetHit(SweepResult);
-
-		// Give it a handle and return
-		FGameplayAbilityTargetDataHandle	Handle;
-		Handle.Data.Add(TSharedPtr<FGameplayAbilityTargetData>(TargetData));
-		if (ShouldBroadcastAbilityTaskDelegates())
-		{
-			OnOverlap.Broadcast(Handle);
-		}
-		OverlappedActors.Add(OtherActor);
+		OnOverlap.Broadcast(TargetData);
 	}
 }
 
 void UGASCourse_WaitOverlapTask::Activate()
 {
-	if (InitializeOverlapComponent())
+	AActor* AvatarActor = GetAvatarActor();
+	UGASC_OverlapWatchSubsystem* OverlapWatch = AvatarActor ? AvatarActor->GetWorld()->GetSubsystem<UGASC_OverlapWatchSubsystem>() : nullptr;
+	if (!OverlapWatch)
 	{
-		OverlapComponent->OnComponentBeginOverlap.AddDynamic(this, &UGASCourse_WaitOverlapTask::OnComponentOverlapCallback);
+		return;
 	}
+
+	// Actors already inside the sphere are reported from within this call, after the handle is set, so a callback
+	// that ends the ability still unregisters the watcher
+	OverlapWatch->RegisterWatcher(OverlapWatchHandle, AvatarActor, SphereRadius,
+		FGASC_OnOverlapWatchTriggered::CreateUObject(this, &ThisClass::OnOverlapWatchTriggered), bDebugDraw);
 }
 
 UGASCourse_WaitOverlapTask* UGASCourse_WaitOverlapTask::WaitForOverlap(UGameplayAbility* OwningAbility,
@@ -52,67 +45,10 @@ UGASCourse_WaitOverlapTask* UGASCourse_WaitOverlapTask::WaitForOverlap(UGameplay
 
 void UGASCourse_WaitOverlapTask::OnDestroy(bool AbilityEnded)
 {
-	if (OverlapComponent)
+	if (UGASC_OverlapWatchSubsystem* OverlapWatch = GetWorld() ? GetWorld()->GetSubsystem<UGASC_OverlapWatchSubsystem>() : nullptr)
 	{
-		OverlapComponent->OnComponentBeginOverlap.RemoveDynamic(this, &UGASCourse_WaitOverlapTask::OnComponentOverlapCallback);
-		OverlapComponent->DestroyComponent();
+		OverlapWatch->UnregisterWatcher(OverlapWatchHandle);
 	}
 
-	OverlappedActors.Empty();
 	Super::OnDestroy(AbilityEnded);
 }
-
-bool UGASCourse_WaitOverlapTask::InitializeOverlapComponent()
-{
-	if(const AActor* ActorOwner = GetAvatarActor())
-	{
-		OverlapComponent = NewObject<USphereComponent>(GetAvatarActor(), USphereComponent::StaticClass());
-		if(OverlapComponent)
-		{
-#if WITH_EDITOR
-			if(bDebugDraw)
-			{
-				OverlapComponent->SetHiddenInGame(false);
-			}
-#endif 			
-			OverlapComponent->SetSphereRadius(SphereRadius);
-			OverlapComponent->SetupAttachment(ActorOwner->GetRootComponent());
-			OverlapComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-			OverlapComponent->SetCollisionResponseToAllChannels(ECR_Ignore);
-			OverlapComponent->SetCollisionProfileName(TEXT("OverlapOnlyPawn"), true);
-			OverlapComponent->RegisterComponent();
-			OverlapComponent->UpdateOverlaps();
-
-			TArray<AActor*> InitialOverlappingActors;
-			OverlapComponent->GetOverlappingActors(InitialOverlappingActors);
-			
-			TArray<TWeakObjectPtr<AActor>> WeakActorArray;
-			WeakActorArray.Reserve(InitialOverlappingActors.Num());
-			for(AActor* Actor : InitialOverlappingActors)
-			{
-				if(Actor && Actor != GetAvatarActor())
-				{
-					WeakActorArray.Add(Actor);
-					OverlappedActors.Add(Actor);
-				}
-			}
-
-			if(!OverlappedActors.IsEmpty())
-			{
-				FGameplayAbilityTargetData_ActorArray* TargetData_Actors = new FGameplayAbilityTargetData_ActorArray();
-				TargetData_Actors->SetActors(WeakActorArray);
-			
-				// Give it a handle and return
-				FGameplayAbilityTargetDataHandle	Handle;
-				Handle.Data.Add(TSharedPtr<FGameplayAbilityTargetData>(TargetData_Actors));
-
-				if (ShouldBroadcastAbilityTaskDelegates())
-				{
-					OnOverlap.Broadcast(Handle);
-				}
-			}
-		}
-	}
-
-	return OverlapComponent ? true : false; 
-}
@@ -28,13 +28,10 @@ void UGASC_UI_DamageNumberPanel::NativeConstruct()
 	{
 		if (UGASC_DamagePipelineSubsystem* Subsys = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 		{
-			FOnDamageAppliedNative DamageDelegate;
-			DamageDelegate.BindUObject(this, &UGASC_UI_DamageNumberPanel::OnDamageApplied_Event);
-			Subsys->RegisterNativeDamageAppliedListener(this, MoveTemp(DamageDelegate));
-
-			FOnHealingReceivedNative HealingDelegate;
-			HealingDelegate.BindUObject(this, &UGASC_UI_DamageNumberPanel::OnHealingReceived_Event);
-			Subsys->RegisterNativeHealingReceivedListener(this, MoveTemp(HealingDelegate));
+			// One batch callback covers both damage applied and healing received
+			FOnDamageEventBatchNative BatchDelegate;
+			BatchDelegate.BindUObject(this, &UGASC_UI_DamageNumberPanel::OnDamageEventBatch);
+			Subsys->RegisterNativeDamageBatchListener(this, MoveTemp(BatchDelegate));
 		}
 	}
 
@@ -73,7 +70,7 @@ void UGASC_UI_DamageNumberPanel::NativeDestruct()
 	{
 		if (UGASC_DamagePipelineSubsystem* Subsys = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 		{
-			Subsys->UnregisterNativeDamageListener(this);
+			Subsys->UnregisterNativeDamageBatchListener(this);
 		}
 	}
 
@@ -227,48 +224,20 @@ void UGASC_UI_DamageNumberPanel::OnDamageNumberRemoved(UGASC_UI_DamageNumber* Da
  *  Damage Events
  * ============================ */
 
-void UGASC_UI_DamageNumberPanel::OnDamageApplied_Event(
-	const FDamageModificationContext& DamageContext)
+void UGASC_UI_DamageNumberPanel::OnDamageEventBatch(TArrayView<const FDamageModificationContext> Events)
 {
-	if (!DamageContext.HitContext.HitTarget.IsValid())
-		return;
-
-	const FDamageModificationContext Captured = DamageContext;
-
-	AsyncTask(ENamedThreads::GameThread, [this, Captured]()
+	for (const FDamageModificationContext& Context : Events)
 	{
-		if (!IsValid(this))
-			return;
-
-		AddHitDamageTextFromContext(Captured);
-
-		if (Captured.bCriticalModification)
-		{
-			AddCriticalHitDamageTextFromContext(Captured);
-		}
-	});
-}
-
-void UGASC_UI_DamageNumberPanel::OnHealingReceived_Event(
-	const FDamageModificationContext& HealingContext)
-{
-	if (!HealingContext.HitContext.HitTarget.IsValid())
-		return;
-
-	const FDamageModificationContext Captured = HealingContext;
-
-	AsyncTask(ENamedThreads::GameThread, [this, Captured]()
-	{
-		if (!IsValid(this))
-			return;
+		if (!Context.HitContext.HitTarget.IsValid())
+			continue;
 
-		AddHitDamageTextFromContext(Captured);
+		AddHitDamageTextFromContext(Context);
 
-		if (Captured.bCriticalModification)
+		if (Context.bCriticalModification)
 		{
-			AddCriticalHitDamageTextFromContext(Captured);
+			AddCriticalHitDamageTextFromContext(Context);
 		}
-	});
+	}
 }
 
 /* ============================
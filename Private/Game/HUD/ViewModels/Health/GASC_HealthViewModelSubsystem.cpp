@@ -0,0 +1,174 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/HUD/ViewModels/Health/GASC_HealthViewModelSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "Game/GameplayAbilitySystem/AttributeSets/GASCourseHealthAttributeSet.h"
+#include "Game/HUD/ViewModels/Health/GASC_UVM_Health.h"
+
+void UGASC_HealthViewModelSubsystem::Deinitialize()
+{
+	for (FGASC_HealthViewModelBinding& Binding : Bindings)
+	{
+		UnbindAbilitySystem(Binding);
+	}
+
+	Bindings.Empty();
+	FreeBindings.Empty();
+	BindingIndices.Empty();
+	DirtyBindings.Empty();
+
+	Super::Deinitialize();
+}
+
+void UGASC_HealthViewModelSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushDirtyViewModels();
+}
+
+bool UGASC_HealthViewModelSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && !DirtyBindings.IsEmpty();
+}
+
+UGASC_UVM_Health* UGASC_HealthViewModelSubsystem::AcquireHealthViewModel(AActor* Owner)
+{
+	if (!Owner)
+	{
+		return nullptr;
+	}
+
+	if (const int32* ExistingIndex = BindingIndices.Find(Owner))
+	{
+		return Bindings[*ExistingIndex].ViewModel;
+	}
+
+	const int32 BindingIndex = !FreeBindings.IsEmpty() ? FreeBindings.Pop(EAllowShrinking::No) : Bindings.AddDefaulted();
+	FGASC_HealthViewModelBinding& Binding = Bindings[BindingIndex];
+	if (!Binding.ViewModel)
+	{
+		Binding.ViewModel = NewObject<UGASC_UVM_Health>(this);
+	}
+	Binding.Owner = Owner;
+	Binding.bInUse = true;
+
+	BindingIndices.Add(Owner, BindingIndex);
+	return Binding.ViewModel;
+}
+
+void UGASC_HealthViewModelSubsystem::BindAbilitySystem(const AActor* Owner, UAbilitySystemComponent* AbilitySystem)
+{
+	const int32* BindingIndex = BindingIndices.Find(Owner);
+	if (!BindingIndex || !AbilitySystem)
+	{
+		return;
+	}
+
+	FGASC_HealthViewModelBinding& Binding = Bindings[*BindingIndex];
+	if (Binding.AbilitySystem.Get() == AbilitySystem)
+	{
+		return;
+	}
+
+	UnbindAbilitySystem(Binding);
+
+	Binding.AbilitySystem = AbilitySystem;
+	Binding.CurrentHealthChangedHandle = AbilitySystem->GetGameplayAttributeValueChangeDelegate(UGASCourseHealthAttributeSet::GetCurrentHealthAttribute())
+		.AddUObject(this, &ThisClass::OnHealthAttributeChanged, *BindingIndex);
+	Binding.MaxHealthChangedHandle = AbilitySystem->GetGameplayAttributeValueChangeDelegate(UGASCourseHealthAttributeSet::GetMaxHealthAttribute())
+		.AddUObject(this, &ThisClass::OnHealthAttributeChanged, *BindingIndex);
+
+	// The view model shows the right values as soon as it is bound, not after the next change
+	PushHealthValues(Binding);
+}
+
+void UGASC_HealthViewModelSubsystem::ReleaseHealthViewModel(const AActor* Owner)
+{
+	int32 BindingIndex = INDEX_NONE;
+	if (!BindingIndices.RemoveAndCopyValue(Owner, BindingIndex))
+	{
+		return;
+	}
+
+	FGASC_HealthViewModelBinding& Binding = Bindings[BindingIndex];
+	UnbindAbilitySystem(Binding);
+
+	if (UGASC_UVM_Health* ViewModel = Binding.ViewModel)
+	{
+		ViewModel->SetMaxHealth(0.0f);
+		ViewModel->SetCurrentHealth(0.0f);
+		ViewModel->SetDelayedCurrentHealth(0.0f);
+	}
+
+	Binding.Owner.Reset();
+	Binding.bInUse = false;
+	FreeBindings.Add(BindingIndex);
+}
+
+UGASC_UVM_Health* UGASC_HealthViewModelSubsystem::FindHealthViewModel(const AActor* Owner) const
+{
+	const int32* BindingIndex = BindingIndices.Find(Owner);
+	return BindingIndex ? Bindings[*BindingIndex].ViewModel : nullptr;
+}
+
+void UGASC_HealthViewModelSubsystem::FlushDirtyViewModels()
+{
+	if (DirtyBindings.IsEmpty())
+	{
+		return;
+	}
+
+	for (const int32 BindingIndex : DirtyBindings)
+	{
+		FGASC_HealthViewModelBinding& Binding = Bindings[BindingIndex];
+		if (Binding.bDirty)
+		{
+			PushHealthValues(Binding);
+		}
+	}
+
+	DirtyBindings.Reset();
+}
+
+void UGASC_HealthViewModelSubsystem::UnbindAbilitySystem(FGASC_HealthViewModelBinding& Binding)
+{
+	if (UAbilitySystemComponent* AbilitySystem = Binding.AbilitySystem.Get())
+	{
+		AbilitySystem->GetGameplayAttributeValueChangeDelegate(UGASCourseHealthAttributeSet::GetCurrentHealthAttribute()).Remove(Binding.CurrentHealthChangedHandle);
+		AbilitySystem->GetGameplayAttributeValueChangeDelegate(UGASCourseHealthAttributeSet::GetMaxHealthAttribute()).Remove(Binding.MaxHealthChangedHandle);
+	}
+
+	Binding.AbilitySystem.Reset();
+	Binding.CurrentHealthChangedHandle.Reset();
+	Binding.MaxHealthChangedHandle.Reset();
+	// A stale entry in DirtyBindings is skipped by the flush
+	Binding.bDirty = false;
+}
+
+void UGASC_HealthViewModelSubsystem::OnHealthAttributeChanged(const FOnAttributeChangeData& ChangeData, int32 BindingIndex)
+{
+	FGASC_HealthViewModelBinding& Binding = Bindings[BindingIndex];
+	if (!Binding.bDirty)
+	{
+		Binding.bDirty = true;
+		DirtyBindings.Add(BindingIndex);
+	}
+}
+
+void UGASC_HealthViewModelSubsystem::PushHealthValues(FGASC_HealthViewModelBinding& Binding)
+{
+	Binding.bDirty = false;
+
+	const UAbilitySystemComponent* AbilitySystem = Binding.AbilitySystem.Get();
+	UGASC_UVM_Health* ViewModel = Binding.ViewModel;
+	if (!AbilitySystem || !ViewModel)
+	{
+		return;
+	}
+
+	// Max first, so the percentage fields are never broadcast against a stale maximum
+	ViewModel->SetMaxHealth(AbilitySystem->GetNumericAttribute(UGASCourseHealthAttributeSet::GetMaxHealthAttribute()));
+	ViewModel->SetCurrentHealth(AbilitySystem->GetNumericAttribute(UGASCourseHealthAttributeSet::GetCurrentHealthAttribute()));
+}
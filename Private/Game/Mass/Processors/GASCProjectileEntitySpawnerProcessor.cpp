@@ -2,3 +2,123 @@
 
 
 #include "Game/Mass/Processors/GASCProjectileEntitySpawnerProcessor.h"
+#include "MassCommandBuffer.h"
+#include "MassEntityManager.h"
+#include "MassExecutionContext.h"
+#include "Game/Mass/Fragments/GASCProjectileFragments.h"
+
+namespace GASCProjectileEntitySpawner
+{
+	FGASCProjectileParamsFragment MakeParamsFragment(const FGASCProjectileEntitySpawnParams& SpawnParams)
+	{
+		FGASCProjectileParamsFragment Params;
+		Params.CollisionRadius = SpawnParams.CollisionRadius;
+		Params.CollisionProfileName = SpawnParams.CollisionProfileName;
+		Params.Damage = SpawnParams.Damage;
+		Params.DamageType = SpawnParams.DamageType;
+		Params.bCanDamageAllies = SpawnParams.bCanDamageAllies;
+		return Params;
+	}
+
+	bool ParamsMatch(const FGASCProjectileParamsFragment& A, const FGASCProjectileParamsFragment& B)
+	{
+		return A.CollisionRadius == B.CollisionRadius
+			&& A.CollisionProfileName == B.CollisionProfileName
+			&& A.Damage == B.Damage
+			&& A.DamageType == B.DamageType
+			&& A.bCanDamageAllies == B.bCanDamageAllies;
+	}
+}
+
+UGASCProjectileEntitySpawnerProcessor::UGASCProjectileEntitySpawnerProcessor()
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionOrder.ExecuteInGroup = FName(TEXT("GASCProjectiles"));
+	bAutoRegisterWithProcessingPhases = true;
+	// Reads a world subsystem queue filled from gameplay code
+	bRequiresGameThreadExecution = true;
+}
+
+void UGASCProjectileEntitySpawnerProcessor::ConfigureQueries()
+{
+	// Creates entities only; nothing to iterate
+}
+
+void UGASCProjectileEntitySpawnerProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UWorld* World = EntityManager.GetWorld();
+	UGASCProjectileEntitySubsystem* ProjectileSubsystem = World ? World->GetSubsystem<UGASCProjectileEntitySubsystem>() : nullptr;
+	if (!ProjectileSubsystem || !ProjectileSubsystem->HasPendingSpawns())
+	{
+		return;
+	}
+
+	ProjectileSubsystem->ConsumePendingSpawns(SpawnScratch);
+
+	// Entities can't be created mid-processing; defer the batch to the next command flush.
+	// The scratch buffer moves into the command and is handed back afterwards, so its allocation is reused.
+	Context.Defer().PushCommand<FMassDeferredCreateCommand>([this, SpawnParams = MoveTemp(SpawnScratch)](FMassEntityManager& Manager) mutable
+	{
+		CreateProjectileEntities(Manager, SpawnParams);
+		SpawnParams.Reset();
+		Swap(SpawnScratch, SpawnParams);
+	});
+}
+
+void UGASCProjectileEntitySpawnerProcessor::CreateProjectileEntities(FMassEntityManager& EntityManager, const TArray<FGASCProjectileEntitySpawnParams>& SpawnParams)
+{
+	using namespace GASCProjectileEntitySpawner;
+
+	if (!ProjectileArchetype.IsValid())
+	{
+		ProjectileArchetype = EntityManager.CreateArchetype({
+			FGASCProjectileTag::StaticStruct(),
+			FGASCProjectileLocationFragment::StaticStruct(),
+			FGASCProjectileVelocityFragment::StaticStruct(),
+			FGASCProjectileLifetimeFragment::StaticStruct(),
+			FGASCProjectileInstigatorFragment::StaticStruct(),
+			FGASCProjectileParamsFragment::StaticStruct()
+		});
+	}
+
+	// Volleys usually share one parameter set, so a linear scan over the groups is enough
+	TArray<FGASCProjectileParamsFragment, TInlineAllocator<4>> GroupParams;
+	TArray<TArray<int32>, TInlineAllocator<4>> GroupMembers;
+	for (int32 SpawnIndex = 0; SpawnIndex < SpawnParams.Num(); ++SpawnIndex)
+	{
+		const FGASCProjectileParamsFragment Params = MakeParamsFragment(SpawnParams[SpawnIndex]);
+		int32 GroupIndex = GroupParams.IndexOfByPredicate([&Params](const FGASCProjectileParamsFragment& Other)
+		{
+			return ParamsMatch(Params, Other);
+		});
+		if (GroupIndex == INDEX_NONE)
+		{
+			GroupIndex = GroupParams.Add(Params);
+			GroupMembers.AddDefaulted();
+		}
+		GroupMembers[GroupIndex].Add(SpawnIndex);
+	}
+
+	TArray<FMassEntityHandle> Entities;
+	for (int32 GroupIndex = 0; GroupIndex < GroupParams.Num(); ++GroupIndex)
+	{
+		FMassArchetypeSharedFragmentValues SharedValues;
+		SharedValues.AddConstSharedFragment(EntityManager.GetOrCreateConstSharedFragment(GroupParams[GroupIndex]));
+		SharedValues.Sort();
+
+		const TArray<int32>& Members = GroupMembers[GroupIndex];
+		Entities.Reset();
+		EntityManager.BatchCreateEntities(ProjectileArchetype, SharedValues, Members.Num(), Entities);
+
+		for (int32 MemberIndex = 0; MemberIndex < Members.Num(); ++MemberIndex)
+		{
+			const FGASCProjectileEntitySpawnParams& Spawn = SpawnParams[Members[MemberIndex]];
+			const FMassEntityHandle Entity = Entities[MemberIndex];
+			EntityManager.GetFragmentDataChecked<FGASCProjectileLocationFragment>(Entity).Location = Spawn.Location;
+			EntityManager.GetFragmentDataChecked<FGASCProjectileVelocityFragment>(Entity).Velocity = Spawn.Velocity;
+			EntityManager.GetFragmentDataChecked<FGASCProjectileLifetimeFragment>(Entity).RemainingLifetime = Spawn.Lifetime;
+			EntityManager.GetFragmentDataChecked<FGASCProjectileInstigatorFragment>(Entity).Instigator = Spawn.Instigator;
+		}
+	}
+}
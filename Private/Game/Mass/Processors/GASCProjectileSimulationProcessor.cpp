@@ -0,0 +1,139 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Mass/Processors/GASCProjectileSimulationProcessor.h"
+#include "MassCommandBuffer.h"
+#include "MassExecutionContext.h"
+#include "Engine/World.h"
+#include "GASCourse/GASCourseCharacter.h"
+#include "Game/Mass/Fragments/GASCProjectileFragments.h"
+#include "Game/Mass/Processors/GASCProjectileEntitySpawnerProcessor.h"
+#include "Game/Systems/Damage/Pipeline/GASC_DamagePipelineSubsystem.h"
+
+UGASCProjectileSimulationProcessor::UGASCProjectileSimulationProcessor()
+	: ProjectileQuery(*this)
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionOrder.ExecuteInGroup = FName(TEXT("GASCProjectiles"));
+	ExecutionOrder.ExecuteAfter.Add(UGASCProjectileEntitySpawnerProcessor::StaticClass()->GetFName());
+	bAutoRegisterWithProcessingPhases = true;
+	// Scene queries plus damage application through gameplay abilities
+	bRequiresGameThreadExecution = true;
+}
+
+void UGASCProjectileSimulationProcessor::ConfigureQueries()
+{
+	ProjectileQuery.AddRequirement<FGASCProjectileLocationFragment>(EMassFragmentAccess::ReadWrite);
+	ProjectileQuery.AddRequirement<FGASCProjectileVelocityFragment>(EMassFragmentAccess::ReadOnly);
+	ProjectileQuery.AddRequirement<FGASCProjectileLifetimeFragment>(EMassFragmentAccess::ReadWrite);
+	ProjectileQuery.AddRequirement<FGASCProjectileInstigatorFragment>(EMassFragmentAccess::ReadOnly);
+	ProjectileQuery.AddConstSharedRequirement<FGASCProjectileParamsFragment>();
+	ProjectileQuery.AddTagRequirement<FGASCProjectileTag>(EMassFragmentPresence::All);
+}
+
+void UGASCProjectileSimulationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	UWorld* World = EntityManager.GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	ImpactScratch.Reset();
+	const float DeltaTime = Context.GetDeltaTimeSeconds();
+
+	ProjectileQuery.ForEachEntityChunk(EntityManager, Context, [this, World, DeltaTime](FMassExecutionContext& ChunkContext)
+	{
+		const FGASCProjectileParamsFragment& Params = ChunkContext.GetConstSharedFragment<FGASCProjectileParamsFragment>();
+		const TArrayView<FGASCProjectileLocationFragment> Locations = ChunkContext.GetMutableFragmentView<FGASCProjectileLocationFragment>();
+		const TConstArrayView<FGASCProjectileVelocityFragment> Velocities = ChunkContext.GetFragmentView<FGASCProjectileVelocityFragment>();
+		const TArrayView<FGASCProjectileLifetimeFragment> Lifetimes = ChunkContext.GetMutableFragmentView<FGASCProjectileLifetimeFragment>();
+		const TConstArrayView<FGASCProjectileInstigatorFragment> Instigators = ChunkContext.GetFragmentView<FGASCProjectileInstigatorFragment>();
+
+		// Every entity in the chunk shares the same shape and profile
+		const FCollisionShape Shape = FCollisionShape::MakeSphere(Params.CollisionRadius);
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GASCProjectileEntitySweep), false);
+
+		const int32 NumEntities = ChunkContext.GetNumEntities();
+		for (int32 EntityIndex = 0; EntityIndex < NumEntities; ++EntityIndex)
+		{
+			float& RemainingLifetime = Lifetimes[EntityIndex].RemainingLifetime;
+			RemainingLifetime -= DeltaTime;
+			if (RemainingLifetime <= 0.0f)
+			{
+				ChunkContext.Defer().DestroyEntity(ChunkContext.GetEntity(EntityIndex));
+				continue;
+			}
+
+			FVector& Location = Locations[EntityIndex].Location;
+			const FVector End = Location + Velocities[EntityIndex].Velocity * DeltaTime;
+
+			QueryParams.ClearIgnoredActors();
+			if (AActor* Instigator = Instigators[EntityIndex].Instigator.Get())
+			{
+				QueryParams.AddIgnoredActor(Instigator);
+			}
+
+			FHitResult Hit;
+			if (World->SweepSingleByProfile(Hit, Location, End, FQuat::Identity, Params.CollisionProfileName, Shape, QueryParams))
+			{
+				FProjectileImpact& Impact = ImpactScratch.AddDefaulted_GetRef();
+				Impact.Target = Hit.GetActor();
+				Impact.Instigator = Instigators[EntityIndex].Instigator;
+				Impact.Damage = Params.Damage;
+				Impact.DamageType = Params.DamageType;
+				Impact.bCanDamageAllies = Params.bCanDamageAllies;
+				Impact.HitResult = MoveTemp(Hit);
+
+				ChunkContext.Defer().DestroyEntity(ChunkContext.GetEntity(EntityIndex));
+				continue;
+			}
+
+			Location = End;
+		}
+	});
+
+	// Applied outside the chunk loop: damage can run gameplay code that queues further projectiles
+	ApplyImpacts(World);
+}
+
+void UGASCProjectileSimulationProcessor::ApplyImpacts(UWorld* World)
+{
+	if (ImpactScratch.IsEmpty())
+	{
+		return;
+	}
+
+	UGASC_DamagePipelineSubsystem* DamagePipelineSubsystem = World->GetSubsystem<UGASC_DamagePipelineSubsystem>();
+	if (!DamagePipelineSubsystem)
+	{
+		ImpactScratch.Reset();
+		return;
+	}
+
+	for (const FProjectileImpact& Impact : ImpactScratch)
+	{
+		if (!Impact.Target.IsValid() || Impact.Damage <= 0.0f)
+		{
+			continue;
+		}
+
+		if (!Impact.bCanDamageAllies)
+		{
+			const AGASCourseCharacter* InstigatorCharacter = Cast<AGASCourseCharacter>(Impact.Instigator.Get());
+			const AGASCourseCharacter* TargetCharacter = Cast<AGASCourseCharacter>(Impact.Target.Get());
+			if (InstigatorCharacter && TargetCharacter && InstigatorCharacter->GetGenericTeamId() == TargetCharacter->GetGenericTeamId())
+			{
+				continue;
+			}
+		}
+
+		FDamagePipelineContext DamageContext;
+		DamageContext.HitResult = Impact.HitResult;
+		DamageContext.DamageType = Impact.DamageType;
+		DamagePipelineSubsystem->ApplyDamageToTarget(Impact.Target, Impact.Instigator, Impact.Damage, DamageContext);
+	}
+
+	ImpactScratch.Reset();
+}
@@ -0,0 +1,25 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Mass/Subsystems/GASCProjectileEntitySubsystem.h"
+
+void UGASCProjectileEntitySubsystem::SpawnProjectileEntity(const FGASCProjectileEntitySpawnParams& SpawnParams)
+{
+	PendingSpawns.Add(SpawnParams);
+}
+
+void UGASCProjectileEntitySubsystem::SpawnProjectileEntities(const TArray<FGASCProjectileEntitySpawnParams>& SpawnParams)
+{
+	PendingSpawns.Append(SpawnParams);
+}
+
+void UGASCProjectileEntitySubsystem::ConsumePendingSpawns(TArray<FGASCProjectileEntitySpawnParams>& OutSpawnParams)
+{
+	OutSpawnParams.Reset();
+	Swap(OutSpawnParams, PendingSpawns);
+}
+
+bool UGASCProjectileEntitySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -3,7 +3,6 @@
 
 #include "Game/Systems/CardEnergy/ActiveCardEnergy/GASC_ActiveCardResourceManager.h"
 #include "AbilitySystemGlobals.h"
-#include "AbilitySystemBlueprintLibrary.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
 #include "Game/Character/Player/GASCoursePlayerCharacter.h"
@@ -26,6 +25,9 @@ void UGASC_ActiveCardResourceManager::Initialize(FSubsystemCollectionBase& Colle
 		UE_LOG(LOG_GASC_ActiveCardResourceSubsystem, Warning, TEXT("ActiveCardResourceSettings not found!"));
 	}
 
+	const int32 HistoryCapacity = ActiveCardResourceSettings ? FMath::Max(ActiveCardResourceSettings->ActiveCardEnergyXPHistoryCapacity, 1) : 256;
+	ActiveCardEnergyXPHistory.SetNum(HistoryCapacity);
+
 	FSoftObjectPath AssetPath;
 	const TSoftObjectPtr<UActiveCardResourceEventMappingData>& SoftPtr = ActiveCardResourceSettings->ActiveCardResourceEventMappingData;
 	if (!SoftPtr.IsValid())
@@ -52,6 +54,7 @@ void UGASC_ActiveCardResourceManager::Deinitialize()
 	{
 		ActiveCardResourceSettings = nullptr;
 	}
+	ActiveCardEnergyXPEffect = nullptr;
 }
 
 bool UGASC_ActiveCardResourceManager::RegisterPlayer(APlayerController* InLocalPlayer)
@@ -79,7 +82,8 @@ bool UGASC_ActiveCardResourceManager::UnRegisterPlayer(APlayerController* InLoca
 		RegisteredLocalPlayerController = nullptr;
 		RegisteredLocalPlayerASC = nullptr;
 		MyHandle.Reset();
-		ActiveCardEnergyXPHistory.Empty();
+		ActiveCardEnergyXPHistoryHead = 0;
+		ActiveCardEnergyXPHistoryCount = 0;
 		return true;
 	}
 	return false;
@@ -94,7 +98,7 @@ void UGASC_ActiveCardResourceManager::GameplayEventCallback(FGameplayTag Matchin
 		if (bMappingFound)
 		{
 			UE_LOG(LOG_GASC_ActiveCardResourceSubsystem, Log, TEXT("Event Tag: %s | Instigator: %s | Target: %s | Mapping Value = %f"),
-				*MatchingTag.ToString(), *Payload->Instigator.GetFullName(), *Payload->Target.GetFullName(), MappingValue);
+				*MatchingTag.ToString(), *GetNameSafe(Payload->Instigator), *GetNameSafe(Payload->Target), MappingValue);
 			
 			const AActor* ConstActor = Payload->Instigator.Get();
 			AActor* Actor = const_cast<AActor*>(ConstActor);
@@ -117,31 +121,22 @@ void UGASC_ActiveCardResourceManager::GameplayEventCallback(FGameplayTag Matchin
 						}
 					}
 
-					FActiveCardEnergyXPHistoryEntry NewEntry;
+					FActiveCardEnergyXPHistoryEntry& NewEntry = AddActiveCardEnergyXPHistoryEntry();
 					NewEntry.ActiveCardEnergyXPEventTag = MatchingTag;
 					NewEntry.ActiveCardEnergyXPBaseValue = MappingValue;
-					NewEntry.InstigatorName = Target->GetFullName();
-					ActiveCardEnergyXPHistory.Add(NewEntry);
+					NewEntry.InstigatorName = Target ? Target->GetFName() : NAME_None;
 
-					UGASCourseGameplayEffect* IncomingActiveCardEnergyXPEffect = NewObject<UGASCourseGameplayEffect>(GetTransientPackage());
-					IncomingActiveCardEnergyXPEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
-					if(IncomingActiveCardEnergyXPEffect)
+					if (UGASCourseGameplayEffect* IncomingActiveCardEnergyXPEffect = GetOrCreateActiveCardEnergyXPEffect(IncomingActiveCardEnergyXPCalculationClass))
 					{
-						FGameplayEffectExecutionDefinition ActiveCardEnergyXPExecutionDefinition;
-						ActiveCardEnergyXPExecutionDefinition.CalculationClass = IncomingActiveCardEnergyXPCalculationClass;
-						if(ActiveCardEnergyXPExecutionDefinition.CalculationClass)
-						{
-							FGameplayTagContainer DynamicGrantedTags;
-							DynamicGrantedTags.AddTag(Data_ActiveCardEnergyXP);
-							DynamicGrantedTags.AddTag(MatchingTag);
-							IncomingActiveCardEnergyXPEffect->Executions.Emplace(ActiveCardEnergyXPExecutionDefinition);
-							FGameplayEffectContext* ContextHandle = UAbilitySystemGlobals::Get().AllocGameplayEffectContext();
-							ContextHandle->AddInstigator(SourceActor, SourceActor);
-							const FGameplayEffectSpecHandle IncomingActiveCardEnergyXPEffectHandle = FGameplayEffectSpecHandle(new FGameplayEffectSpec(IncomingActiveCardEnergyXPEffect, FGameplayEffectContextHandle(ContextHandle), 1.0f));
-							UAbilitySystemBlueprintLibrary::AssignTagSetByCallerMagnitude(IncomingActiveCardEnergyXPEffectHandle, Data_IncomingCardEnergyXP, MappingValue);
-							UAbilitySystemBlueprintLibrary::AddGrantedTags(IncomingActiveCardEnergyXPEffectHandle, DynamicGrantedTags);
-							SourceASC->ApplyGameplayEffectSpecToTarget(*IncomingActiveCardEnergyXPEffectHandle.Data.Get(), SourceASC);
-						}
+						FGameplayEffectContext* ContextHandle = UAbilitySystemGlobals::Get().AllocGameplayEffectContext();
+						ContextHandle->AddInstigator(SourceActor, SourceActor);
+
+						// Per-event data rides on the spec; the effect itself is shared
+						FGameplayEffectSpec IncomingActiveCardEnergyXPSpec(IncomingActiveCardEnergyXPEffect, FGameplayEffectContextHandle(ContextHandle), 1.0f);
+						IncomingActiveCardEnergyXPSpec.SetSetByCallerMagnitude(Data_IncomingCardEnergyXP, MappingValue);
+						IncomingActiveCardEnergyXPSpec.DynamicGrantedTags.AddTag(Data_ActiveCardEnergyXP);
+						IncomingActiveCardEnergyXPSpec.DynamicGrantedTags.AddTag(MatchingTag);
+						SourceASC->ApplyGameplayEffectSpecToTarget(IncomingActiveCardEnergyXPSpec, SourceASC);
 					}
 				}
 			}
@@ -149,6 +144,62 @@ void UGASC_ActiveCardResourceManager::GameplayEventCallback(FGameplayTag Matchin
 	}
 }
 
+const FActiveCardEnergyXPHistoryEntry& UGASC_ActiveCardResourceManager::GetActiveCardEnergyXPHistoryEntry(int32 Index) const
+{
+	check(Index >= 0 && Index < ActiveCardEnergyXPHistoryCount);
+	const int32 Capacity = ActiveCardEnergyXPHistory.Num();
+	const int32 Oldest = (ActiveCardEnergyXPHistoryHead - ActiveCardEnergyXPHistoryCount + Capacity) % Capacity;
+	return ActiveCardEnergyXPHistory[(Oldest + Index) % Capacity];
+}
+
+FActiveCardEnergyXPHistoryEntry* UGASC_ActiveCardResourceManager::GetLatestActiveCardEnergyXPHistoryEntry()
+{
+	if (ActiveCardEnergyXPHistoryCount == 0)
+	{
+		return nullptr;
+	}
+	const int32 Capacity = ActiveCardEnergyXPHistory.Num();
+	return &ActiveCardEnergyXPHistory[(ActiveCardEnergyXPHistoryHead - 1 + Capacity) % Capacity];
+}
+
+FActiveCardEnergyXPHistoryEntry& UGASC_ActiveCardResourceManager::AddActiveCardEnergyXPHistoryEntry()
+{
+	if (ActiveCardEnergyXPHistory.IsEmpty())
+	{
+		ActiveCardEnergyXPHistory.SetNum(1);
+	}
+
+	const int32 Capacity = ActiveCardEnergyXPHistory.Num();
+	FActiveCardEnergyXPHistoryEntry& Entry = ActiveCardEnergyXPHistory[ActiveCardEnergyXPHistoryHead];
+	Entry = FActiveCardEnergyXPHistoryEntry();
+
+	ActiveCardEnergyXPHistoryHead = (ActiveCardEnergyXPHistoryHead + 1) % Capacity;
+	ActiveCardEnergyXPHistoryCount = FMath::Min(ActiveCardEnergyXPHistoryCount + 1, Capacity);
+	return Entry;
+}
+
+UGASCourseGameplayEffect* UGASC_ActiveCardResourceManager::GetOrCreateActiveCardEnergyXPEffect(TSubclassOf<UGameplayEffectExecutionCalculation> CalculationClass)
+{
+	if (!CalculationClass)
+	{
+		return nullptr;
+	}
+
+	// Rebuilt only if the configured execution changes
+	if (ActiveCardEnergyXPEffect && ActiveCardEnergyXPEffect->Executions.Num() == 1 && ActiveCardEnergyXPEffect->Executions[0].CalculationClass == CalculationClass)
+	{
+		return ActiveCardEnergyXPEffect;
+	}
+
+	ActiveCardEnergyXPEffect = NewObject<UGASCourseGameplayEffect>(this, TEXT("ActiveCardEnergyXPEffect"));
+	ActiveCardEnergyXPEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FGameplayEffectExecutionDefinition ActiveCardEnergyXPExecutionDefinition;
+	ActiveCardEnergyXPExecutionDefinition.CalculationClass = CalculationClass;
+	ActiveCardEnergyXPEffect->Executions.Emplace(ActiveCardEnergyXPExecutionDefinition);
+	return ActiveCardEnergyXPEffect;
+}
+
 void UGASC_ActiveCardResourceManager::LoadActiveCardResourceMapping()
 {
 	const TSoftObjectPtr<UActiveCardResourceEventMappingData>& SoftPtr = ActiveCardResourceSettings->ActiveCardResourceEventMappingData;
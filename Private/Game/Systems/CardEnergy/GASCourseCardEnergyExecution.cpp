@@ -73,26 +73,21 @@ namespace
 			return;
 		}
 
-		TArray<FActiveCardEnergyXPHistoryEntry>& HistoryArray = ResourceManager->GetActiveCardEnergyHistory();
-		const int32 Count = HistoryArray.Num();
-		if (Count <= 0)
+		FActiveCardEnergyXPHistoryEntry* LastEntry = ResourceManager->GetLatestActiveCardEnergyXPHistoryEntry();
+		if (!LastEntry)
 		{
 			return;
 		}
 
-		const int32 LastIndex = Count - 1;
-		FActiveCardEnergyXPHistoryEntry& LastEntry = HistoryArray[LastIndex];
-		LastEntry.ActiveCardEnergyXPModifiedValue = InEnergyToAdd;
-		
-		FString ModificationToolTip = "";
+		LastEntry->ActiveCardEnergyXPModifiedValue = InEnergyToAdd;
+		LastEntry->Modifiers.Reset();
 		for (const TPair<FGameplayAttribute, float>& Attribute : Attributes)
 		{
 			if (Attribute.Value != 1.0f && Attribute.Key != nullptr)
 			{
-				ModificationToolTip.Append(LINE_TERMINATOR).Appendf(TEXT("Attribute: %s -> %f"), *Attribute.Key.AttributeName, Attribute.Value);
+				LastEntry->Modifiers.Emplace(Attribute.Key, Attribute.Value);
 			}
 		}
-		LastEntry.ModificationToolTip = ModificationToolTip;
 	}
 
 	inline bool IsEligibleForEnergyGain(const FGameplayEffectCustomExecutionParameters& ExecParams,
@@ -10,53 +10,140 @@ void UDamagePipelineDebugSubsystem::Initialize(FSubsystemCollectionBase& Collect
 {
 	Super::Initialize(Collection);
 	AbilitySystemSettings = GetDefault<UGASC_AbilitySystemSettings>();
+
+#if GASC_WITH_DAMAGE_LOG
+	const int32 Capacity = AbilitySystemSettings ? FMath::Max(AbilitySystemSettings->DamageLogCapacity, 1) : 1024;
+	DamageLogEntries.SetNum(Capacity);
+#endif
 }
 
 void UDamagePipelineDebugSubsystem::LogDamageEvent(const FDamageLogEntry& DamageContext)
 {
-	//DamageLogEntries.Add(DamageContext);
-	DamageLogEntries.EmplaceAt(0, DamageContext);
+	const int32 Capacity = DamageLogEntries.Num();
+	if (Capacity == 0)
+	{
+		return;
+	}
+
+	const uint64 Sequence = NextDamageLogSequence++;
+	if (DamageLogCount == Capacity)
+	{
+		// Full: the slot we are about to write holds the oldest entry
+		EvictDamageLogEntry(Sequence - Capacity);
+	}
+	else
+	{
+		++DamageLogCount;
+	}
+
+	DamageLogEntries[Sequence % Capacity] = DamageContext;
+
+	if (DamageContext.DamageID)
+	{
+		DamageIDToSequence.Add(DamageContext.DamageID, Sequence);
+	}
+	AddActorDamageLogIndex(DamageContext.DamageTargetID, Sequence);
+	if (DamageContext.DamageInstigatorID != DamageContext.DamageTargetID)
+	{
+		AddActorDamageLogIndex(DamageContext.DamageInstigatorID, Sequence);
+	}
 }
 
-TArray<FDamageLogEntry> UDamagePipelineDebugSubsystem::GetDamageLogEntries()
+void UDamagePipelineDebugSubsystem::ForEachDamageLogEntry(TFunctionRef<void(const FDamageLogEntry&)> Visitor) const
 {
-	return DamageLogEntries;
+	for (int32 Offset = 1; Offset <= DamageLogCount; ++Offset)
+	{
+		Visitor(GetDamageLogEntryBySequence(NextDamageLogSequence - Offset));
+	}
 }
 
-TArray<FDamageLogEntry> UDamagePipelineDebugSubsystem::GetDamageLogEntriesForActorID(uint32 InActorID)
+void UDamagePipelineDebugSubsystem::GetDamageLogEntriesForActorID(uint32 InActorID, TArray<const FDamageLogEntry*>& OutEntries) const
 {
-	TArray<FDamageLogEntry> FilteredLogEntries;
-	FilteredLogEntries.Reserve(DamageLogEntries.Num());
+	OutEntries.Reset();
 
-	for (const FDamageLogEntry& Entry : DamageLogEntries)
+	const FActorDamageLogIndex* ActorIndex = ActorDamageLogIndices.Find(InActorID);
+	if (!ActorIndex)
 	{
-		if (GetTypeHash(Entry.DamageTargetID) == InActorID || GetTypeHash(Entry.DamageInstigatorID) == InActorID)
-		{
-			FilteredLogEntries.Add(Entry);
-		}
+		return;
+	}
+
+	OutEntries.Reserve(ActorIndex->Sequences.Num() - ActorIndex->FirstLive);
+	for (int32 Index = ActorIndex->Sequences.Num() - 1; Index >= ActorIndex->FirstLive; --Index)
+	{
+		OutEntries.Add(&GetDamageLogEntryBySequence(ActorIndex->Sequences[Index]));
 	}
-	return FilteredLogEntries;
 }
 
-FDamageLogEntry UDamagePipelineDebugSubsystem::GetDamageLogEntryByDamageID(uint32 InDamageID)
+const FDamageLogEntry* UDamagePipelineDebugSubsystem::GetDamageLogEntryByDamageID(uint32 InDamageID) const
+{
+	const uint64* Sequence = DamageIDToSequence.Find(InDamageID);
+	return Sequence ? &GetDamageLogEntryBySequence(*Sequence) : nullptr;
+}
+
+const FDamageLogEntry& UDamagePipelineDebugSubsystem::GetDamageLogEntryBySequence(uint64 Sequence) const
+{
+	return DamageLogEntries[Sequence % DamageLogEntries.Num()];
+}
+
+void UDamagePipelineDebugSubsystem::EvictDamageLogEntry(uint64 Sequence)
 {
-	FDamageLogEntry LastDamageLogEntry = FDamageLogEntry();
-	for (const FDamageLogEntry& Entry : DamageLogEntries)
+	const FDamageLogEntry& Evicted = GetDamageLogEntryBySequence(Sequence);
+
+	// Only drop the ID mapping if it still points at this entry (IDs can be re-logged by simulation)
+	if (const uint64* MappedSequence = DamageIDToSequence.Find(Evicted.DamageID); MappedSequence && *MappedSequence == Sequence)
 	{
-		if (GetTypeHash(Entry.DamageID) == InDamageID)
-		{
-			LastDamageLogEntry = Entry;
-			break;
-		}
+		DamageIDToSequence.Remove(Evicted.DamageID);
+	}
+
+	RemoveActorDamageLogIndex(Evicted.DamageTargetID, Sequence);
+	if (Evicted.DamageInstigatorID != Evicted.DamageTargetID)
+	{
+		RemoveActorDamageLogIndex(Evicted.DamageInstigatorID, Sequence);
+	}
+}
+
+void UDamagePipelineDebugSubsystem::AddActorDamageLogIndex(uint32 InActorID, uint64 Sequence)
+{
+	if (InActorID == 0)
+	{
+		return;
+	}
+	ActorDamageLogIndices.FindOrAdd(InActorID).Sequences.Add(Sequence);
+}
+
+void UDamagePipelineDebugSubsystem::RemoveActorDamageLogIndex(uint32 InActorID, uint64 Sequence)
+{
+	FActorDamageLogIndex* ActorIndex = ActorDamageLogIndices.Find(InActorID);
+	if (!ActorIndex)
+	{
+		return;
+	}
+
+	// Eviction is always oldest-first, so the evicted entry is at the front of each actor's list
+	if (ActorIndex->Sequences.IsValidIndex(ActorIndex->FirstLive) && ActorIndex->Sequences[ActorIndex->FirstLive] == Sequence)
+	{
+		++ActorIndex->FirstLive;
+	}
+
+	if (ActorIndex->FirstLive >= ActorIndex->Sequences.Num())
+	{
+		ActorDamageLogIndices.Remove(InActorID);
+	}
+	else if (ActorIndex->FirstLive > ActorIndex->Sequences.Num() / 2)
+	{
+		// Compact once the dead prefix outweighs the live tail, keeping removal amortised O(1)
+		ActorIndex->Sequences.RemoveAt(0, ActorIndex->FirstLive, EAllowShrinking::No);
+		ActorIndex->FirstLive = 0;
 	}
-	return LastDamageLogEntry;
 }
 
 void UDamagePipelineDebugSubsystem::SimulateDamageFromID(uint32 DamageID)
 {
-	FDamageLogEntry DamageLogEntry = GetDamageLogEntryByDamageID(DamageID);
-	if (DamageLogEntry.DamageID)
+	const FDamageLogEntry* LoggedEntry = GetDamageLogEntryByDamageID(DamageID);
+	if (LoggedEntry && LoggedEntry->DamageID)
 	{
+		// Copied: the simulated event is logged again below and may overwrite the slot we read from
+		FDamageLogEntry DamageLogEntry = *LoggedEntry;
 		FDamageModificationContext DamageContext;
 		if (GetActorFromID(DamageLogEntry.DamageTargetID))
 		{
@@ -119,7 +206,7 @@ uint32 UDamagePipelineDebugSubsystem::GenerateDebugDamageUniqueID()
 	return DamageIDCounter.fetch_add(1, std::memory_order_relaxed);
 }
 
-void UDamagePipelineDebugSubsystem::TempApplyAttributeModToInstigator(FDamageLogEntry DamageLogEntry, AActor* InInstigator)
+void UDamagePipelineDebugSubsystem::TempApplyAttributeModToInstigator(const FDamageLogEntry& DamageLogEntry, AActor* InInstigator)
 {
 	TArray<FGameplayAttribute> IgnoredSimulatedAttributes;
 	if (AbilitySystemSettings)
@@ -131,23 +218,17 @@ void UDamagePipelineDebugSubsystem::TempApplyAttributeModToInstigator(FDamageLog
 	{
 		if (UAbilitySystemComponent* InstigatorASC = InstigatorPawn->GetAbilitySystemComponent())
 		{
-			TArray<FGameplayAttribute> AllAttributes;
-			InstigatorASC->GetAllAttributes(AllAttributes);
-			
-			TArray<FString> AttributeNames;
-			DamageLogEntry.Attributes.GetKeys(AttributeNames);
-			
 			InstigatorAttributesBackup.Empty();
 			
-			for (const FGameplayAttribute& Attribute : AllAttributes)
+			for (const FDamageLogAttributeValue& LoggedAttribute : DamageLogEntry.Attributes)
 			{
-				if (AttributeNames.Contains(Attribute.AttributeName) && !IgnoredSimulatedAttributes.Contains(Attribute))
+				const FGameplayAttribute Attribute(const_cast<FProperty*>(LoggedAttribute.AttributeProperty));
+				if (InstigatorASC->HasAttributeSetForAttribute(Attribute) && !IgnoredSimulatedAttributes.Contains(Attribute))
 				{
 					float Original = InstigatorASC->GetNumericAttribute(Attribute);
-					float NewValue = DamageLogEntry.Attributes.FindChecked(Attribute.GetName());
 					
 					InstigatorAttributesBackup.Add(Attribute, Original);
-					InstigatorASC->ApplyModToAttribute(Attribute, EGameplayModOp::Override, NewValue);
+					InstigatorASC->ApplyModToAttribute(Attribute, EGameplayModOp::Override, LoggedAttribute.Value);
 				}
 			}
 		}
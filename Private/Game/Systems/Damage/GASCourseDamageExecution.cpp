@@ -87,15 +87,16 @@ void UGASCourseDamageExecution::Execute_Implementation(
 		return;
 	}
 
+#if GASC_WITH_DAMAGE_LOG
 	auto* GASCourseContext = static_cast<FGASCourseGameplayEffectContext*>(BaseCtx);
-
-	GASCourseContext->DamageLogEntry.HitInstigatorName = SourceActor->GetName();
-	GASCourseContext->DamageLogEntry.HitTargetName = TargetActor->GetName();
+	GASCourseContext->DamageLogEntry.HitInstigatorName = SourceActor->GetFName();
+	GASCourseContext->DamageLogEntry.HitTargetName = TargetActor->GetFName();
 	GASCourseContext->DamageLogEntry.HitInstigatorTagsContainer.AppendTags(Spec->CapturedSourceTags.GetActorTags());
 	GASCourseContext->DamageLogEntry.HitTargetTagsContainer.AppendTags(Spec->CapturedTargetTags.GetActorTags());
 	GASCourseContext->DamageLogEntry.HitContextTagsContainer.AppendTags(Spec->GetDynamicAssetTags());
 	GASCourseContext->DamageLogEntry.DamageInstigatorID = SourceActor->GetUniqueID();
 	GASCourseContext->DamageLogEntry.DamageTargetID = TargetActor->GetUniqueID();
+#endif
 
 	// ==========================
 	// 1. Base damage
@@ -110,7 +111,9 @@ void UGASCourseDamageExecution::Execute_Implementation(
 		0.0f);
 
 	float ModifiedDamage = BaseDamage;
+#if GASC_WITH_DAMAGE_LOG
 	GASCourseContext->DamageLogEntry.BaseDamageValue = BaseDamage;
+#endif
 
 	// ==========================
 	// 2. Snapshot DoT handling
@@ -158,10 +161,12 @@ void UGASCourseDamageExecution::Execute_Implementation(
 			ModifiedDamage *= (1.f + CriticalDamageMultiplier);
 			Spec->AddDynamicAssetTag(Data_DamageCritical);
 
-			GASCourseContext->DamageLogEntry.Attributes.Add(
-				GASCourseDamageStatics().CriticalChanceProperty->GetName(), CriticalChance);
-			GASCourseContext->DamageLogEntry.Attributes.Add(
-				GASCourseDamageStatics().CriticalDamageMultiplierProperty->GetName(), CriticalDamageMultiplier);
+#if GASC_WITH_DAMAGE_LOG
+			GASCourseContext->DamageLogEntry.AddAttribute(
+				GASCourseDamageStatics().CriticalChanceProperty, CriticalChance);
+			GASCourseContext->DamageLogEntry.AddAttribute(
+				GASCourseDamageStatics().CriticalDamageMultiplierProperty, CriticalDamageMultiplier);
+#endif
 		}
 
 		float DamageMultiplier = 0.0f;
@@ -171,8 +176,10 @@ void UGASCourseDamageExecution::Execute_Implementation(
 		if (DamageMultiplier > 0.f)
 		{
 			ModifiedDamage += (ModifiedDamage * DamageMultiplier);
-			GASCourseContext->DamageLogEntry.Attributes.Add(
-				DamageStatics().DamageMultiplierProperty->GetName(), DamageMultiplier);
+#if GASC_WITH_DAMAGE_LOG
+			GASCourseContext->DamageLogEntry.AddAttribute(
+				DamageStatics().DamageMultiplierProperty, DamageMultiplier);
+#endif
 		}
 
 		float DamageResistance = 0.0f;
@@ -184,8 +191,10 @@ void UGASCourseDamageExecution::Execute_Implementation(
 		{
 			ModifiedDamage *= (1.f - DamageResistance);
 			Spec->AddDynamicAssetTag(Data_DamageResisted);
-			GASCourseContext->DamageLogEntry.Attributes.Add(
-				DamageStatics().DamageResistanceMultiplierProperty->GetName(), DamageResistance);
+#if GASC_WITH_DAMAGE_LOG
+			GASCourseContext->DamageLogEntry.AddAttribute(
+				DamageStatics().DamageResistanceMultiplierProperty, DamageResistance);
+#endif
 		}
 
 		ModifiedDamage = FMath::Max(ModifiedDamage, 0.f);
@@ -216,30 +225,25 @@ void UGASCourseDamageExecution::Execute_Implementation(
 		// Cache snapshot damage for DoT ticks
 		Spec->SetSetByCallerMagnitude(Data_CachedDamage, ModifiedDamage);
 
+#if GASC_WITH_DAMAGE_LOG
 		GASCourseContext->DamageLogEntry.ModifiedDamageValue =
 			ModifiedDamage - BaseDamage;
+#endif
 	}
 
 	// ==========================
 	// 4. Lifesteal
 	// ==========================
 
-	if (UWorld* World = SourceActor->GetWorld())
+	// Accumulated per instigator and applied as a single heal by the pipeline at the end of the frame
+	if (ModifiedDamage > 0.f)
 	{
-		if (UGASC_DamagePipelineSubsystem* DamagePipelineSubsystem =
-			World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
+		if (UWorld* World = SourceActor->GetWorld())
 		{
-			if (ModifiedDamage > 0.f)
+			if (UGASC_DamagePipelineSubsystem* DamagePipelineSubsystem =
+				World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 			{
-				World->GetTimerManager().SetTimerForNextTick(
-					FTimerDelegate::CreateLambda(
-						[this, DamagePipelineSubsystem, SourceActor, ModifiedDamage]()
-						{
-							FDamagePipelineContext HealContext;
-							HealContext.GrantedTags.AddTag(Data_HealingLifeSteal);
-							DamagePipelineSubsystem->ApplyHealToTarget(
-								SourceActor, SourceActor, ModifiedDamage, HealContext);
-						}));
+				DamagePipelineSubsystem->QueueLifestealHeal(SourceActor, TargetActor, ModifiedDamage);
 			}
 		}
 	}
@@ -13,10 +13,16 @@
 #include "Game/GameplayAbilitySystem/GameplayEffect/Damage/GASC_DamageOverTimeGameplayEffect.h"
 #include "Game/GameplayAbilitySystem/GameplayEffect/Healing/GASC_HealingGameplayEffect.h"
 #include "Game/GameplayAbilitySystem/GameplayEffect/Healing/GASC_HealingOverTimeGameplayEffect.h"
+#include "Game/DeveloperSettings/UGASC_AbilitySystemSettings.h"
 
 void UGASC_DamagePipelineSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	if (const UGASC_AbilitySystemSettings* Settings = UGASC_AbilitySystemSettings::Get())
+	{
+		bBatchEvents = Settings->bBatchDamagePipelineEvents;
+	}
 }
 
 void UGASC_DamagePipelineSubsystem::Deinitialize()
@@ -34,6 +40,19 @@ void UGASC_DamagePipelineSubsystem::Deinitialize()
 	NativeDamageListeners.Empty();
 	NativeHealingListeners.Empty();
 
+	// Clear per-actor buckets
+	ActorListenerBuckets.Empty();
+
+	// Drop anything still queued; listeners are going away with the world
+	NativeDamageBatchListeners.Empty();
+	PendingDamageEvents.Empty();
+	PendingContextTags.Empty();
+	FlushingDamageEvents.Empty();
+	FlushingContextTags.Empty();
+	PendingLifestealHeals.Empty();
+	PendingLifestealIndex.Empty();
+	FlushingLifestealHeals.Empty();
+
 	// Clear global BP delegates
 	OnHitApplied_BP.Clear();
 	OnHitReceived_BP.Clear();
@@ -50,20 +69,173 @@ void UGASC_DamagePipelineSubsystem::PostInitialize()
 	Super::PostInitialize();
 }
 
+void UGASC_DamagePipelineSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Lifesteal first, so in batched mode the heals it produces go out with this frame's events
+	FlushPendingLifesteal();
+	FlushPendingDamageEvents();
+}
+
+bool UGASC_DamagePipelineSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && (!PendingDamageEvents.IsEmpty() || !PendingLifestealHeals.IsEmpty());
+}
+
+/* ===========================================================================================================
+ *                                      PER-ACTOR LISTENER BUCKETS
+ * =========================================================================================================== */
+
+namespace GASC_DamagePipeline
+{
+	/** Invokes every live dynamic listener in the array, dropping the ones whose owner has been collected. */
+	template<typename ListenerType, typename ContextType>
+	void DispatchDynamicListeners(TArray<ListenerType>& Listeners, const ContextType& Context)
+	{
+		for (int32 i = Listeners.Num() - 1; i >= 0; --i)
+		{
+			if (!Listeners.IsValidIndex(i))
+			{
+				continue;
+			}
+
+			ListenerType& L = Listeners[i];
+
+			if (L.ListenerActor.IsValid())
+			{
+				L.Callback.ExecuteIfBound(Context);
+			}
+			else
+			{
+				Listeners.RemoveAtSwap(i);
+			}
+		}
+	}
+
+	/** Invokes one delegate member (OnApplied / OnReceived) on every live native listener in the array. */
+	template<typename ListenerType, typename DelegateType, typename ContextType>
+	void DispatchNativeListeners(TArray<ListenerType>& Listeners, DelegateType ListenerType::* Delegate, const ContextType& Context)
+	{
+		for (int32 i = Listeners.Num() - 1; i >= 0; --i)
+		{
+			if (!Listeners.IsValidIndex(i))
+			{
+				continue;
+			}
+
+			ListenerType& Entry = Listeners[i];
+
+			if (!Entry.Listener.IsValid())
+			{
+				Listeners.RemoveAtSwap(i);
+				continue;
+			}
+
+			(Entry.*Delegate).ExecuteIfBound(Context);
+		}
+	}
+}
+
+TSharedPtr<FGASC_DamagePipelineActorBucket> UGASC_DamagePipelineSubsystem::FindActorBucket(const AActor* Actor) const
+{
+	return Actor ? FindActorBucket(FObjectKey(Actor)) : nullptr;
+}
+
+TSharedPtr<FGASC_DamagePipelineActorBucket> UGASC_DamagePipelineSubsystem::FindActorBucket(const FObjectKey& ActorKey) const
+{
+	if (ActorKey == FObjectKey() || ActorListenerBuckets.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const TSharedPtr<FGASC_DamagePipelineActorBucket>* Bucket = ActorListenerBuckets.Find(ActorKey);
+	return Bucket ? *Bucket : nullptr;
+}
+
+FGASC_DamagePipelineActorBucket& UGASC_DamagePipelineSubsystem::FindOrAddActorBucket(const AActor* Actor)
+{
+	check(Actor);
+
+	const FObjectKey Key(Actor);
+	if (!ActorListenerBuckets.Contains(Key))
+	{
+		// Only sweeps when the map is about to grow, so buckets of destroyed actors cannot pile up
+		PruneDestroyedActorBuckets();
+	}
+
+	TSharedPtr<FGASC_DamagePipelineActorBucket>& Bucket = ActorListenerBuckets.FindOrAdd(Key);
+	if (!Bucket.IsValid())
+	{
+		Bucket = MakeShared<FGASC_DamagePipelineActorBucket>();
+	}
+	return *Bucket;
+}
+
+void UGASC_DamagePipelineSubsystem::PruneActorBucket(const AActor* Actor)
+{
+	if (Actor)
+	{
+		PruneActorBucket(FObjectKey(Actor));
+	}
+}
+
+void UGASC_DamagePipelineSubsystem::PruneActorBucket(const FObjectKey& ActorKey)
+{
+	if (const TSharedPtr<FGASC_DamagePipelineActorBucket>* Bucket = ActorListenerBuckets.Find(ActorKey))
+	{
+		if (!Bucket->IsValid() || (*Bucket)->IsEmpty())
+		{
+			ActorListenerBuckets.Remove(ActorKey);
+		}
+	}
+}
+
+void UGASC_DamagePipelineSubsystem::PruneDestroyedActorBuckets()
+{
+	for (auto It = ActorListenerBuckets.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UGASC_DamagePipelineSubsystem::RemoveFromAllActorBuckets(TFunctionRef<void(FGASC_DamagePipelineActorBucket&)> RemoveFn)
+{
+	for (auto It = ActorListenerBuckets.CreateIterator(); It; ++It)
+	{
+		if (It->Value.IsValid())
+		{
+			RemoveFn(*It->Value);
+		}
+
+		if (!It->Value.IsValid() || It->Value->IsEmpty() || !It->Key.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
 /* ===========================================================================================================
  *                                      NATIVE HIT LISTENERS
  * =========================================================================================================== */
 
 void UGASC_DamagePipelineSubsystem::RegisterNativeHitAppliedListener(
 	UObject* Listener,
-	FOnHitAppliedNative&& Callback)
+	FOnHitAppliedNative&& Callback,
+	const AActor* FilterActor)
 {
 	if (!IsValid(Listener) || !Callback.IsBound())
 	{
 		return;
 	}
 
-	for (FNativeHitListener& Entry : NativeHitListeners)
+	TArray<FNativeHitListener>& Listeners =
+		FilterActor ? FindOrAddActorBucket(FilterActor).NativeHitListeners : NativeHitListeners;
+
+	for (FNativeHitListener& Entry : Listeners)
 	{
 		if (Entry.Listener.Get() == Listener)
 		{
@@ -72,21 +244,25 @@ void UGASC_DamagePipelineSubsystem::RegisterNativeHitAppliedListener(
 		}
 	}
 
-	FNativeHitListener& NewEntry = NativeHitListeners.AddDefaulted_GetRef();
+	FNativeHitListener& NewEntry = Listeners.AddDefaulted_GetRef();
 	NewEntry.Listener  = Listener;
 	NewEntry.OnApplied = MoveTemp(Callback);
 }
 
 void UGASC_DamagePipelineSubsystem::RegisterNativeHitReceivedListener(
 	UObject* Listener,
-	FOnHitReceivedNative&& Callback)
+	FOnHitReceivedNative&& Callback,
+	const AActor* FilterActor)
 {
 	if (!IsValid(Listener) || !Callback.IsBound())
 	{
 		return;
 	}
 
-	for (FNativeHitListener& Entry : NativeHitListeners)
+	TArray<FNativeHitListener>& Listeners =
+		FilterActor ? FindOrAddActorBucket(FilterActor).NativeHitListeners : NativeHitListeners;
+
+	for (FNativeHitListener& Entry : Listeners)
 	{
 		if (Entry.Listener.Get() == Listener)
 		{
@@ -95,7 +271,7 @@ void UGASC_DamagePipelineSubsystem::RegisterNativeHitReceivedListener(
 		}
 	}
 
-	FNativeHitListener& NewEntry = NativeHitListeners.AddDefaulted_GetRef();
+	FNativeHitListener& NewEntry = Listeners.AddDefaulted_GetRef();
 	NewEntry.Listener   = Listener;
 	NewEntry.OnReceived = MoveTemp(Callback);
 }
@@ -107,11 +283,16 @@ void UGASC_DamagePipelineSubsystem::UnregisterNativeHitListener(UObject* Listene
 		return;
 	}
 
-	NativeHitListeners.RemoveAll(
-		[Listener](const FNativeHitListener& L)
-		{
-			return L.Listener.Get() == Listener;
-		});
+	auto Match = [Listener](const FNativeHitListener& L)
+	{
+		return L.Listener.Get() == Listener;
+	};
+
+	NativeHitListeners.RemoveAll(Match);
+	RemoveFromAllActorBuckets([&Match](FGASC_DamagePipelineActorBucket& Bucket)
+	{
+		Bucket.NativeHitListeners.RemoveAll(Match);
+	});
 }
 
 /* ===========================================================================================================
@@ -120,14 +301,18 @@ void UGASC_DamagePipelineSubsystem::UnregisterNativeHitListener(UObject* Listene
 
 void UGASC_DamagePipelineSubsystem::RegisterNativeDamageAppliedListener(
 	UObject* Listener,
-	FOnDamageAppliedNative&& Callback)
+	FOnDamageAppliedNative&& Callback,
+	const AActor* FilterActor)
 {
 	if (!IsValid(Listener) || !Callback.IsBound())
 	{
 		return;
 	}
 
-	for (FNativeDamageListener& Entry : NativeDamageListeners)
+	TArray<FNativeDamageListener>& Listeners =
+		FilterActor ? FindOrAddActorBucket(FilterActor).NativeDamageListeners : NativeDamageListeners;
+
+	for (FNativeDamageListener& Entry : Listeners)
 	{
 		if (Entry.Listener.Get() == Listener)
 		{
@@ -136,21 +321,25 @@ void UGASC_DamagePipelineSubsystem::RegisterNativeDamageAppliedListener(
 		}
 	}
 
-	FNativeDamageListener& NewEntry = NativeDamageListeners.AddDefaulted_GetRef();
+	FNativeDamageListener& NewEntry = Listeners.AddDefaulted_GetRef();
 	NewEntry.Listener  = Listener;
 	NewEntry.OnApplied = MoveTemp(Callback);
 }
 
 void UGASC_DamagePipelineSubsystem::RegisterNativeDamageReceivedListener(
 	UObject* Listener,
-	FOnDamageReceivedNative&& Callback)
+	FOnDamageReceivedNative&& Callback,
+	const AActor* FilterActor)
 {
 	if (!IsValid(Listener) || !Callback.IsBound())
 	{
 		return;
 	}
 
-	for (FNativeDamageListener& Entry : NativeDamageListeners)
+	TArray<FNativeDamageListener>& Listeners =
+		FilterActor ? FindOrAddActorBucket(FilterActor).NativeDamageListeners : NativeDamageListeners;
+
+	for (FNativeDamageListener& Entry : Listeners)
 	{
 		if (Entry.Listener.Get() == Listener)
 		{
@@ -159,7 +348,7 @@ void UGASC_DamagePipelineSubsystem::RegisterNativeDamageReceivedListener(
 		}
 	}
 
-	FNativeDamageListener& NewEntry = NativeDamageListeners.AddDefaulted_GetRef();
+	FNativeDamageListener& NewEntry = Listeners.AddDefaulted_GetRef();
 	NewEntry.Listener   = Listener;
 	NewEntry.OnReceived = MoveTemp(Callback);
 }
@@ -171,11 +360,16 @@ void UGASC_DamagePipelineSubsystem::UnregisterNativeDamageListener(UObject* List
 		return;
 	}
 
-	NativeDamageListeners.RemoveAll(
-		[Listener](const FNativeDamageListener& L)
-		{
-			return L.Listener.Get() == Listener;
-		});
+	auto Match = [Listener](const FNativeDamageListener& L)
+	{
+		return L.Listener.Get() == Listener;
+	};
+
+	NativeDamageListeners.RemoveAll(Match);
+	RemoveFromAllActorBuckets([&Match](FGASC_DamagePipelineActorBucket& Bucket)
+	{
+		Bucket.NativeDamageListeners.RemoveAll(Match);
+	});
 }
 
 /* ===========================================================================================================
@@ -184,12 +378,16 @@ void UGASC_DamagePipelineSubsystem::UnregisterNativeDamageListener(UObject* List
 
 void UGASC_DamagePipelineSubsystem::RegisterNativeHealingAppliedListener(
 	UObject* Listener,
-	FOnHealingAppliedNative&& Callback)
+	FOnHealingAppliedNative&& Callback,
+	const AActor* FilterActor)
 {
 	if (!IsValid(Listener) || !Callback.IsBound())
 		return;
 
-	for (FNativeHealingListener& Entry : NativeHealingListeners)
+	TArray<FNativeHealingListener>& Listeners =
+		FilterActor ? FindOrAddActorBucket(FilterActor).NativeHealingListeners : NativeHealingListeners;
+
+	for (FNativeHealingListener& Entry : Listeners)
 	{
 		if (Entry.Listener.Get() == Listener)
 		{
@@ -198,19 +396,23 @@ void UGASC_DamagePipelineSubsystem::RegisterNativeHealingAppliedListener(
 		}
 	}
 
-	FNativeHealingListener& NewEntry = NativeHealingListeners.AddDefaulted_GetRef();
+	FNativeHealingListener& NewEntry = Listeners.AddDefaulted_GetRef();
 	NewEntry.Listener  = Listener;
 	NewEntry.OnApplied = MoveTemp(Callback);
 }
 
 void UGASC_DamagePipelineSubsystem::RegisterNativeHealingReceivedListener(
 	UObject* Listener,
-	FOnHealingReceivedNative&& Callback)
+	FOnHealingReceivedNative&& Callback,
+	const AActor* FilterActor)
 {
 	if (!IsValid(Listener) || !Callback.IsBound())
 		return;
 
-	for (FNativeHealingListener& Entry : NativeHealingListeners)
+	TArray<FNativeHealingListener>& Listeners =
+		FilterActor ? FindOrAddActorBucket(FilterActor).NativeHealingListeners : NativeHealingListeners;
+
+	for (FNativeHealingListener& Entry : Listeners)
 	{
 		if (Entry.Listener.Get() == Listener)
 		{
@@ -219,7 +421,7 @@ void UGASC_DamagePipelineSubsystem::RegisterNativeHealingReceivedListener(
 		}
 	}
 
-	FNativeHealingListener& NewEntry = NativeHealingListeners.AddDefaulted_GetRef();
+	FNativeHealingListener& NewEntry = Listeners.AddDefaulted_GetRef();
 	NewEntry.Listener   = Listener;
 	NewEntry.OnReceived = MoveTemp(Callback);
 }
@@ -229,11 +431,16 @@ void UGASC_DamagePipelineSubsystem::UnregisterNativeHealingListener(UObject* Lis
 	if (!IsValid(Listener))
 		return;
 
-	NativeHealingListeners.RemoveAll(
-		[Listener](const FNativeHealingListener& L)
-		{
-			return L.Listener.Get() == Listener;
-		});
+	auto Match = [Listener](const FNativeHealingListener& L)
+	{
+		return L.Listener.Get() == Listener;
+	};
+
+	NativeHealingListeners.RemoveAll(Match);
+	RemoveFromAllActorBuckets([&Match](FGASC_DamagePipelineActorBucket& Bucket)
+	{
+		Bucket.NativeHealingListeners.RemoveAll(Match);
+	});
 }
 
 /* ------- Backward compatibility wrappers (old Add/RemoveHealEventListener) ------- */
@@ -252,40 +459,26 @@ void UGASC_DamagePipelineSubsystem::RemoveHealingListener(AActor* ListenerActor)
 
 /* ===========================================================================================================
  *                                         INTERNAL BROADCAST ENTRY POINTS
+ *
+ *  Global listeners see every event. Keyed listeners are looked up once per broadcast: Applied events use
+ *  the instigator's bucket, Received events the target's, so the cost scales with interested listeners only.
  * =========================================================================================================== */
 
 void UGASC_DamagePipelineSubsystem::Internal_BroadcastHitApplied(const FHitContext& Context)
 {
-	// 1) Dynamic per-object listeners
-	for (int32 i = OnHitAppliedListeners.Num() - 1; i >= 0; --i)
-	{
-		FOnHitEventListener& L = OnHitAppliedListeners[i];
+	using namespace GASC_DamagePipeline;
 
-		if (UObject* Obj = L.ListenerActor.Get())
-		{
-			L.Callback.ExecuteIfBound(Context);
-		}
-		else
-		{
-			OnHitAppliedListeners.RemoveAtSwap(i);
-		}
-	}
+	// 1) Global dynamic + native listeners
+	DispatchDynamicListeners(OnHitAppliedListeners, Context);
+	DispatchNativeListeners(NativeHitListeners, &FNativeHitListener::OnApplied, Context);
 
-	// 2) Native listeners
-	for (int32 i = NativeHitListeners.Num() - 1; i >= 0; --i)
+	// 2) Listeners keyed on the instigator
+	const AActor* KeyActor = Context.HitInstigator.Get();
+	if (const TSharedPtr<FGASC_DamagePipelineActorBucket> Bucket = FindActorBucket(KeyActor))
 	{
-		FNativeHitListener& Entry = NativeHitListeners[i];
-
-		if (!Entry.Listener.IsValid())
-		{
-			NativeHitListeners.RemoveAtSwap(i);
-			continue;
-		}
-
-		if (Entry.OnApplied.IsBound())
-		{
-			Entry.OnApplied.Execute(Context);
-		}
+		DispatchDynamicListeners(Bucket->HitAppliedListeners, Context);
+		DispatchNativeListeners(Bucket->NativeHitListeners, &FNativeHitListener::OnApplied, Context);
+		PruneActorBucket(KeyActor);
 	}
 
 	// 3) Global BP convenience event
@@ -294,36 +487,19 @@ void UGASC_DamagePipelineSubsystem::Internal_BroadcastHitApplied(const FHitConte
 
 void UGASC_DamagePipelineSubsystem::Internal_BroadcastHitReceived(const FHitContext& Context)
 {
-	// 1) Dynamic per-object listeners
-	for (int32 i = OnHitReceivedListeners.Num() - 1; i >= 0; --i)
-	{
-		FOnHitEventListener& L = OnHitReceivedListeners[i];
+	using namespace GASC_DamagePipeline;
 
-		if (UObject* Obj = L.ListenerActor.Get())
-		{
-			L.Callback.ExecuteIfBound(Context);
-		}
-		else
-		{
-			OnHitReceivedListeners.RemoveAtSwap(i);
-		}
-	}
+	// 1) Global dynamic + native listeners
+	DispatchDynamicListeners(OnHitReceivedListeners, Context);
+	DispatchNativeListeners(NativeHitListeners, &FNativeHitListener::OnReceived, Context);
 
-	// 2) Native listeners
-	for (int32 i = NativeHitListeners.Num() - 1; i >= 0; --i)
+	// 2) Listeners keyed on the target
+	const AActor* KeyActor = Context.HitTarget.Get();
+	if (const TSharedPtr<FGASC_DamagePipelineActorBucket> Bucket = FindActorBucket(KeyActor))
 	{
-		FNativeHitListener& Entry = NativeHitListeners[i];
-
-		if (!Entry.Listener.IsValid())
-		{
-			NativeHitListeners.RemoveAtSwap(i);
-			continue;
-		}
-
-		if (Entry.OnReceived.IsBound())
-		{
-			Entry.OnReceived.Execute(Context);
-		}
+		DispatchDynamicListeners(Bucket->HitReceivedListeners, Context);
+		DispatchNativeListeners(Bucket->NativeHitListeners, &FNativeHitListener::OnReceived, Context);
+		PruneActorBucket(KeyActor);
 	}
 
 	// 3) Global BP convenience event
@@ -333,157 +509,315 @@ void UGASC_DamagePipelineSubsystem::Internal_BroadcastHitReceived(const FHitCont
 void UGASC_DamagePipelineSubsystem::Internal_BroadcastDamageApplied(
 	const FDamageModificationContext& Context)
 {
-	// 1) Dynamic per-object listeners
-	for (int32 i = OnDamageAppliedListeners.Num() - 1; i >= 0; --i)
-	{
-		FOnDamageEventListener& L = OnDamageAppliedListeners[i];
+	using namespace GASC_DamagePipeline;
 
-		if (UObject* Obj = L.ListenerActor.Get())
-		{
-			L.Callback.ExecuteIfBound(Context);
-		}
-		else
-		{
-			OnDamageAppliedListeners.RemoveAtSwap(i);
-		}
+	// 1) Global dynamic + native listeners
+	DispatchDynamicListeners(OnDamageAppliedListeners, Context);
+	DispatchNativeListeners(NativeDamageListeners, &FNativeDamageListener::OnApplied, Context);
+
+	// 2) Listeners keyed on the instigator
+	const AActor* KeyActor = Context.HitContext.HitInstigator.Get();
+	if (const TSharedPtr<FGASC_DamagePipelineActorBucket> Bucket = FindActorBucket(KeyActor))
+	{
+		DispatchDynamicListeners(Bucket->DamageAppliedListeners, Context);
+		DispatchNativeListeners(Bucket->NativeDamageListeners, &FNativeDamageListener::OnApplied, Context);
+		PruneActorBucket(KeyActor);
 	}
 
-	// 2) Native listeners
-	for (int32 i = NativeDamageListeners.Num() - 1; i >= 0; --i)
+	// 3) Global BP convenience event
+	OnDamageApplied_BP.Broadcast(Context);
+}
+
+void UGASC_DamagePipelineSubsystem::Internal_BroadcastDamageReceived(
+	const FDamageModificationContext& Context)
+{
+	using namespace GASC_DamagePipeline;
+
+	// 1) Global dynamic + native listeners
+	DispatchDynamicListeners(OnDamageReceivedListeners, Context);
+	DispatchNativeListeners(NativeDamageListeners, &FNativeDamageListener::OnReceived, Context);
+
+	// 2) Listeners keyed on the target
+	const AActor* KeyActor = Context.HitContext.HitTarget.Get();
+	if (const TSharedPtr<FGASC_DamagePipelineActorBucket> Bucket = FindActorBucket(KeyActor))
 	{
-		FNativeDamageListener& Entry = NativeDamageListeners[i];
+		DispatchDynamicListeners(Bucket->DamageReceivedListeners, Context);
+		DispatchNativeListeners(Bucket->NativeDamageListeners, &FNativeDamageListener::OnReceived, Context);
+		PruneActorBucket(KeyActor);
+	}
 
-		if (!Entry.Listener.IsValid())
-		{
-			NativeDamageListeners.RemoveAtSwap(i);
-			continue;
-		}
+	// 3) Global BP convenience event
+	OnDamageReceived_BP.Broadcast(Context);
+}
 
-		if (Entry.OnApplied.IsBound())
-		{
-			Entry.OnApplied.Execute(Context);
-		}
+void UGASC_DamagePipelineSubsystem::Internal_BroadcastHealingApplied(
+	const FDamageModificationContext& Context)
+{
+	using namespace GASC_DamagePipeline;
+
+	// 1) Global dynamic + native listeners
+	DispatchDynamicListeners(OnHealingAppliedListeners, Context);
+	DispatchNativeListeners(NativeHealingListeners, &FNativeHealingListener::OnApplied, Context);
+
+	// 2) Listeners keyed on the instigator
+	const AActor* KeyActor = Context.HitContext.HitInstigator.Get();
+	if (const TSharedPtr<FGASC_DamagePipelineActorBucket> Bucket = FindActorBucket(KeyActor))
+	{
+		DispatchDynamicListeners(Bucket->HealingAppliedListeners, Context);
+		DispatchNativeListeners(Bucket->NativeHealingListeners, &FNativeHealingListener::OnApplied, Context);
+		PruneActorBucket(KeyActor);
 	}
 
 	// 3) Global BP convenience event
-	OnDamageApplied_BP.Broadcast(Context);
+	OnHealingApplied_BP.Broadcast(Context);
 }
 
-void UGASC_DamagePipelineSubsystem::Internal_BroadcastDamageReceived(
+void UGASC_DamagePipelineSubsystem::Internal_BroadcastHealingReceived(
 	const FDamageModificationContext& Context)
 {
-	// 1) Dynamic per-object listeners
-	for (int32 i = OnDamageReceivedListeners.Num() - 1; i >= 0; --i)
+	using namespace GASC_DamagePipeline;
+
+	// 1) Global dynamic + native listeners
+	DispatchDynamicListeners(OnHealingReceivedListeners, Context);
+	DispatchNativeListeners(NativeHealingListeners, &FNativeHealingListener::OnReceived, Context);
+
+	// 2) Listeners keyed on the target
+	const AActor* KeyActor = Context.HitContext.HitTarget.Get();
+	if (const TSharedPtr<FGASC_DamagePipelineActorBucket> Bucket = FindActorBucket(KeyActor))
 	{
-		FOnDamageEventListener& L = OnDamageReceivedListeners[i];
+		DispatchDynamicListeners(Bucket->HealingReceivedListeners, Context);
+		DispatchNativeListeners(Bucket->NativeHealingListeners, &FNativeHealingListener::OnReceived, Context);
+		PruneActorBucket(KeyActor);
+	}
 
-		if (UObject* Obj = L.ListenerActor.Get())
-		{
-			L.Callback.ExecuteIfBound(Context);
-		}
-		else
+	// 3) Global BP convenience event
+	OnHealingReceived_BP.Broadcast(Context);
+}
+
+/* ===========================================================================================================
+ *                                          BATCHED EVENT BUS
+ * =========================================================================================================== */
+
+void UGASC_DamagePipelineSubsystem::RegisterNativeDamageBatchListener(
+	UObject* Listener,
+	FOnDamageEventBatchNative&& Callback)
+{
+	if (!IsValid(Listener) || !Callback.IsBound())
+	{
+		return;
+	}
+
+	for (FNativeDamageBatchListener& Entry : NativeDamageBatchListeners)
+	{
+		if (Entry.Listener.Get() == Listener)
 		{
-			OnDamageReceivedListeners.RemoveAtSwap(i);
+			Entry.OnBatch = MoveTemp(Callback);
+			return;
 		}
 	}
 
-	// 2) Native listeners
-	for (int32 i = NativeDamageListeners.Num() - 1; i >= 0; --i)
+	FNativeDamageBatchListener& NewEntry = NativeDamageBatchListeners.AddDefaulted_GetRef();
+	NewEntry.Listener = Listener;
+	NewEntry.OnBatch  = MoveTemp(Callback);
+}
+
+void UGASC_DamagePipelineSubsystem::UnregisterNativeDamageBatchListener(UObject* Listener)
+{
+	if (!IsValid(Listener))
 	{
-		FNativeDamageListener& Entry = NativeDamageListeners[i];
+		return;
+	}
 
-		if (!Entry.Listener.IsValid())
+	NativeDamageBatchListeners.RemoveAll(
+		[Listener](const FNativeDamageBatchListener& L)
 		{
-			NativeDamageListeners.RemoveAtSwap(i);
-			continue;
-		}
+			return L.Listener.Get() == Listener;
+		});
+}
 
-		if (Entry.OnReceived.IsBound())
-		{
-			Entry.OnReceived.Execute(Context);
-		}
+void UGASC_DamagePipelineSubsystem::SetBatchedEventsEnabled(bool bEnabled)
+{
+	if (bBatchEvents == bEnabled)
+	{
+		return;
 	}
 
-	// 3) Global BP convenience event
-	OnDamageReceived_BP.Broadcast(Context);
+	// Leaving batched mode must not strand whatever was queued this frame
+	if (!bEnabled)
+	{
+		FlushPendingDamageEvents();
+	}
+
+	bBatchEvents = bEnabled;
 }
 
-void UGASC_DamagePipelineSubsystem::Internal_BroadcastHealingApplied(
-	const FDamageModificationContext& Context)
+void UGASC_DamagePipelineSubsystem::Internal_SubmitDamageModification(
+	const FDamageModificationContext& Context,
+	const FGameplayTagContainer& ContextTags)
 {
-	// 1) Dynamic per-object listeners
-	for (int32 i = OnHealingAppliedListeners.Num() - 1; i >= 0; --i)
+	if (!bBatchEvents)
+	{
+		BroadcastModification(Context);
+		BroadcastToBatchListeners(MakeArrayView(&Context, 1));
+		return;
+	}
+
+	PendingDamageEvents.Add(Context);
+	PendingContextTags.Add(ContextTags);
+}
+
+void UGASC_DamagePipelineSubsystem::FlushPendingDamageEvents()
+{
+	if (PendingDamageEvents.IsEmpty())
+	{
+		return;
+	}
+
+	SCOPED_NAMED_EVENT(DamagePipeline_FlushPendingDamageEvents, FColor::Red);
+
+	// Events queued by listeners during this flush land in the (now empty) pending buffers for next frame.
+	Swap(PendingDamageEvents, FlushingDamageEvents);
+	Swap(PendingContextTags, FlushingContextTags);
+
+	for (int32 i = 0; i < FlushingDamageEvents.Num(); ++i)
 	{
-		FOnHealingEventListener& L = OnHealingAppliedListeners[i];
+		FHitContext& HitCtx = FlushingDamageEvents[i].HitContext;
+		HitCtx.HitContextTagsContainer = &FlushingContextTags[i];
 
-		if (UObject* Obj = L.ListenerActor.Get())
+		// Owned-tag pointers live on the ASCs; drop them if the avatar went away since submission
+		if (!HitCtx.HitTarget.IsValid())
 		{
-			L.Callback.ExecuteIfBound(Context);
+			HitCtx.HitTargetTagsContainer = nullptr;
 		}
-		else
+		if (!HitCtx.HitInstigator.IsValid())
 		{
-			OnHealingAppliedListeners.RemoveAtSwap(i);
+			HitCtx.HitInstigatorTagsContainer = nullptr;
 		}
 	}
 
-	// 2) Native listeners
-	for (int32 i = NativeHealingListeners.Num() - 1; i >= 0; --i)
+	for (const FDamageModificationContext& Context : FlushingDamageEvents)
 	{
-		FNativeHealingListener& Entry = NativeHealingListeners[i];
+		BroadcastModification(Context);
+	}
 
-		if (!Entry.Listener.IsValid())
+	BroadcastToBatchListeners(FlushingDamageEvents);
+
+	// Reset keeps the allocation, so steady-state frames don't touch the allocator
+	FlushingDamageEvents.Reset();
+	FlushingContextTags.Reset();
+}
+
+void UGASC_DamagePipelineSubsystem::BroadcastModification(const FDamageModificationContext& Context)
+{
+	if (Context.DamagePipelineType == Healing)
+	{
+		Internal_BroadcastHealingReceived(Context);
+		Internal_BroadcastHealingApplied(Context);
+	}
+	else
+	{
+		Internal_BroadcastDamageApplied(Context);
+		Internal_BroadcastDamageReceived(Context);
+	}
+}
+
+void UGASC_DamagePipelineSubsystem::BroadcastToBatchListeners(TArrayView<const FDamageModificationContext> Events)
+{
+	for (int32 i = NativeDamageBatchListeners.Num() - 1; i >= 0; --i)
+	{
+		if (!NativeDamageBatchListeners.IsValidIndex(i))
 		{
-			NativeHealingListeners.RemoveAtSwap(i);
 			continue;
 		}
 
-		if (Entry.OnApplied.IsBound())
+		FNativeDamageBatchListener& Entry = NativeDamageBatchListeners[i];
+
+		if (!Entry.Listener.IsValid())
 		{
-			Entry.OnApplied.Execute(Context);
+			NativeDamageBatchListeners.RemoveAtSwap(i);
+			continue;
 		}
-	}
 
-	// 3) Global BP convenience event
-	OnHealingApplied_BP.Broadcast(Context);
+		Entry.OnBatch.ExecuteIfBound(Events);
+	}
 }
 
-void UGASC_DamagePipelineSubsystem::Internal_BroadcastHealingReceived(
-	const FDamageModificationContext& Context)
+void UGASC_DamagePipelineSubsystem::QueueLifestealHeal(AActor* Instigator, const AActor* DamagedTarget, float Amount)
 {
-	// 1) Dynamic per-object listeners
-	for (int32 i = OnHealingReceivedListeners.Num() - 1; i >= 0; --i)
+	if (!Instigator || Amount <= 0.0f)
 	{
-		FOnHealingEventListener& L = OnHealingReceivedListeners[i];
+		return;
+	}
 
-		if (UObject* Obj = L.ListenerActor.Get())
-		{
-			L.Callback.ExecuteIfBound(Context);
-		}
-		else
-		{
-			OnHealingReceivedListeners.RemoveAtSwap(i);
-		}
+	const int32* ExistingSlot = PendingLifestealIndex.Find(FObjectKey(Instigator));
+	const int32 Slot = ExistingSlot ? *ExistingSlot : PendingLifestealHeals.AddDefaulted();
+	FPendingLifestealHeal& Pending = PendingLifestealHeals[Slot];
+
+	if (!ExistingSlot)
+	{
+		Pending.Instigator = Instigator;
+		PendingLifestealIndex.Add(FObjectKey(Instigator), Slot);
+	}
+
+	Pending.TotalHeal += Amount;
+
+#if GASC_WITH_DAMAGE_LOG
+	FDamageLogLifestealSource& Source = Pending.Sources.AddDefaulted_GetRef();
+	Source.Amount = Amount;
+	if (DamagedTarget)
+	{
+		Source.SourceTargetID = DamagedTarget->GetUniqueID();
+		Source.SourceTargetName = DamagedTarget->GetFName();
 	}
+#endif
+}
 
-	// 2) Native listeners
-	for (int32 i = NativeHealingListeners.Num() - 1; i >= 0; --i)
+void UGASC_DamagePipelineSubsystem::FlushPendingLifesteal()
+{
+	if (PendingLifestealHeals.IsEmpty())
 	{
-		FNativeHealingListener& Entry = NativeHealingListeners[i];
+		return;
+	}
 
-		if (!Entry.Listener.IsValid())
+	SCOPED_NAMED_EVENT(DamagePipeline_FlushPendingLifesteal, FColor::Green);
+
+	// Lifesteal triggered by these heals (or by anything they cause) is queued for next frame.
+	Swap(PendingLifestealHeals, FlushingLifestealHeals);
+	PendingLifestealIndex.Reset();
+
+	FDamagePipelineContext HealContext;
+	HealContext.GrantedTags.AddTag(Data_HealingLifeSteal);
+
+	constexpr FDamagePipelineEffectOverTimeContext EffectOverTimeContext;
+
+	for (FPendingLifestealHeal& Pending : FlushingLifestealHeals)
+	{
+		// Instigators that died or were pooled since the hit simply lose the heal
+		if (!Pending.Instigator.IsValid())
+		{
+			continue;
+		}
+
+		FGameplayEffectSpecHandle HealingSpecHandle = ConstructHealingEffectSpecHandle(
+			Pending.Instigator, EGameplayEffectDurationType::Instant, EffectOverTimeContext);
+		if (!HealingSpecHandle.IsValid())
 		{
-			NativeHealingListeners.RemoveAtSwap(i);
 			continue;
 		}
 
-		if (Entry.OnReceived.IsBound())
+#if GASC_WITH_DAMAGE_LOG
+		// The spec owns a fresh context, so the breakdown can be written straight into its log record
+		if (FGASCourseGameplayEffectContext* GASCourseContext =
+			static_cast<FGASCourseGameplayEffectContext*>(HealingSpecHandle.Data->GetEffectContext().Get()))
 		{
-			Entry.OnReceived.Execute(Context);
+			GASCourseContext->DamageLogEntry.LifestealSources = MoveTemp(Pending.Sources);
 		}
+#endif
+
+		ApplyHealToTarget_Internal(Pending.Instigator, Pending.Instigator, Pending.TotalHeal, HealContext, HealingSpecHandle);
 	}
 
-	// 3) Global BP convenience event
-	OnHealingReceived_BP.Broadcast(Context);
+	FlushingLifestealHeals.Reset();
 }
 
 /* ===========================================================================================================
@@ -556,7 +890,8 @@ bool UGASC_DamagePipelineSubsystem::SendHitRequest(const FHitContext& HitContext
 void UGASC_DamagePipelineSubsystem::RegisterActorOnHit(
 	UObject* Listener,
 	EHitEventType HitEvent,
-	FOnHitApplied_Event Callback)
+	FOnHitApplied_Event Callback,
+	AActor* FilterActor)
 {
 	if (!IsValid(Listener) || !Callback.IsBound())
 		return;
@@ -565,20 +900,32 @@ void UGASC_DamagePipelineSubsystem::RegisterActorOnHit(
 	Entry.ListenerActor = Listener;
 	Entry.Callback      = Callback;
 
+	FGASC_DamagePipelineActorBucket* Bucket = FilterActor ? &FindOrAddActorBucket(FilterActor) : nullptr;
+
 	if (HitEvent == OnHitApplied)
 	{
-		OnHitAppliedListeners.Add(Entry);
+		(Bucket ? Bucket->HitAppliedListeners : OnHitAppliedListeners).Add(Entry);
 	}
 	else
 	{
-		OnHitReceivedListeners.Add(Entry);
+		(Bucket ? Bucket->HitReceivedListeners : OnHitReceivedListeners).Add(Entry);
 	}
 }
 
 void UGASC_DamagePipelineSubsystem::UnRegisterActorOnHit(
 	UObject* Listener,
 	EHitEventType HitEvent,
-	FOnHitApplied_Event Callback)
+	FOnHitApplied_Event Callback,
+	AActor* FilterActor)
+{
+	UnRegisterActorOnHitForKey(Listener, HitEvent, Callback.GetFunctionName(), FilterActor ? FObjectKey(FilterActor) : FObjectKey());
+}
+
+void UGASC_DamagePipelineSubsystem::UnRegisterActorOnHitForKey(
+	UObject* Listener,
+	EHitEventType HitEvent,
+	FName CallbackFunctionName,
+	const FObjectKey& FilterKey)
 {
 	if (!IsValid(Listener))
 		return;
@@ -586,9 +933,24 @@ void UGASC_DamagePipelineSubsystem::UnRegisterActorOnHit(
 	auto Match = [&](const FOnHitEventListener& L)
 	{
 		return L.ListenerActor == Listener &&
-			   L.Callback.GetFunctionName() == Callback.GetFunctionName();
+			   L.Callback.GetFunctionName() == CallbackFunctionName;
 	};
 
+	auto RemoveFromBucket = [&](FGASC_DamagePipelineActorBucket& Bucket)
+	{
+		(HitEvent == EHitEventType::OnHitApplied ? Bucket.HitAppliedListeners : Bucket.HitReceivedListeners).RemoveAll(Match);
+	};
+
+	if (FilterKey != FObjectKey())
+	{
+		if (const TSharedPtr<FGASC_DamagePipelineActorBucket> Bucket = FindActorBucket(FilterKey))
+		{
+			RemoveFromBucket(*Bucket);
+			PruneActorBucket(FilterKey);
+		}
+		return;
+	}
+
 	if (HitEvent == EHitEventType::OnHitApplied)
 	{
 		OnHitAppliedListeners.RemoveAll(Match);
@@ -597,6 +959,7 @@ void UGASC_DamagePipelineSubsystem::UnRegisterActorOnHit(
 	{
 		OnHitReceivedListeners.RemoveAll(Match);
 	}
+	RemoveFromAllActorBuckets(RemoveFromBucket);
 }
 
 /* ===========================================================================================================
@@ -606,7 +969,8 @@ void UGASC_DamagePipelineSubsystem::UnRegisterActorOnHit(
 void UGASC_DamagePipelineSubsystem::RegisterActorOnDamageEvent(
 	UObject* Listener,
 	EOnDamageEventType DamageEvent,
-	FOnDamageApplied_Event Callback)
+	FOnDamageApplied_Event Callback,
+	AActor* FilterActor)
 {
 	if (!IsValid(Listener) || !Callback.IsBound())
 		return;
@@ -615,20 +979,23 @@ void UGASC_DamagePipelineSubsystem::RegisterActorOnDamageEvent(
 	Entry.ListenerActor = Listener;
 	Entry.Callback      = Callback;
 
+	FGASC_DamagePipelineActorBucket* Bucket = FilterActor ? &FindOrAddActorBucket(FilterActor) : nullptr;
+
 	if (DamageEvent == OnDamageApplied)
 	{
-		OnDamageAppliedListeners.Add(Entry);
+		(Bucket ? Bucket->DamageAppliedListeners : OnDamageAppliedListeners).Add(Entry);
 	}
 	else
 	{
-		OnDamageReceivedListeners.Add(Entry);
+		(Bucket ? Bucket->DamageReceivedListeners : OnDamageReceivedListeners).Add(Entry);
 	}
 }
 
 void UGASC_DamagePipelineSubsystem::UnRegisterActorOnDamageEvent(
 	UObject* Listener,
 	EOnDamageEventType DamageEvent,
-	FOnDamageApplied_Event Callback)
+	FOnDamageApplied_Event Callback,
+	AActor* FilterActor)
 {
 	if (!IsValid(Listener))
 		return;
@@ -639,6 +1006,21 @@ void UGASC_DamagePipelineSubsystem::UnRegisterActorOnDamageEvent(
 			   L.Callback.GetFunctionName() == Callback.GetFunctionName();
 	};
 
+	auto RemoveFromBucket = [&](FGASC_DamagePipelineActorBucket& Bucket)
+	{
+		(DamageEvent == OnDamageApplied ? Bucket.DamageAppliedListeners : Bucket.DamageReceivedListeners).RemoveAll(Match);
+	};
+
+	if (FilterActor)
+	{
+		if (const TSharedPtr<FGASC_DamagePipelineActorBucket> Bucket = FindActorBucket(FilterActor))
+		{
+			RemoveFromBucket(*Bucket);
+			PruneActorBucket(FilterActor);
+		}
+		return;
+	}
+
 	if (DamageEvent == OnDamageApplied)
 	{
 		OnDamageAppliedListeners.RemoveAll(Match);
@@ -647,6 +1029,7 @@ void UGASC_DamagePipelineSubsystem::UnRegisterActorOnDamageEvent(
 	{
 		OnDamageReceivedListeners.RemoveAll(Match);
 	}
+	RemoveFromAllActorBuckets(RemoveFromBucket);
 }
 
 /* ===========================================================================================================
@@ -656,7 +1039,8 @@ void UGASC_DamagePipelineSubsystem::UnRegisterActorOnDamageEvent(
 void UGASC_DamagePipelineSubsystem::RegisterActorOnHealingEvent(
 	UObject* Listener,
 	EOnHealingEventType HealingEvent,
-	FOnHealingApplied_Event Callback)
+	FOnHealingApplied_Event Callback,
+	AActor* FilterActor)
 {
 	if (!IsValid(Listener) || !Callback.IsBound())
 		return;
@@ -665,20 +1049,23 @@ void UGASC_DamagePipelineSubsystem::RegisterActorOnHealingEvent(
 	Entry.ListenerActor = Listener;
 	Entry.Callback      = Callback;
 
+	FGASC_DamagePipelineActorBucket* Bucket = FilterActor ? &FindOrAddActorBucket(FilterActor) : nullptr;
+
 	if (HealingEvent == OnHealingApplied)
 	{
-		OnHealingAppliedListeners.Add(Entry);
+		(Bucket ? Bucket->HealingAppliedListeners : OnHealingAppliedListeners).Add(Entry);
 	}
 	else  // OnHealingReceived
 	{
-		OnHealingReceivedListeners.Add(Entry);
+		(Bucket ? Bucket->HealingReceivedListeners : OnHealingReceivedListeners).Add(Entry);
 	}
 }
 
 void UGASC_DamagePipelineSubsystem::UnRegisterActorOnHealingEvent(
 	UObject* Listener,
 	EOnHealingEventType HealingEvent,
-	FOnHealingApplied_Event Callback)
+	FOnHealingApplied_Event Callback,
+	AActor* FilterActor)
 {
 	if (!IsValid(Listener))
 		return;
@@ -689,6 +1076,21 @@ void UGASC_DamagePipelineSubsystem::UnRegisterActorOnHealingEvent(
 			   L.Callback.GetFunctionName() == Callback.GetFunctionName();
 	};
 
+	auto RemoveFromBucket = [&](FGASC_DamagePipelineActorBucket& Bucket)
+	{
+		(HealingEvent == EOnHealingEventType::OnHealingApplied ? Bucket.HealingAppliedListeners : Bucket.HealingReceivedListeners).RemoveAll(MatchDynamic);
+	};
+
+	if (FilterActor)
+	{
+		if (const TSharedPtr<FGASC_DamagePipelineActorBucket> Bucket = FindActorBucket(FilterActor))
+		{
+			RemoveFromBucket(*Bucket);
+			PruneActorBucket(FilterActor);
+		}
+		return;
+	}
+
 	if (HealingEvent == EOnHealingEventType::OnHealingApplied)
 	{
 		OnHealingAppliedListeners.RemoveAll(MatchDynamic);
@@ -698,6 +1100,7 @@ void UGASC_DamagePipelineSubsystem::UnRegisterActorOnHealingEvent(
 		OnHealingReceivedListeners.RemoveAll(MatchDynamic);
 		UnregisterNativeHealingListener(Listener);
 	}
+	RemoveFromAllActorBuckets(RemoveFromBucket);
 }
 
 /* ===========================================================================================================
@@ -709,23 +1112,26 @@ void UGASC_DamagePipelineSubsystem::UnregisterOnDamageEventListener(UObject* Lis
 	if (!IsValid(Listener))
 		return;
 
-	OnDamageAppliedListeners.RemoveAll(
-		[&](const FOnDamageEventListener& L)
-		{
-			return L.ListenerActor == Listener;
-		});
+	auto MatchDynamic = [&](const FOnDamageEventListener& L)
+	{
+		return L.ListenerActor == Listener;
+	};
 
-	OnDamageReceivedListeners.RemoveAll(
-		[&](const FOnDamageEventListener& L)
-		{
-			return L.ListenerActor == Listener;
-		});
+	auto MatchNative = [Listener](const FNativeDamageListener& L)
+	{
+		return L.Listener.Get() == Listener;
+	};
 
-	NativeDamageListeners.RemoveAll(
-		[Listener](const FNativeDamageListener& L)
-		{
-			return L.Listener.Get() == Listener;
-		});
+	OnDamageAppliedListeners.RemoveAll(MatchDynamic);
+	OnDamageReceivedListeners.RemoveAll(MatchDynamic);
+	NativeDamageListeners.RemoveAll(MatchNative);
+
+	RemoveFromAllActorBuckets([&](FGASC_DamagePipelineActorBucket& Bucket)
+	{
+		Bucket.DamageAppliedListeners.RemoveAll(MatchDynamic);
+		Bucket.DamageReceivedListeners.RemoveAll(MatchDynamic);
+		Bucket.NativeDamageListeners.RemoveAll(MatchNative);
+	});
 }
 
 void UGASC_DamagePipelineSubsystem::UnregisterOnHealingEventListener(UObject* Listener)
@@ -733,23 +1139,26 @@ void UGASC_DamagePipelineSubsystem::UnregisterOnHealingEventListener(UObject* Li
 	if (!IsValid(Listener))
 		return;
 
-	OnHealingAppliedListeners.RemoveAll(
-		[&](const FOnHealingEventListener& L)
-		{
-			return L.ListenerActor == Listener;
-		});
+	auto MatchDynamic = [&](const FOnHealingEventListener& L)
+	{
+		return L.ListenerActor == Listener;
+	};
 
-	OnHealingReceivedListeners.RemoveAll(
-		[&](const FOnHealingEventListener& L)
-		{
-			return L.ListenerActor == Listener;
-		});
+	auto MatchNative = [Listener](const FNativeHealingListener& L)
+	{
+		return L.Listener.Get() == Listener;
+	};
 
-	NativeHealingListeners.RemoveAll(
-		[Listener](const FNativeHealingListener& L)
-		{
-			return L.Listener.Get() == Listener;
-		});
+	OnHealingAppliedListeners.RemoveAll(MatchDynamic);
+	OnHealingReceivedListeners.RemoveAll(MatchDynamic);
+	NativeHealingListeners.RemoveAll(MatchNative);
+
+	RemoveFromAllActorBuckets([&](FGASC_DamagePipelineActorBucket& Bucket)
+	{
+		Bucket.HealingAppliedListeners.RemoveAll(MatchDynamic);
+		Bucket.HealingReceivedListeners.RemoveAll(MatchDynamic);
+		Bucket.NativeHealingListeners.RemoveAll(MatchNative);
+	});
 }
 
 void UGASC_DamagePipelineSubsystem::UnregisterOnHitEventListener(UObject* Listener)
@@ -757,23 +1166,26 @@ void UGASC_DamagePipelineSubsystem::UnregisterOnHitEventListener(UObject* Listen
 	if (!IsValid(Listener))
 		return;
 
-	OnHitAppliedListeners.RemoveAll(
-		[&](const FOnHitEventListener& L)
-		{
-			return L.ListenerActor == Listener;
-		});
+	auto MatchDynamic = [&](const FOnHitEventListener& L)
+	{
+		return L.ListenerActor == Listener;
+	};
 
-	OnHitReceivedListeners.RemoveAll(
-		[&](const FOnHitEventListener& L)
-		{
-			return L.ListenerActor == Listener;
-		});
+	auto MatchNative = [Listener](const FNativeHitListener& L)
+	{
+		return L.Listener.Get() == Listener;
+	};
 
-	NativeHitListeners.RemoveAll(
-		[Listener](const FNativeHitListener& L)
-		{
-			return L.Listener.Get() == Listener;
-		});
+	OnHitAppliedListeners.RemoveAll(MatchDynamic);
+	OnHitReceivedListeners.RemoveAll(MatchDynamic);
+	NativeHitListeners.RemoveAll(MatchNative);
+
+	RemoveFromAllActorBuckets([&](FGASC_DamagePipelineActorBucket& Bucket)
+	{
+		Bucket.HitAppliedListeners.RemoveAll(MatchDynamic);
+		Bucket.HitReceivedListeners.RemoveAll(MatchDynamic);
+		Bucket.NativeHitListeners.RemoveAll(MatchNative);
+	});
 }
 
 /* ===========================================================================================================
@@ -994,21 +1406,17 @@ bool UGASC_DamagePipelineSubsystem::ApplyDamageToTarget_Internal(
 		DamageSpec->AddDynamicAssetTag(Data_DebugSimulated);
 	}
 	
-	// 1. Get original context
-	FGameplayEffectContextHandle Original = DamageSpec->GetEffectContext();
-
-	// 2. Duplicate into a writable one
-	FGameplayEffectContextHandle NewContext = Original.Duplicate();
-
-	// 3. Modify your custom data
-	FGASCourseGameplayEffectContext* MutableContext =
-		static_cast<FGASCourseGameplayEffectContext*>(NewContext.Get());
+#if GASC_WITH_DAMAGE_LOG
+	// The context is only duplicated to carry the hit into the debug log, and only when there is one
 	if (DamageContext.HitResult.bBlockingHit)
 	{
-		//MutableContext->AddHitResult(DamageContext.HitResult);
-		MutableContext->DamageLogEntry.HitResult = DamageContext.HitResult;
+		FGameplayEffectContextHandle NewContext = DamageSpec->GetEffectContext().Duplicate();
+		FGASCourseGameplayEffectContext* MutableContext =
+			static_cast<FGASCourseGameplayEffectContext*>(NewContext.Get());
+		MutableContext->DamageLogEntry.SetHitResult(DamageContext.HitResult);
 		DamageSpec->SetContext(NewContext);
 	}
+#endif
 
 	// Apply
 	TargetASC->ApplyGameplayEffectSpecToSelf(*DamageSpec);
@@ -1072,20 +1480,17 @@ bool UGASC_DamagePipelineSubsystem::ApplyHealToTarget_Internal(
 	}
 	
 	// 1. Get original context
-	FGameplayEffectContextHandle Original = HealingSpec->GetEffectContext();
-
-	// 2. Duplicate into a writable one
-	FGameplayEffectContextHandle NewContext = Original.Duplicate();
-
-	// 3. Modify your custom data
-	FGASCourseGameplayEffectContext* MutableContext =
-		static_cast<FGASCourseGameplayEffectContext*>(NewContext.Get());
+#if GASC_WITH_DAMAGE_LOG
+	// The context is only duplicated to carry the hit into the debug log, and only when there is one
 	if (HealContext.HitResult.bBlockingHit)
 	{
-		//MutableContext->AddHitResult(DamageContext.HitResult);
-		MutableContext->DamageLogEntry.HitResult = HealContext.HitResult;
+		FGameplayEffectContextHandle NewContext = HealingSpec->GetEffectContext().Duplicate();
+		FGASCourseGameplayEffectContext* MutableContext =
+			static_cast<FGASCourseGameplayEffectContext*>(NewContext.Get());
+		MutableContext->DamageLogEntry.SetHitResult(HealContext.HitResult);
 		HealingSpec->SetContext(NewContext);
 	}
+#endif
 	
 	TargetASC->ApplyGameplayEffectSpecToSelf(*HealingSpec);
 
@@ -59,7 +59,7 @@ FHitResult UGASC_DamagePipelineStatics::GetHitResultCopyFromDamageContext(const
 		: FHitResult();
 }
 
-bool UGASC_DamagePipelineStatics::RegisterActorOnHit(AActor* Listener, EHitEventType HitEvent, FOnHitApplied_Event Callback)
+bool UGASC_DamagePipelineStatics::RegisterActorOnHit(AActor* Listener, EHitEventType HitEvent, FOnHitApplied_Event Callback, AActor* FilterActor)
 {
 	if (!Listener)
 	{
@@ -69,7 +69,7 @@ bool UGASC_DamagePipelineStatics::RegisterActorOnHit(AActor* Listener, EHitEvent
 	{
 		if (UGASC_DamagePipelineSubsystem* DamagePipelineSubsystem = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 		{
-			DamagePipelineSubsystem->RegisterActorOnHit(Listener, HitEvent, Callback);
+			DamagePipelineSubsystem->RegisterActorOnHit(Listener, HitEvent, Callback, FilterActor);
 			return true;
 		}
 	}
@@ -79,7 +79,7 @@ bool UGASC_DamagePipelineStatics::RegisterActorOnHit(AActor* Listener, EHitEvent
 	return false;
 }
 
-bool UGASC_DamagePipelineStatics::UnRegisterActorOnHit(AActor* Listener, EHitEventType HitEvent, FOnHitApplied_Event Callback)
+bool UGASC_DamagePipelineStatics::UnRegisterActorOnHit(AActor* Listener, EHitEventType HitEvent, FOnHitApplied_Event Callback, AActor* FilterActor)
 {
 	if (!Listener)
 	{
@@ -89,7 +89,7 @@ bool UGASC_DamagePipelineStatics::UnRegisterActorOnHit(AActor* Listener, EHitEve
 	{
 		if (UGASC_DamagePipelineSubsystem* DamagePipelineSubsystem = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 		{
-			DamagePipelineSubsystem->UnRegisterActorOnHit(Listener, HitEvent, Callback);
+			DamagePipelineSubsystem->UnRegisterActorOnHit(Listener, HitEvent, Callback, FilterActor);
 			return true;
 		}
 	}
@@ -99,7 +99,7 @@ bool UGASC_DamagePipelineStatics::UnRegisterActorOnHit(AActor* Listener, EHitEve
 	return false;
 }
 
-bool UGASC_DamagePipelineStatics::RegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType DamageEvent, FOnDamageApplied_Event Callback)
+bool UGASC_DamagePipelineStatics::RegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType DamageEvent, FOnDamageApplied_Event Callback, AActor* FilterActor)
 {
 	if (!Listener)
 	{
@@ -109,7 +109,7 @@ bool UGASC_DamagePipelineStatics::RegisterActorOnDamageEvent(UObject* Listener,
 	{
 		if (UGASC_DamagePipelineSubsystem* DamagePipelineSubsystem = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 		{
-			DamagePipelineSubsystem->RegisterActorOnDamageEvent(Listener, DamageEvent, Callback);
+			DamagePipelineSubsystem->RegisterActorOnDamageEvent(Listener, DamageEvent, Callback, FilterActor);
 			return true;
 		}
 	}
@@ -119,7 +119,7 @@ bool UGASC_DamagePipelineStatics::RegisterActorOnDamageEvent(UObject* Listener,
 	return false;
 }
 
-bool UGASC_DamagePipelineStatics::UnRegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType DamageEvent, FOnDamageApplied_Event Callback)
+bool UGASC_DamagePipelineStatics::UnRegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType DamageEvent, FOnDamageApplied_Event Callback, AActor* FilterActor)
 {
 	if (!Listener)
 	{
@@ -129,7 +129,7 @@ bool UGASC_DamagePipelineStatics::UnRegisterActorOnDamageEvent(UObject* Listener
 	{
 		if (UGASC_DamagePipelineSubsystem* DamagePipelineSubsystem = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 		{
-			DamagePipelineSubsystem->UnRegisterActorOnDamageEvent(Listener, DamageEvent, Callback);
+			DamagePipelineSubsystem->UnRegisterActorOnDamageEvent(Listener, DamageEvent, Callback, FilterActor);
 			return true;
 		}
 	}
@@ -139,7 +139,7 @@ bool UGASC_DamagePipelineStatics::UnRegisterActorOnDamageEvent(UObject* Listener
 	return false;
 }
 
-bool UGASC_DamagePipelineStatics::RegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType HealingEvent, FOnHealingApplied_Event Callback)
+bool UGASC_DamagePipelineStatics::RegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType HealingEvent, FOnHealingApplied_Event Callback, AActor* FilterActor)
 {
 	if (!Listener)
 	{
@@ -149,7 +149,7 @@ bool UGASC_DamagePipelineStatics::RegisterActorOnHealingEvent(UObject* Listener,
 	{
 		if (UGASC_DamagePipelineSubsystem* DamagePipelineSubsystem = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 		{
-			DamagePipelineSubsystem->RegisterActorOnHealingEvent(Listener, HealingEvent, Callback);
+			DamagePipelineSubsystem->RegisterActorOnHealingEvent(Listener, HealingEvent, Callback, FilterActor);
 			return true;
 		}
 	}
@@ -159,7 +159,7 @@ bool UGASC_DamagePipelineStatics::RegisterActorOnHealingEvent(UObject* Listener,
 	return false;
 }
 
-bool UGASC_DamagePipelineStatics::UnRegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType HealingEvent, FOnHealingApplied_Event Callback)
+bool UGASC_DamagePipelineStatics::UnRegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType HealingEvent, FOnHealingApplied_Event Callback, AActor* FilterActor)
 {
 	if (!Listener)
 	{
@@ -169,7 +169,7 @@ bool UGASC_DamagePipelineStatics::UnRegisterActorOnHealingEvent(UObject* Listene
 	{
 		if (UGASC_DamagePipelineSubsystem* DamagePipelineSubsystem = World->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 		{
-			DamagePipelineSubsystem->UnRegisterActorOnHealingEvent(Listener, HealingEvent, Callback);
+			DamagePipelineSubsystem->UnRegisterActorOnHealingEvent(Listener, HealingEvent, Callback, FilterActor);
 			return true;
 		}
 	}
@@ -9,7 +9,6 @@
 
 TWeakObjectPtr<APawn> FGASC_ActiveCardEnergyXPHistoryPanel::SelectedPawn = nullptr;
 TWeakObjectPtr<UGASC_ActiveCardResourceManager> FGASC_ActiveCardEnergyXPHistoryPanel::SelectedResourceManager = nullptr;
-TArray<FActiveCardEnergyXPHistoryEntry> FGASC_ActiveCardEnergyXPHistoryPanel::ActiveCardEnergyXPHistoryEntries;
 
 FGASC_ActiveCardEnergyXPHistoryPanel::FGASC_ActiveCardEnergyXPHistoryPanel()
 {
@@ -53,7 +52,6 @@ void FGASC_ActiveCardEnergyXPHistoryPanel::DrawDebugPanel(bool& bOpen)
 
 		if (SelectedPawn.IsValid() && SelectedResourceManager.IsValid())
 		{
-			ActiveCardEnergyXPHistoryEntries = SelectedResourceManager->GetActiveCardEnergyHistory();
 			FString TableId = FString::Printf(TEXT("Active Card Energy XP History ##Table"));
 			auto TableIdANSI = StringCast<ANSICHAR>(*TableId);
 			if (ImGui::BeginTable(TableIdANSI.Get(), 4, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg |
@@ -65,8 +63,10 @@ void FGASC_ActiveCardEnergyXPHistoryPanel::DrawDebugPanel(bool& bOpen)
 				ImGui::TableSetupColumn("Instigator Name");
 				ImGui::TableHeadersRow();
 					
-				for (FActiveCardEnergyXPHistoryEntry& Entry : ActiveCardEnergyXPHistoryEntries)
+				const UGASC_ActiveCardResourceManager* ResourceManager = SelectedResourceManager.Get();
+				for (int32 EntryIndex = 0; EntryIndex < ResourceManager->GetNumActiveCardEnergyXPHistoryEntries(); ++EntryIndex)
 				{
+					const FActiveCardEnergyXPHistoryEntry& Entry = ResourceManager->GetActiveCardEnergyXPHistoryEntry(EntryIndex);
 					ImVec4 green = ImVec4(0.0f, 1.0f, 0.0f, 1.0f);
 					ImVec4 red   = ImVec4(1.0f, 0.0f, 0.0f, 1.0f);
 					ImVec4 white = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
@@ -89,11 +89,11 @@ void FGASC_ActiveCardEnergyXPHistoryPanel::DrawDebugPanel(bool& bOpen)
 					ImGui::TextColored(color,"%.2f", Entry.ActiveCardEnergyXPModifiedValue);
 					if (ImGui::IsItemHovered())
 					{
-						ImGui::SetTooltip("%s", TCHAR_TO_ANSI(*Entry.ModificationToolTip));
+						ImGui::SetTooltip("%s", TCHAR_TO_ANSI(*Entry.GetModificationToolTip()));
 					}
 
 					ImGui::TableNextColumn();
-					FString InstigatorName = Entry.InstigatorName;
+					FString InstigatorName = Entry.InstigatorName.ToString();
 					ImGui::Text("%s", TCHAR_TO_ANSI(*InstigatorName));
 											
 					ImGui::PopID();
@@ -6,6 +6,7 @@
 #include "NavigationSystem.h"
 #include "DrawDebugHelpers.h"
 #include "Game/Systems/WaveManager/GASC_WaveManagerSystemSettings.h"
+#include "Game/Systems/WaveManager/GASC_WaveManagerSubsystem.h"
 #include "Engine/StreamableManager.h"
 #include "Engine/AssetManager.h"
 
@@ -117,8 +118,10 @@ void FGASC_WaveManagerPanel::DrawDebugPanel(bool& bOpen)
 							{
 								FTransform SpawnTransform = FTransform(FRotator(0.0f), NavLoc.Location, FVector(1.0f));
 								DrawDebugSphere(World, NavLoc.Location, 50.0f, 10, FColor::Red, false, 5.0f, 0, 2.0f);
-								EnemyToSpawn = World->SpawnActorDeferred<APawn>(SelectedEnemyToSpawn, SpawnTransform, PlayerCharacter, PlayerCharacter, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
-								EnemyToSpawn->FinishSpawning(SpawnTransform);
+								if (UGASC_WaveManagerSubsystem* WaveManager = World->GetSubsystem<UGASC_WaveManagerSubsystem>())
+								{
+									EnemyToSpawn = WaveManager->SpawnEnemy(SelectedEnemyToSpawn, SpawnTransform);
+								}
 							}
 						}
 					}
@@ -232,10 +232,12 @@ void FGASCDamageEventsPanel::DrawDebugPanel(bool& bOpen)
         ImVec4 tagColor(0, 1, 1, 1);
         ImVec4 attributeColor(1, 1, 0, 1);
 
-        TArray<FDamageLogEntry> DamageEntries = DebugSys->GetDamageLogEntriesForActorID(SelectedPawn->GetUniqueID());
+        TArray<const FDamageLogEntry*> DamageEntries;
+        DebugSys->GetDamageLogEntriesForActorID(SelectedPawn->GetUniqueID(), DamageEntries);
 
-        for (FDamageLogEntry& Entry : DamageEntries)
+        for (const FDamageLogEntry* EntryPtr : DamageEntries)
         {
+            const FDamageLogEntry& Entry = *EntryPtr;
             if ((Entry.bIsDamageEffect && SelectedPipelineType != Damage) ||
                 (!Entry.bIsDamageEffect && SelectedPipelineType != Healing))
                 continue;
@@ -276,7 +278,7 @@ void FGASCDamageEventsPanel::DrawDebugPanel(bool& bOpen)
             float colEnd = ImGui::GetCursorPosX() + ImGui::GetColumnWidth();
             ImGui::PushTextWrapPos(colEnd);
 
-            ImGui::Text("%s: Instigator: %s", TCHAR_TO_ANSI(*Cat), TCHAR_TO_ANSI(*Entry.HitInstigatorName));
+            ImGui::Text("%s: Instigator: %s", TCHAR_TO_ANSI(*Cat), TCHAR_TO_ANSI(*Entry.HitInstigatorName.ToString()));
             ImGui::Text("Instigator Gameplay Tags:");
 
             if (Entry.HitInstigatorTagsContainer.IsEmpty())
@@ -298,7 +300,7 @@ void FGASCDamageEventsPanel::DrawDebugPanel(bool& bOpen)
             colEnd = ImGui::GetCursorPosX() + ImGui::GetColumnWidth();
             ImGui::PushTextWrapPos(colEnd);
 
-            ImGui::Text("%s: Target: %s", TCHAR_TO_ANSI(*Cat), TCHAR_TO_ANSI(*Entry.HitTargetName));
+            ImGui::Text("%s: Target: %s", TCHAR_TO_ANSI(*Cat), TCHAR_TO_ANSI(*Entry.HitTargetName.ToString()));
             ImGui::Text("Target Gameplay Tags:");
 
             if (Entry.HitTargetTagsContainer.IsEmpty())
@@ -362,13 +364,21 @@ void FGASCDamageEventsPanel::DrawDebugPanel(bool& bOpen)
             ImGui::TextColored(modColorV, "Final: %.3f", Entry.FinalDamageValue);
 
             FString AttrText;
-            TArray<FString> AttrNames;
-            Entry.Attributes.GetKeys(AttrNames);
-            for (const FString& N : AttrNames)
-                AttrText += FString::Printf(TEXT("%s: %f\n"), *N, Entry.Attributes.FindChecked(N));
+            for (const FDamageLogAttributeValue& Attr : Entry.Attributes)
+                AttrText += FString::Printf(TEXT("%s: %f\n"), Attr.AttributeProperty ? *Attr.AttributeProperty->GetName() : TEXT("None"), Attr.Value);
 
             ImGui::TextColored(attributeColor, "%s", TCHAR_TO_ANSI(*AttrText));
 
+            // Batched lifesteal: one heal, listed per damaged target it came from
+            if (!Entry.LifestealSources.IsEmpty())
+            {
+                FString LifestealText;
+                for (const FDamageLogLifestealSource& Source : Entry.LifestealSources)
+                    LifestealText += FString::Printf(TEXT("From %s: %.3f\n"), *Source.SourceTargetName.ToString(), Source.Amount);
+
+                ImGui::TextColored(green, "%s", TCHAR_TO_ANSI(*LifestealText));
+            }
+
             ImGui::PopTextWrapPos();
 
             // ================= COLUMN 4: Hit Result =================
@@ -377,19 +387,10 @@ void FGASCDamageEventsPanel::DrawDebugPanel(bool& bOpen)
             ImGui::PushTextWrapPos(colEnd);
 
             FString Tooltip;
-            if (Entry.HitResult.bBlockingHit)
+            if (Entry.bHasHitResult)
             {
-                UScriptStruct* HRStruct = FHitResult::StaticStruct();
-                for (TFieldIterator<FProperty> It(HRStruct); It; ++It)
-                {
-                    FProperty* Prop = *It;
-                    FString Name = Prop->GetName();
-                    const void* ValPtr = Prop->ContainerPtrToValuePtr<void>(&Entry.HitResult);
-
-                    FString Export;
-                    Prop->ExportTextItem_Direct(Export, ValPtr, nullptr, nullptr, PPF_None);
-                    Tooltip += Name + TEXT(": ") + Export + TEXT("\n");
-                }
+                Tooltip = FString::Printf(TEXT("ImpactPoint: %s\nImpactNormal: %s\n"),
+                    *Entry.ImpactPoint.ToString(), *Entry.ImpactNormal.ToString());
             }
             else
             {
@@ -408,7 +409,7 @@ void FGASCDamageEventsPanel::DrawDebugPanel(bool& bOpen)
             ImGui::EndChild();
 
             // ---- Hit Result Options Table ----
-            if (Entry.HitResult.bBlockingHit)
+            if (Entry.bHasHitResult)
             {
                 FString HitOptId = FString::Printf(TEXT("HitResultOptions##%i"), Entry.DamageID);
                 auto HitOptAnsi = StringCast<ANSICHAR>(*HitOptId);
@@ -458,7 +459,7 @@ void FGASCDamageEventsPanel::DrawDebugPanel(bool& bOpen)
 
                         DrawDebugSphere(
                             SelectedPawn->GetWorld(),
-                            Entry.HitResult.Location,
+                            Entry.ImpactPoint,
                             DebugRadius,
                             16,
                             SphereColor);
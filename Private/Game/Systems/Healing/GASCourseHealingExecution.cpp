@@ -71,8 +71,9 @@ void UGASCourseHealingExecution::Execute_Implementation(
 	{
 		return;
 	}
-	GASCourseContext->DamageLogEntry.HitInstigatorName = SourceActor->GetName();
-	GASCourseContext->DamageLogEntry.HitTargetName = TargetActor->GetName();
+#if GASC_WITH_DAMAGE_LOG
+	GASCourseContext->DamageLogEntry.HitInstigatorName = SourceActor->GetFName();
+	GASCourseContext->DamageLogEntry.HitTargetName = TargetActor->GetFName();
 	GASCourseContext->DamageLogEntry.HitInstigatorTagsContainer.AppendTags(Spec.CapturedSourceTags.GetActorTags());
 	GASCourseContext->DamageLogEntry.HitTargetTagsContainer.AppendTags(Spec.CapturedTargetTags.GetActorTags());
 	GASCourseContext->DamageLogEntry.HitContextTagsContainer.AddTag(DamageType_Healing);
@@ -82,6 +83,7 @@ void UGASCourseHealingExecution::Execute_Implementation(
 	}
 	GASCourseContext->DamageLogEntry.DamageInstigatorID = SourceActor->GetUniqueID();
 	GASCourseContext->DamageLogEntry.DamageTargetID = TargetActor->GetUniqueID();
+#endif
 
 	// ==========================
 	// 1. BASE HEAL AMOUNT
@@ -93,7 +95,9 @@ void UGASCourseHealingExecution::Execute_Implementation(
 		0.0f);
 
 	// If still zero or negative → hard early out, no need to calculate anything else
+#if GASC_WITH_DAMAGE_LOG
 	GASCourseContext->DamageLogEntry.BaseDamageValue = Healing;
+#endif
 	if (Healing <= 0.f)
 	{
 		return;
@@ -119,8 +123,9 @@ void UGASCourseHealingExecution::Execute_Implementation(
 	float AllHealingCoefficient = 0.0f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
 		HealingStatics().AllDamageHealingCoefficientDef, EvalParams, AllHealingCoefficient);
-	GASCourseContext->DamageLogEntry.Attributes.Add(HealingStatics().AllDamageHealingCoefficientProperty->GetName(), 
-	AllHealingCoefficient);
+#if GASC_WITH_DAMAGE_LOG
+	GASCourseContext->DamageLogEntry.AddAttribute(HealingStatics().AllDamageHealingCoefficientProperty, AllHealingCoefficient);
+#endif
 	
 	float ElementalHealingCoefficient = 0.0f;
 	float PhysicalHealingCoefficient  = 0.0f;
@@ -131,16 +136,18 @@ void UGASCourseHealingExecution::Execute_Implementation(
 		{
 			ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
 				HealingStatics().ElementalDamageHealingCoefficientDef, EvalParams, ElementalHealingCoefficient);
-			GASCourseContext->DamageLogEntry.Attributes.Add(HealingStatics().ElementalDamageHealingCoefficientProperty->GetName(), 
-			ElementalHealingCoefficient);
+#if GASC_WITH_DAMAGE_LOG
+			GASCourseContext->DamageLogEntry.AddAttribute(HealingStatics().ElementalDamageHealingCoefficientProperty, ElementalHealingCoefficient);
+#endif
 		}
 
 		if (bHasPhysical)
 		{
 			ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
 				HealingStatics().PhysicalDamageHealingCoefficientDef, EvalParams, PhysicalHealingCoefficient);
-			GASCourseContext->DamageLogEntry.Attributes.Add(HealingStatics().PhysicalDamageHealingCoefficientProperty->GetName(), 
-			PhysicalHealingCoefficient);
+#if GASC_WITH_DAMAGE_LOG
+			GASCourseContext->DamageLogEntry.AddAttribute(HealingStatics().PhysicalDamageHealingCoefficientProperty, PhysicalHealingCoefficient);
+#endif
 		}
 	}
 
@@ -181,7 +188,9 @@ void UGASCourseHealingExecution::Execute_Implementation(
 		? FMath::CeilToFloat(TotalHealing)
 		: FMath::FloorToFloat(TotalHealing);
 	
+#if GASC_WITH_DAMAGE_LOG
 	GASCourseContext->DamageLogEntry.ModifiedDamageValue = TotalHealing;
+#endif
 
 	// ==========================
 	// 6. APPLY TO ATTRIBUTE
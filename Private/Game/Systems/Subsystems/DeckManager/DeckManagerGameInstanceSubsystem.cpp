@@ -2,7 +2,75 @@
 
 
 #include "Game/Systems/Subsystems/DeckManager/DeckManagerGameInstanceSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
+void UDeckManagerGameInstanceSubsystem::Deinitialize()
+{
+	for (TPair<FName, TSharedPtr<FStreamableHandle>>& CardDataHandle : CardDataHandles)
+	{
+		if (CardDataHandle.Value.IsValid())
+		{
+			CardDataHandle.Value->ReleaseHandle();
+		}
+	}
+	CardDataHandles.Empty();
+	Decks.Empty();
 
+	Super::Deinitialize();
+}
 
+FGASC_DeckEngine& UDeckManagerGameInstanceSubsystem::FindOrAddDeck(FName DeckId, bool& bOutCreated)
+{
+	bOutCreated = false;
+	if (FGASC_DeckEngine* Deck = Decks.Find(DeckId))
+	{
+		return *Deck;
+	}
 
+	bOutCreated = true;
+	return Decks.Add(DeckId);
+}
+
+FGASC_DeckEngine* UDeckManagerGameInstanceSubsystem::FindDeck(FName DeckId)
+{
+	return Decks.Find(DeckId);
+}
+
+void UDeckManagerGameInstanceSubsystem::RemoveDeck(FName DeckId)
+{
+	Decks.Remove(DeckId);
+
+	TSharedPtr<FStreamableHandle> CardDataHandle;
+	if (CardDataHandles.RemoveAndCopyValue(DeckId, CardDataHandle) && CardDataHandle.IsValid())
+	{
+		CardDataHandle->ReleaseHandle();
+	}
+}
+
+void UDeckManagerGameInstanceSubsystem::PreloadCardData(FName DeckId)
+{
+	const FGASC_DeckEngine* Deck = Decks.Find(DeckId);
+	if (!Deck)
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> CardDataPaths;
+	Deck->GatherCardDataPaths(CardDataPaths);
+	if (CardDataPaths.IsEmpty())
+	{
+		return;
+	}
+
+	// The new handle is requested before the old one is released so cards already resident stay loaded
+	FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle> CardDataHandle = StreamableManager.RequestAsyncLoad(CardDataPaths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+
+	TSharedPtr<FStreamableHandle>& ExistingHandle = CardDataHandles.FindOrAdd(DeckId);
+	if (ExistingHandle.IsValid())
+	{
+		ExistingHandle->ReleaseHandle();
+	}
+	ExistingHandle = CardDataHandle;
+}
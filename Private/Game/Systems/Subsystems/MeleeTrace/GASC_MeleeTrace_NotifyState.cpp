@@ -14,16 +14,15 @@ void UGASC_MeleeTrace_NotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp,
 		UGASC_MeleeTrace_Subsystem* MeleeTrace_Subsystem = NotifyWorld->GetSubsystem<UGASC_MeleeTrace_Subsystem>();
 		if (MeleeTrace_Subsystem)
 		{
-			MeleeTraceNotifyID = FGuid::NewGuid();
-			if (MeleeTraceNotifyID.IsValid() && !MeleeTrace_Subsystem->IsMeleeTraceInProgress(MeleeTraceNotifyID))
+			if (!MeleeTrace_Subsystem->IsNotifyMeleeTraceInProgress(MeshComp, this))
 			{
 				if (MeleeTraceRowHandle.DataTable != nullptr)
 				{
 					if (FGASC_MeleeTrace_TraceShapeData* RowData = MeleeTraceRowHandle.GetRow<FGASC_MeleeTrace_TraceShapeData>("Context"))
 					{
-						MeleeTraceSubsystemData = MeleeTrace_Subsystem->CreateShapeDataFromRow(*RowData);
-						MeleeTraceSubsystemData.HitCooldownTime = HitCooldown;
-						MeleeTrace_Subsystem->RequestShapeMeleeTrace(MeshComp->GetOwner(), MeleeTraceSubsystemData, MeleeTraceNotifyID);
+						FGASC_MeleeTrace_Subsystem_Data TraceData = MeleeTrace_Subsystem->CreateShapeDataFromRow(*RowData);
+						TraceData.HitCooldownTime = HitCooldown;
+						MeleeTrace_Subsystem->BeginNotifyMeleeTrace(MeshComp, this, TraceData);
 					}
 				}
 			}
@@ -179,10 +178,7 @@ void UGASC_MeleeTrace_NotifyState::NotifyEnd(USkeletalMeshComponent* MeshComp, U
 		UGASC_MeleeTrace_Subsystem* MeleeTrace_Subsystem = NotifyWorld->GetSubsystem<UGASC_MeleeTrace_Subsystem>();
 		if (MeleeTrace_Subsystem)
 		{
-			if (MeleeTraceNotifyID.IsValid() && MeleeTrace_Subsystem->IsMeleeTraceInProgress(MeleeTraceNotifyID))
-			{
-				MeleeTrace_Subsystem->CancelMeleeTrace(MeleeTraceNotifyID);
-			}
+			MeleeTrace_Subsystem->EndNotifyMeleeTrace(MeshComp, this);
 		}
 	}
 
@@ -200,11 +196,7 @@ FGASC_MeleeTrace_Subsystem_Data UGASC_MeleeTrace_NotifyState::CreateShapeDataFro
 	TraceData.TraceDensity = RowData.TraceDensity;
 	TraceData.TraceSocket_Start = RowData.StartSocket;
 	TraceData.TraceSocket_End = RowData.EndSocket;
-	TraceData.HitActors.Reset();
-	TraceData.PreviousFrameSamples.Reset();
-	TraceData.TraceId = FGuid::NewGuid();
-	TraceData.InstigatorActor = nullptr;
-	TraceData.SourceMeshComponent = nullptr;
+	TraceData.ExecutionMode = RowData.ExecutionMode;
 	
 	switch (RowData.TraceShape)
 	{
@@ -6,8 +6,11 @@
 #include "Game/Systems/Subsystems/MeleeTrace/Shapes/GASC_MeleeShape_Base.h"
 #include "DrawDebugHelpers.h"
 #include "CollisionQueryParams.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Misc/MemStack.h"
 #include "Game/Systems/Damage/Pipeline/GASC_DamagePipelineSubsystem.h"
 #include "AbilitySystemComponent.h"
+#include "Game/GameplayAbilitySystem/GASCourseAbilitySystemComponent.h"
 #include "GASCourse/GASCourseCharacter.h"
 #include "NativeGameplayTags.h"
 #include "Game/GameplayAbilitySystem/GASCourseNativeGameplayTags.h"
@@ -43,10 +46,19 @@ void UGASC_MeleeTrace_Subsystem::Tick(float DeltaTime)
 	}
 
 	Super::Tick(DeltaTime);
-	if (MeleeTraceRequests.Num() > 0)
+	if (MeleeTraceHotData.Num() > 0)
 	{
 		ProcessMeleeTraces(DeltaTime);
 	}
+
+	for (const TWeakObjectPtr<UGASCourseAbilitySystemComponent>& TargetASC : HitReactionTargetASCs)
+	{
+		if (UGASCourseAbilitySystemComponent* ASC = TargetASC.Get())
+		{
+			ASC->FlushGameplayEventQueue();
+		}
+	}
+	HitReactionTargetASCs.Reset();
 }
 
 void UGASC_MeleeTrace_Subsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -57,10 +69,13 @@ void UGASC_MeleeTrace_Subsystem::Initialize(FSubsystemCollectionBase& Collection
 void UGASC_MeleeTrace_Subsystem::Deinitialize()
 {
 	Super::Deinitialize();
-	if (!MeleeTraceRequests.IsEmpty())
-	{
-		MeleeTraceRequests.Empty();
-	}
+	MeleeTraceHotData.Empty();
+	MeleeTraceColdData.Empty();
+	MeleeTraceDenseToSlot.Empty();
+	MeleeTraceSlots.Empty();
+	FreeMeleeTraceSlots.Empty();
+	NotifyMeleeTraces.Empty();
+	HitReactionTargetASCs.Empty();
 }
 
 bool UGASC_MeleeTrace_Subsystem::ShouldCreateSubsystem(UObject* Outer) const
@@ -78,6 +93,9 @@ void UGASC_MeleeTrace_Subsystem::OnWorldBeginPlay(UWorld& InWorld)
 	Super::OnWorldBeginPlay(InWorld);
 	MeleeTraceSettings = GetDefault<UGASC_MeleeSubsystem_Settings>();
 	check(MeleeTraceSettings);
+
+	// The object types come from project settings and do not change while the world is playing
+	MeleeTraceObjectParams = ConfigureCollisionObjectParams(MeleeTraceSettings->CollisionObjectTypes);
 }
 
 void UGASC_MeleeTrace_Subsystem::DrawDebugMeleeTrace(const UObject* WorldContextObject,
@@ -407,69 +425,219 @@ void UGASC_MeleeTrace_Subsystem::DrawDebugSweptBox(const UWorld* InWorld, FVecto
 	::DrawDebugBox(InWorld, End, HalfSize, CapsuleRot, Color, bPersistentLines, LifeTime, DepthPriority);
 }
 
-void UGASC_MeleeTrace_Subsystem::RequestShapeMeleeTrace(AActor* Instigator, FGASC_MeleeTrace_Subsystem_Data TraceData, FGuid TraceId)
+FGASC_MeleeTraceHandle UGASC_MeleeTrace_Subsystem::RequestShapeMeleeTrace(AActor* Instigator, FGASC_MeleeTrace_Subsystem_Data TraceData)
 {
-	FGASC_MeleeTrace_Subsystem_Data NewMeleeTraceRequest = TraceData;
-	NewMeleeTraceRequest.TraceId = TraceId;
-	NewMeleeTraceRequest.InstigatorActor = Instigator;
-	NewMeleeTraceRequest.TraceCollisionShape = NewMeleeTraceRequest.TraceShape->CreateCollisionShape();
-	NewMeleeTraceRequest.SourceMeshComponent = GetMeshComponent(Instigator, NewMeleeTraceRequest);
-	NewMeleeTraceRequest.SwingStartTime = GetWorld()->GetTimeSeconds();
-	NewMeleeTraceRequest.PerActorHitStamps.Reset();
-
-	GetTraceSamples(NewMeleeTraceRequest.SourceMeshComponent.Get(), TraceData.TraceDensity,
-		NewMeleeTraceRequest.TraceSocket_Start,
-		NewMeleeTraceRequest.TraceSocket_End,
-		NewMeleeTraceRequest.PreviousFrameSamples);
-	
-	MeleeTraceRequests.Add(NewMeleeTraceRequest);
+	FGASC_MeleeTraceHandle TraceHandle;
+	if (!Instigator || !TraceData.TraceShape)
+	{
+		UE_LOGFMT(LOG_GASC_MeleeTraceSubsystem, Warning, "Invalid instigator or trace shape passed through {0}", __FUNCTION__);
+		return TraceHandle;
+	}
+
+	int32 SlotIndex;
+	if (!FreeMeleeTraceSlots.IsEmpty())
+	{
+		SlotIndex = FreeMeleeTraceSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotIndex = MeleeTraceSlots.AddDefaulted();
+	}
+
+	const int32 DenseIndex = MeleeTraceHotData.AddDefaulted();
+	MeleeTraceColdData.AddDefaulted();
+	MeleeTraceDenseToSlot.Add(SlotIndex);
+
+	FMeleeTraceSlot& Slot = MeleeTraceSlots[SlotIndex];
+	Slot.DenseIndex = DenseIndex;
+
+	FGASC_MeleeTrace_HotData& HotData = MeleeTraceHotData[DenseIndex];
+	HotData.SourceMeshComponent = GetMeshComponent(Instigator, TraceData);
+	HotData.TraceCollisionShape = TraceData.TraceShape->CreateCollisionShape();
+	HotData.TraceSocket_Start = TraceData.TraceSocket_Start;
+	HotData.TraceSocket_End = TraceData.TraceSocket_End;
+	HotData.TraceDensity = TraceData.TraceDensity;
+
+	EGASC_MeleeTrace_ExecutionMode ExecutionMode = TraceData.ExecutionMode;
+	if (ExecutionMode == EGASC_MeleeTrace_ExecutionMode::ProjectDefault)
+	{
+		const UGASC_MeleeSubsystem_Settings* Settings = GetDefault<UGASC_MeleeSubsystem_Settings>();
+		ExecutionMode = Settings ? Settings->DefaultExecutionMode : EGASC_MeleeTrace_ExecutionMode::Synchronous;
+	}
+	HotData.bAsyncTrace = ExecutionMode == EGASC_MeleeTrace_ExecutionMode::Asynchronous;
+
+	FGASC_MeleeTrace_ColdData& ColdData = MeleeTraceColdData[DenseIndex];
+	ColdData.InstigatorActor = Instigator;
+	ColdData.SwingStartTime = GetWorld()->GetTimeSeconds();
+	ColdData.HitCooldownTime = TraceData.HitCooldownTime;
+
+	TArray<FVector> InitialSamples;
+	GetTraceSamples(HotData.SourceMeshComponent.Get(), HotData.TraceDensity,
+		HotData.TraceSocket_Start,
+		HotData.TraceSocket_End,
+		InitialSamples);
+	HotData.PreviousFrameSamples = InitialSamples;
+
+	TraceHandle.Index = SlotIndex;
+	TraceHandle.Generation = Slot.Generation;
+	return TraceHandle;
+}
+
+bool UGASC_MeleeTrace_Subsystem::IsMeleeTraceInProgress(FGASC_MeleeTraceHandle TraceHandle) const
+{
+	const int32 DenseIndex = ResolveMeleeTraceHandle(TraceHandle);
+	return DenseIndex != INDEX_NONE && !MeleeTraceHotData[DenseIndex].bCancelRequested;
 }
 
-bool UGASC_MeleeTrace_Subsystem::IsMeleeTraceInProgress(FGuid TraceId)
+bool UGASC_MeleeTrace_Subsystem::CancelMeleeTrace(FGASC_MeleeTraceHandle TraceHandle)
 {
-	for (const FGASC_MeleeTrace_Subsystem_Data& MeleeTraceRequest : MeleeTraceRequests)
+	const int32 DenseIndex = ResolveMeleeTraceHandle(TraceHandle);
+	if (DenseIndex == INDEX_NONE || MeleeTraceHotData[DenseIndex].bCancelRequested)
 	{
-		if (MeleeTraceRequest.TraceId == TraceId)
-		{
-			return true;
-		}
+		return false;
 	}
-	
-	return false;
+
+	// Let in-flight async sweeps land so the tail end of the swing can still hit.
+	// Cancels raised from hit callbacks are deferred too, so the processing loop's indices stay put.
+	if (bProcessingMeleeTraces || !MeleeTraceColdData[DenseIndex].PendingAsyncSweeps.IsEmpty())
+	{
+		MeleeTraceHotData[DenseIndex].bCancelRequested = true;
+	}
+	else
+	{
+		RemoveMeleeTraceAt(DenseIndex);
+	}
+	return true;
 }
 
-bool UGASC_MeleeTrace_Subsystem::CancelMeleeTrace(FGuid TraceId)
+bool UGASC_MeleeTrace_Subsystem::IsNotifyMeleeTraceInProgress(const USkeletalMeshComponent* MeshComp, const UObject* Notify) const
 {
-	bool bCanceledByUser = false;
+	const FGASC_MeleeTraceHandle* TraceHandle = NotifyMeleeTraces.Find({MeshComp, Notify});
+	return TraceHandle && IsMeleeTraceInProgress(*TraceHandle);
+}
+
+FGASC_MeleeTraceHandle UGASC_MeleeTrace_Subsystem::BeginNotifyMeleeTrace(USkeletalMeshComponent* MeshComp, const UObject* Notify,
+	const FGASC_MeleeTrace_Subsystem_Data& TraceData)
+{
+	if (!MeshComp || !Notify)
+	{
+		return FGASC_MeleeTraceHandle();
+	}
 
-	for (int32 i = MeleeTraceRequests.Num() - 1; i >= 0; --i)
+	const FGASC_MeleeTrace_NotifyKey Key{MeshComp, Notify};
+	if (const FGASC_MeleeTraceHandle* ExistingHandle = NotifyMeleeTraces.Find(Key))
 	{
-		if (MeleeTraceRequests[i].TraceId == TraceId)
+		if (IsMeleeTraceInProgress(*ExistingHandle))
 		{
-			MeleeTraceRequests.RemoveAt(i);
-			bCanceledByUser = true;
+			return *ExistingHandle;
 		}
 	}
-	return bCanceledByUser;
+	else
+	{
+		// Only sweeps when the map would grow; drops entries whose trace finished without its notify ending
+		for (auto It = NotifyMeleeTraces.CreateIterator(); It; ++It)
+		{
+			if (!IsMeleeTraceInProgress(It->Value))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	const FGASC_MeleeTraceHandle TraceHandle = RequestShapeMeleeTrace(MeshComp->GetOwner(), TraceData);
+	if (TraceHandle.IsValid())
+	{
+		NotifyMeleeTraces.Add(Key, TraceHandle);
+	}
+	else
+	{
+		NotifyMeleeTraces.Remove(Key);
+	}
+	return TraceHandle;
+}
+
+void UGASC_MeleeTrace_Subsystem::EndNotifyMeleeTrace(const USkeletalMeshComponent* MeshComp, const UObject* Notify)
+{
+	FGASC_MeleeTraceHandle TraceHandle;
+	if (NotifyMeleeTraces.RemoveAndCopyValue({MeshComp, Notify}, TraceHandle))
+	{
+		CancelMeleeTrace(TraceHandle);
+	}
+}
+
+int32 UGASC_MeleeTrace_Subsystem::ResolveMeleeTraceHandle(const FGASC_MeleeTraceHandle& TraceHandle) const
+{
+	if (!MeleeTraceSlots.IsValidIndex(TraceHandle.Index))
+	{
+		return INDEX_NONE;
+	}
+
+	const FMeleeTraceSlot& Slot = MeleeTraceSlots[TraceHandle.Index];
+	return Slot.Generation == TraceHandle.Generation ? Slot.DenseIndex : INDEX_NONE;
+}
+
+void UGASC_MeleeTrace_Subsystem::RemoveMeleeTraceAt(int32 DenseIndex)
+{
+	const int32 SlotIndex = MeleeTraceDenseToSlot[DenseIndex];
+	const int32 LastIndex = MeleeTraceHotData.Num() - 1;
+
+	// The last element moves into DenseIndex, so its slot has to follow it
+	if (DenseIndex != LastIndex)
+	{
+		MeleeTraceSlots[MeleeTraceDenseToSlot[LastIndex]].DenseIndex = DenseIndex;
+	}
+
+	MeleeTraceHotData.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	MeleeTraceColdData.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	MeleeTraceDenseToSlot.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+
+	FMeleeTraceSlot& Slot = MeleeTraceSlots[SlotIndex];
+	Slot.DenseIndex = INDEX_NONE;
+	++Slot.Generation;
+	FreeMeleeTraceSlots.Add(SlotIndex);
 }
 
 void UGASC_MeleeTrace_Subsystem::ProcessMeleeTraces(float DeltaTime)
 {
 	const bool bShouldDrawDebug = GASCourse_MeleeSubSystemCVars::CvarEnableMeleeTracesDebug.GetValueOnGameThread();
 	TRACE_CPUPROFILER_EVENT_SCOPE(ProcessMeleeTraces);
-	FCollisionObjectQueryParams ObjectParams = ConfigureCollisionObjectParams(MeleeTraceSettings->CollisionObjectTypes);
-	for (int32 i = MeleeTraceRequests.Num() - 1; i >= 0; --i)
+	const FCollisionObjectQueryParams& ObjectParams = MeleeTraceObjectParams;
+
+	/*
+	 * Walk backwards so swap-removal only ever moves an already-processed element into the current index.
+	 * Hit callbacks can start new traces (appended, possibly reallocating) or cancel them (deferred), so anything
+	 * used after HandleMeleeTraceHits is re-fetched by index rather than held by reference.
+	 */
+	TGuardValue<bool> ProcessingGuard(bProcessingMeleeTraces, true);
+
+	// Sample arrays come from the frame's linear allocator and are released in one go when the mark unwinds
+	FMemMark MemMark(FMemStack::Get());
+	TArray<FVector, TMemStackAllocator<>> TraceSamples;
+	SocketLocationCache.Reset();
+
+	for (int32 i = MeleeTraceHotData.Num() - 1; i >= 0; --i)
 	{
-		FGASC_MeleeTrace_Subsystem_Data& ActiveMeleeTraceRequest = MeleeTraceRequests[i];
-		if (!ActiveMeleeTraceRequest.InstigatorActor || ActiveMeleeTraceRequest.SourceMeshComponent == nullptr)
+		// Per-frame results (actors set persists across frames so each trace hits an actor once)
+		MeleeTraceColdData[i].HitResults_PreviousFrames.Reset();
+
+		// Last frame's async sweeps resolve before anything new is issued, so dedupe order matches the sync path
+		if (!MeleeTraceColdData[i].PendingAsyncSweeps.IsEmpty())
+		{
+			ResolveAsyncMeleeSweeps(i, bShouldDrawDebug);
+		}
+
+		FGASC_MeleeTrace_HotData& HotData = MeleeTraceHotData[i];
+		if (HotData.bCancelRequested)
 		{
-			MeleeTraceRequests.RemoveAt(i);
+			RemoveMeleeTraceAt(i);
 			continue;
 		}
-		UMeshComponent* SourceMeshComponent = ActiveMeleeTraceRequest.SourceMeshComponent.Get();
-		if (!SourceMeshComponent)
+
+		AActor* InstigatorActor = MeleeTraceColdData[i].InstigatorActor.Get();
+		UMeshComponent* SourceMeshComponent = HotData.SourceMeshComponent.Get();
+		if (!InstigatorActor || !SourceMeshComponent)
 		{
-			MeleeTraceRequests.RemoveAtSwap(i);
+			RemoveMeleeTraceAt(i);
 			continue;
 		}
 		
@@ -477,27 +645,34 @@ void UGASC_MeleeTrace_Subsystem::ProcessMeleeTraces(float DeltaTime)
 		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MeleeTrace), false);
 		QueryParams.bReturnPhysicalMaterial = true;
 		QueryParams.bReturnFaceIndex = true;
-		QueryParams.AddIgnoredActor(ActiveMeleeTraceRequest.InstigatorActor);
+		QueryParams.AddIgnoredActor(InstigatorActor);
 		
-		TArray<FVector> TraceSamples;
-		GetTraceSamples(
-			SourceMeshComponent,
-			ActiveMeleeTraceRequest.TraceDensity,
-			ActiveMeleeTraceRequest.TraceSocket_Start,
-			ActiveMeleeTraceRequest.TraceSocket_End,
-			TraceSamples);
+		const FVector StartSampleLocation = GetCachedSocketLocation(SourceMeshComponent, HotData.TraceSocket_Start);
+		const FVector EndSampleLocation = GetCachedSocketLocation(SourceMeshComponent, HotData.TraceSocket_End);
+		const int32 TraceDensity = FMath::Max(HotData.TraceDensity, 1);
+		TraceSamples.Reset(TraceDensity + 1);
+		for (int32 Index = 0; Index <= TraceDensity; Index++)
+		{
+			const float Alpha = static_cast<float>(Index) / static_cast<float>(TraceDensity);
+			TraceSamples.Add(FMath::Lerp(StartSampleLocation, EndSampleLocation, Alpha));
+		}
 		
-		if (ActiveMeleeTraceRequest.PreviousFrameSamples.Num() != TraceSamples.Num())
+		if (HotData.PreviousFrameSamples.Num() != TraceSamples.Num())
 		{
-			ActiveMeleeTraceRequest.PreviousFrameSamples = TraceSamples;
+			HotData.PreviousFrameSamples.Reset();
+			HotData.PreviousFrameSamples.Append(TraceSamples);
 		}
+
+		// Copied out so the sweep loop never reads through HotData once a hit callback may have moved it
+		TArray<FVector, TMemStackAllocator<>> PreviousFrameSamples;
+		PreviousFrameSamples.Append(HotData.PreviousFrameSamples);
+		const FCollisionShape TraceCollisionShape = HotData.TraceCollisionShape;
+		const bool bAsyncTrace = HotData.bAsyncTrace;
 		
-		// Per-frame results (actors list persists across frames so each trace hits an actor once)
-		ActiveMeleeTraceRequest.HitResults_PreviousFrames.Reset();
 		constexpr float MAX_SUBSTEP_DISTANCE = 50.0f;
 		for (int32 SampleIndex = 0; SampleIndex < TraceSamples.Num(); ++SampleIndex)
 		{
-			const FVector& PrevSample = ActiveMeleeTraceRequest.PreviousFrameSamples[SampleIndex];
+			const FVector& PrevSample = PreviousFrameSamples[SampleIndex];
 			const FVector& CurrSample = TraceSamples[SampleIndex];
 			
 			// Direction of motion for this sample
@@ -528,22 +703,41 @@ void UGASC_MeleeTrace_Subsystem::ProcessMeleeTraces(float DeltaTime)
 				{
 					Rotation = SourceMeshComponent->GetComponentQuat();
 				}
+
+				if (bAsyncTrace)
+				{
+					// Results are read back next frame in ResolveAsyncMeleeSweeps
+					FGASC_MeleeTrace_PendingSweep& PendingSweep = MeleeTraceColdData[i].PendingAsyncSweeps.AddDefaulted_GetRef();
+					PendingSweep.Handle = GetWorld()->AsyncSweepByObjectType(
+						EAsyncTraceType::Multi,
+						P1,
+						P2,
+						Rotation,
+						ObjectParams,
+						TraceCollisionShape,
+						QueryParams);
+					PendingSweep.Start = P1;
+					PendingSweep.End = P2;
+					PendingSweep.Rotation = Rotation;
+					continue;
+				}
 				
-				TArray<FHitResult> HitResults;
+				TArray<FHitResult>& HitResults = SweepHitScratch;
+				HitResults.Reset();
 				const bool bHit = GetWorld()->SweepMultiByObjectType(
 					HitResults,
 					P1,
 					P2,
 					Rotation,
 					ObjectParams,
-					ActiveMeleeTraceRequest.TraceCollisionShape,
+					TraceCollisionShape,
 					QueryParams);
 
 				if (bShouldDrawDebug)
 				{
 					DrawDebugMeleeTrace(
-						ActiveMeleeTraceRequest.InstigatorActor,
-						ActiveMeleeTraceRequest.TraceCollisionShape,
+						InstigatorActor,
+						TraceCollisionShape,
 						FTransform(Rotation, P1),
 						FTransform(Rotation, P2),
 						bHit,
@@ -554,87 +748,151 @@ void UGASC_MeleeTrace_Subsystem::ProcessMeleeTraces(float DeltaTime)
 				{
 					continue;
 				}
-				
-				for (const FHitResult& Hit : HitResults)
+
+				HandleMeleeTraceHits(i, HitResults);
+			}
+		}
+
+		// Next frame sweeps from where the samples are now
+		TArray<FVector, TInlineAllocator<8>>& NextPreviousFrameSamples = MeleeTraceHotData[i].PreviousFrameSamples;
+		NextPreviousFrameSamples.Reset();
+		NextPreviousFrameSamples.Append(TraceSamples);
+	}
+}
+
+void UGASC_MeleeTrace_Subsystem::ResolveAsyncMeleeSweeps(int32 DenseIndex, bool bShouldDrawDebug)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ResolveAsyncMeleeSweeps);
+
+	UWorld* World = GetWorld();
+	const bool bCanApplyHits = MeleeTraceColdData[DenseIndex].InstigatorActor.IsValid();
+	const FCollisionShape TraceCollisionShape = MeleeTraceHotData[DenseIndex].TraceCollisionShape;
+	// Swap into scratch rather than moving out, so both buffers keep their capacity for the next frame
+	Swap(ResolvingAsyncSweeps, MeleeTraceColdData[DenseIndex].PendingAsyncSweeps);
+	MeleeTraceColdData[DenseIndex].PendingAsyncSweeps.Reset();
+
+	FTraceDatum& TraceDatum = TraceDatumScratch;
+	for (const FGASC_MeleeTrace_PendingSweep& PendingSweep : ResolvingAsyncSweeps)
+	{
+		if (!World->QueryTraceData(PendingSweep.Handle, TraceDatum))
+		{
+			continue;
+		}
+
+		const bool bHit = TraceDatum.OutHits.Num() > 0;
+		if (bShouldDrawDebug)
+		{
+			DrawDebugMeleeTrace(
+				World,
+				TraceCollisionShape,
+				FTransform(PendingSweep.Rotation, PendingSweep.Start),
+				FTransform(PendingSweep.Rotation, PendingSweep.End),
+				bHit,
+				TraceDatum.OutHits);
+		}
+
+		if (bHit && bCanApplyHits)
+		{
+			HandleMeleeTraceHits(DenseIndex, TraceDatum.OutHits);
+		}
+	}
+
+	ResolvingAsyncSweeps.Reset();
+}
+
+FVector UGASC_MeleeTrace_Subsystem::GetCachedSocketLocation(const UMeshComponent* MeshComponent, const FName& SocketName)
+{
+	const FGASC_MeleeTrace_SocketKey Key{MeshComponent, SocketName};
+	if (const FVector* CachedLocation = SocketLocationCache.Find(Key))
+	{
+		return *CachedLocation;
+	}
+
+	return SocketLocationCache.Add(Key, MeshComponent->GetSocketLocation(SocketName));
+}
+
+void UGASC_MeleeTrace_Subsystem::HandleMeleeTraceHits(int32 DenseIndex, const TArray<FHitResult>& HitResults)
+{
+	for (const FHitResult& Hit : HitResults)
+	{
+		// Re-fetched per hit: the gameplay events below can start new traces and grow the dense arrays
+		FGASC_MeleeTrace_ColdData& ColdData = MeleeTraceColdData[DenseIndex];
+		AActor* HitActor = Hit.GetActor();
+		if (!HitActor)
+		{
+			continue;
+		}
+	
+		float CurrentTime = GetWorld()->GetTimeSeconds();
+		if (ColdData.HitCooldownTime > 0.0f)
+		{
+			if (float* LastHitPtr = ColdData.PerActorHitStamps.Find(HitActor))
+			{
+				if (CurrentTime - *LastHitPtr < ColdData.HitCooldownTime)
 				{
-					AActor* HitActor = Hit.GetActor();
-					if (!HitActor)
-					{
-						continue;
-					}
-				
-					float CurrentTime = GetWorld()->GetTimeSeconds();
-					if (ActiveMeleeTraceRequest.HitCooldownTime > 0.0f)
-					{
-						if (float* LastHitPtr = ActiveMeleeTraceRequest.PerActorHitStamps.Find(HitActor))
-						{
-							if (CurrentTime - *LastHitPtr < ActiveMeleeTraceRequest.HitCooldownTime)
-							{
-								continue;
-							}
-						}
-					}
-				
-					if (ActiveMeleeTraceRequest.HitActors_PreviousFrames.Contains(HitActor))
-					{
-						continue;
-					}
-				
-					// Record this actor as hit at this moment
-					ActiveMeleeTraceRequest.PerActorHitStamps.Add(HitActor, CurrentTime);
-				
-					// Mark actor as hit (prevents multiple hits per request)
-					ActiveMeleeTraceRequest.HitActors_PreviousFrames.Add(HitActor);
-				
-					// Save hit for debug or gameplay processing later
-					ActiveMeleeTraceRequest.HitResults_PreviousFrames.Add(Hit);
-				
-					// -- Apply damage / gameplay events once per actor per trace request --
-					if (auto* InstigatorCharacter = Cast<AGASCourseCharacter>(ActiveMeleeTraceRequest.InstigatorActor))
+					continue;
+				}
+			}
+		}
+	
+		// Mark actor as hit (prevents multiple hits per request)
+		bool bAlreadyHit = false;
+		ColdData.HitActors.Add(HitActor, &bAlreadyHit);
+		if (bAlreadyHit)
+		{
+			continue;
+		}
+	
+		// Record this actor as hit at this moment
+		ColdData.PerActorHitStamps.Add(HitActor, CurrentTime);
+	
+		// Save hit for debug or gameplay processing later
+		ColdData.HitResults_PreviousFrames.Add(Hit);
+	
+		// -- Apply damage / gameplay events once per actor per trace request --
+		if (auto* InstigatorCharacter = Cast<AGASCourseCharacter>(ColdData.InstigatorActor.Get()))
+		{
+			if (auto* InstigatorASC = Cast<UGASCourseAbilitySystemComponent>(InstigatorCharacter->GetAbilitySystemComponent()))
+			{
+				if (auto* TargetCharacter = Cast<AGASCourseCharacter>(HitActor))
+				{
+					if (auto* TargetASC = Cast<UGASCourseAbilitySystemComponent>(TargetCharacter->GetAbilitySystemComponent()))
 					{
-						if (auto* InstigatorASC = Cast<UGASCourseAbilitySystemComponent>(InstigatorCharacter->GetAbilitySystemComponent()))
+						// Damage pipeline (only once per actor)
+						if (auto* DamageSubsystem = GetWorld()->GetSubsystem<UGASC_DamagePipelineSubsystem>())
 						{
-							if (auto* TargetCharacter = Cast<AGASCourseCharacter>(HitActor))
-							{
-								if (auto* TargetASC = Cast<UGASCourseAbilitySystemComponent>(TargetCharacter->GetAbilitySystemComponent()))
-								{
-									// Damage pipeline (only once per actor)
-									if (auto* DamageSubsystem = GetWorld()->GetSubsystem<UGASC_DamagePipelineSubsystem>())
-									{
-										FHitContext HitContext;
-										HitContext.HitTarget = TargetCharacter;
-										HitContext.HitInstigator = InstigatorCharacter;
-										HitContext.OptionalSourceObject = nullptr;
-										HitContext.HitTargetTagsContainer = &TargetASC->GetOwnedGameplayTags();
-										HitContext.HitInstigatorTagsContainer = &InstigatorASC->GetOwnedGameplayTags();
-										HitContext.HitContextTagsContainer = &FGameplayTagContainer::EmptyContainer;
-										HitContext.HitResult = Hit;
-										HitContext.HitTimeStamp = GetWorld()->GetTimeSeconds();
-
-										DamageSubsystem->OnHitEvent(HitContext);
-									}
-								
-									// Gameplay event data
-									FGameplayEventData OnHitPayload;
-									OnHitPayload.Instigator = InstigatorCharacter;
-									OnHitPayload.Target = HitActor;
-
-									auto* TargetDataHit = new FGameplayAbilityTargetData_SingleTargetHit(Hit);
-									OnHitPayload.TargetData.Add(TargetDataHit);
-
-									OnHitPayload.InstigatorTags.AppendTags(InstigatorASC->GetOwnedGameplayTags());
-									OnHitPayload.TargetTags.AppendTags(TargetASC->GetOwnedGameplayTags());
-
-									// Notify instigator
-									InstigatorASC->HandleGameplayEvent(Event_Gameplay_OnHit, &OnHitPayload);
-
-									// Notify target
-									OnHitPayload.EventTag = Event_Gameplay_Reaction_OnHit;
-									OnHitPayload.InstigatorTags.AddTag(Reaction_OnHit);
-									TargetASC->SendGameplayEventAsync(Event_Gameplay_OnHit, OnHitPayload);
-								}
-							}
+							FHitContext HitContext;
+							HitContext.HitTarget = TargetCharacter;
+							HitContext.HitInstigator = InstigatorCharacter;
+							HitContext.OptionalSourceObject = nullptr;
+							HitContext.HitTargetTagsContainer = &TargetASC->GetOwnedGameplayTags();
+							HitContext.HitInstigatorTagsContainer = &InstigatorASC->GetOwnedGameplayTags();
+							HitContext.HitContextTagsContainer = &FGameplayTagContainer::EmptyContainer;
+							HitContext.HitResult = Hit;
+							HitContext.HitTimeStamp = GetWorld()->GetTimeSeconds();
+
+							DamageSubsystem->OnHitEvent(HitContext);
 						}
+					
+						// Gameplay event data
+						FGameplayEventData OnHitPayload;
+						OnHitPayload.Instigator = InstigatorCharacter;
+						OnHitPayload.Target = HitActor;
+
+						auto* TargetDataHit = new FGameplayAbilityTargetData_SingleTargetHit(Hit);
+						OnHitPayload.TargetData.Add(TargetDataHit);
+
+						OnHitPayload.InstigatorTags.AppendTags(InstigatorASC->GetOwnedGameplayTags());
+						OnHitPayload.TargetTags.AppendTags(TargetASC->GetOwnedGameplayTags());
+
+						// Notify instigator
+						InstigatorASC->HandleGameplayEvent(Event_Gameplay_OnHit, &OnHitPayload);
+
+						// Notify target
+						OnHitPayload.EventTag = Event_Gameplay_Reaction_OnHit;
+						OnHitPayload.InstigatorTags.AddTag(Reaction_OnHit);
+						TargetASC->QueueGameplayEvent(Event_Gameplay_OnHit, MoveTemp(OnHitPayload), true);
+						HitReactionTargetASCs.AddUnique(TargetASC);
 					}
 				}
 			}
@@ -645,18 +903,10 @@ void UGASC_MeleeTrace_Subsystem::ProcessMeleeTraces(float DeltaTime)
 FCollisionObjectQueryParams UGASC_MeleeTrace_Subsystem::ConfigureCollisionObjectParams(
 	const TArray<TEnumAsByte<EObjectTypeQuery>>& ObjectTypes)
 {
-	TArray<TEnumAsByte<ECollisionChannel>> CollisionObjectTraces;
-	CollisionObjectTraces.AddUninitialized(ObjectTypes.Num());
-
-	for (auto Iter = ObjectTypes.CreateConstIterator(); Iter; ++Iter)
-	{
-		CollisionObjectTraces[Iter.GetIndex()] = UEngineTypes::ConvertToCollisionChannel(*Iter);
-	}
-
 	FCollisionObjectQueryParams ObjectParams;
-	for (auto Iter = CollisionObjectTraces.CreateConstIterator(); Iter; ++Iter)
+	for (const TEnumAsByte<EObjectTypeQuery>& ObjectType : ObjectTypes)
 	{
-		const ECollisionChannel & Channel = (*Iter);
+		const ECollisionChannel Channel = UEngineTypes::ConvertToCollisionChannel(ObjectType);
 		if (FCollisionObjectQueryParams::IsValidObjectQuery(Channel))
 		{
 			ObjectParams.AddObjectTypesToQuery(Channel);
@@ -744,11 +994,7 @@ FGASC_MeleeTrace_Subsystem_Data UGASC_MeleeTrace_Subsystem::CreateShapeDataFromR
 	TraceData.TraceDensity = RowData.TraceDensity;
 	TraceData.TraceSocket_Start = RowData.StartSocket;
 	TraceData.TraceSocket_End = RowData.EndSocket;
-	TraceData.HitActors.Reset();
-	TraceData.PreviousFrameSamples.Reset();
-	TraceData.TraceId = FGuid::NewGuid();
-	TraceData.InstigatorActor = nullptr;
-	TraceData.SourceMeshComponent = nullptr;
+	TraceData.ExecutionMode = RowData.ExecutionMode;
 	
 	switch (RowData.TraceShape)
 	{
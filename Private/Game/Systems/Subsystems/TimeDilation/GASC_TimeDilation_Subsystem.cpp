@@ -3,6 +3,8 @@
 
 #include "Game/Systems/Subsystems/TimeDilation/GASC_TimeDilation_Subsystem.h"
 #include "Kismet/GameplayStatics.h"
+#include "Curves/CurveFloat.h"
+#include "AlphaBlend.h"
 
 
 void UGASC_TimeDilation_Subsystem::Tick(float DeltaTime)
@@ -31,13 +33,45 @@ void UGASC_TimeDilation_Subsystem::Tick(float DeltaTime)
 void UGASC_TimeDilation_Subsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+#if WITH_EDITOR
+	ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddUObject(this, &ThisClass::OnObjectModified);
+#endif
 }
 
 void UGASC_TimeDilation_Subsystem::Deinitialize()
 {
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	ObjectModifiedHandle.Reset();
+#endif
+
+	StopAllTimeDilationRequests();
+	CurveLUTCache.Empty();
 	Super::Deinitialize();
 }
 
+#if WITH_EDITOR
+void UGASC_TimeDilation_Subsystem::OnObjectModified(UObject* Object)
+{
+	const UCurveFloat* Curve = Cast<UCurveFloat>(Object);
+	if (!Curve || CurveLUTCache.IsEmpty())
+	{
+		return;
+	}
+
+	// Modify() runs before the edit lands, so the next request rebakes from the edited keys
+	const TObjectKey<UCurveFloat> CurveKey(Curve);
+	for (auto It = CurveLUTCache.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Curve == CurveKey)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+#endif
+
 void UGASC_TimeDilation_Subsystem::OnWorldBeginPlay(UWorld& InWorld)
 {
 	Super::OnWorldBeginPlay(InWorld);
@@ -46,179 +80,190 @@ void UGASC_TimeDilation_Subsystem::OnWorldBeginPlay(UWorld& InWorld)
 
 void UGASC_TimeDilation_Subsystem::AddGlobalHitStopWithData(FGASC_TimeDilation_Subsystem_Data HitStopData)
 {
+	AddGlobalTimeDilation(MoveTemp(HitStopData));
+}
+
+void UGASC_TimeDilation_Subsystem::AddGlobalTimeDilation(FGASC_TimeDilation_Subsystem_Data&& HitStopData)
+{
+	PrepareHitStop(HitStopData);
 	if (ActiveGlobalTimeDilation)
 	{
 		if (HitStopData.Priority >= ActiveGlobalTimeDilation->Priority)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("HitStopData has higher priority than active global hit stop! Replacing"));
 			delete ActiveGlobalTimeDilation;
-			ActiveGlobalTimeDilation = new FGASC_TimeDilation_Subsystem_Data(HitStopData);
+			ActiveGlobalTimeDilation = new FGASC_TimeDilation_Subsystem_Data(MoveTemp(HitStopData));
 		}
 	}
 	else
 	{
-		GlobalTimeDilationQueue.Enqueue(FGASC_TimeDilation_Subsystem_Data(HitStopData));
+		GlobalTimeDilationQueue.Enqueue(MoveTemp(HitStopData));
 	}
 }
 
 void UGASC_TimeDilation_Subsystem::AddLocalHitStopWithData(FGASC_TimeDilation_Subsystem_Data HitStopData, TArray<AActor*> AffectedActors)
 {
-	HitStopData.AffectedActors = AffectedActors;
-	if (ActiveLocalTimeDilation)
-	{
-		if (HitStopData.Priority >= ActiveLocalTimeDilation->Priority)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("HitStopData has higher priority than active global hit stop! Replacing"));
-			delete ActiveLocalTimeDilation;
-			ActiveLocalTimeDilation = new FGASC_TimeDilation_Subsystem_Data(HitStopData);
-		}
-	}
-	else
-	{
-		LocalTimeDilationQueue.Enqueue(FGASC_TimeDilation_Subsystem_Data(HitStopData));
-	}
+	AddLocalTimeDilationChannel(MoveTemp(HitStopData), AffectedActors);
 }
 
 void UGASC_TimeDilation_Subsystem::AddGlobalHitStopWithCurve(float TimeDilationDuration, float TimeDilationMinValue,
 	EAlphaBlendOption AlphaBlendOption, UCurveFloat* Curve, EGASC_TimeDilation_Priority Priority)
 {
-	if (ActiveGlobalTimeDilation)
-	{
-		if (Priority >= ActiveGlobalTimeDilation->Priority)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("HitStopData has higher priority than active global hit stop! Replacing"));
-			delete ActiveGlobalTimeDilation;
-			
-			FGASC_TimeDilation_Subsystem_Data HitStopData;
-			
-			HitStopData.TimeDilationDuration = TimeDilationDuration;
-			HitStopData.TimeDilation = TimeDilationMinValue;
-			HitStopData.BlendMode = AlphaBlendOption;
-			HitStopData.CustomTimeDilationCurve = Curve;
-			HitStopData.bUseTimeDilationCurve = true;
-			HitStopData.Priority = Priority;
-			
-			ActiveGlobalTimeDilation = new FGASC_TimeDilation_Subsystem_Data(HitStopData);
-		}
-	}
-	else
-	{
-		FGASC_TimeDilation_Subsystem_Data HitStopData;
-		
-		HitStopData.TimeDilationDuration = TimeDilationDuration;
-		HitStopData.TimeDilation = TimeDilationMinValue;
-		HitStopData.BlendMode = AlphaBlendOption;
-		HitStopData.CustomTimeDilationCurve = Curve;
-		HitStopData.bUseTimeDilationCurve = true;
-		HitStopData.Priority = Priority;
-		
-		GlobalTimeDilationQueue.Enqueue(FGASC_TimeDilation_Subsystem_Data(HitStopData));
-	}
+	FGASC_TimeDilation_Subsystem_Data HitStopData;
+	
+	HitStopData.TimeDilationDuration = TimeDilationDuration;
+	HitStopData.TimeDilation = TimeDilationMinValue;
+	HitStopData.BlendMode = AlphaBlendOption;
+	HitStopData.CustomTimeDilationCurve = Curve;
+	HitStopData.bUseTimeDilationCurve = true;
+	HitStopData.Priority = Priority;
+	
+	AddGlobalTimeDilation(MoveTemp(HitStopData));
 }
 
 void UGASC_TimeDilation_Subsystem::AddLocalHitStopWithCurve(TArray<AActor*> AffectedActors, float TimeDilationDuration, float TimeDilationMinValue,
 	EAlphaBlendOption AlphaBlendOption, UCurveFloat* Curve, EGASC_TimeDilation_Priority Priority)
 {
-	if (ActiveLocalTimeDilation)
+	FGASC_TimeDilation_Subsystem_Data HitStopData;
+	
+	HitStopData.TimeDilationDuration = TimeDilationDuration;
+	HitStopData.TimeDilation = TimeDilationMinValue;
+	HitStopData.BlendMode = AlphaBlendOption;
+	HitStopData.CustomTimeDilationCurve = Curve;
+	HitStopData.bUseTimeDilationCurve = true;
+	HitStopData.Priority = Priority;
+	
+	AddLocalTimeDilationChannel(MoveTemp(HitStopData), AffectedActors);
+}
+
+void UGASC_TimeDilation_Subsystem::AddGlobalHitStop(float TimeDilationDuration, float TimeDilationMinValue, EGASC_TimeDilation_Priority Priority)
+{
+	FGASC_TimeDilation_Subsystem_Data HitStopData;
+	
+	HitStopData.TimeDilationDuration = TimeDilationDuration;
+	HitStopData.TimeDilation = TimeDilationMinValue;
+	HitStopData.bUseTimeDilationCurve = false;
+	HitStopData.Priority = Priority;
+	
+	AddGlobalTimeDilation(MoveTemp(HitStopData));
+}
+
+void UGASC_TimeDilation_Subsystem::AddLocalHitStop(TArray<AActor*> AffectedActors, float TimeDilationDuration, float TimeDilationMinValue, EGASC_TimeDilation_Priority Priority)
+{
+	FGASC_TimeDilation_Subsystem_Data HitStopData;
+	
+	HitStopData.TimeDilationDuration = TimeDilationDuration;
+	HitStopData.TimeDilation = TimeDilationMinValue;
+	HitStopData.bUseTimeDilationCurve = false;
+	HitStopData.Priority = Priority;
+	
+	AddLocalTimeDilationChannel(MoveTemp(HitStopData), AffectedActors);
+}
+
+void UGASC_TimeDilation_Subsystem::AddLocalTimeDilationChannel(FGASC_TimeDilation_Subsystem_Data&& HitStopData, const TArray<AActor*>& AffectedActors)
+{
+	HitStopData.AffectedActors.Reset(AffectedActors.Num());
+	for (AActor* AffectedActor : AffectedActors)
 	{
-		if (Priority >= ActiveLocalTimeDilation->Priority)
+		if (AffectedActor)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("HitStopData has higher priority than active global hit stop! Replacing"));
-			delete ActiveLocalTimeDilation;
-			
-			FGASC_TimeDilation_Subsystem_Data HitStopData;
-			
-			HitStopData.TimeDilationDuration = TimeDilationDuration;
-			HitStopData.TimeDilation = TimeDilationMinValue;
-			HitStopData.BlendMode = AlphaBlendOption;
-			HitStopData.CustomTimeDilationCurve = Curve;
-			HitStopData.bUseTimeDilationCurve = true;
-			HitStopData.Priority = Priority;
-			HitStopData.AffectedActors = AffectedActors;
-			
-			ActiveLocalTimeDilation = new FGASC_TimeDilation_Subsystem_Data(HitStopData);
+			HitStopData.AffectedActors.AddUnique(AffectedActor);
 		}
 	}
-	else
+
+	if (HitStopData.AffectedActors.IsEmpty())
 	{
-		FGASC_TimeDilation_Subsystem_Data HitStopData;
-		
-		HitStopData.TimeDilationDuration = TimeDilationDuration;
-		HitStopData.TimeDilation = TimeDilationMinValue;
-		HitStopData.BlendMode = AlphaBlendOption;
-		HitStopData.CustomTimeDilationCurve = Curve;
-		HitStopData.bUseTimeDilationCurve = true;
-		HitStopData.Priority = Priority;
-		HitStopData.AffectedActors = AffectedActors;
-		
-		LocalTimeDilationQueue.Enqueue(FGASC_TimeDilation_Subsystem_Data(HitStopData));
+		return;
 	}
+
+	PrepareHitStop(HitStopData);
+	ActiveLocalTimeDilations.Add(MoveTemp(HitStopData));
 }
 
-void UGASC_TimeDilation_Subsystem::AddGlobalHitStop(float TimeDilationDuration, float TimeDilationMinValue, EGASC_TimeDilation_Priority Priority)
+void UGASC_TimeDilation_Subsystem::PrepareHitStop(FGASC_TimeDilation_Subsystem_Data& HitStopData)
 {
-	if (ActiveGlobalTimeDilation)
+	HitStopData.ElapsedTime = 0.0f;
+	HitStopData.CurveLUT.Reset();
+	if (!HitStopData.bUseTimeDilationCurve)
 	{
-		if (Priority >= ActiveGlobalTimeDilation->Priority)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("HitStopData has higher priority than active global hit stop! Replacing"));
-			delete ActiveGlobalTimeDilation;
-			
-			FGASC_TimeDilation_Subsystem_Data HitStopData;
-			
-			HitStopData.TimeDilationDuration = TimeDilationDuration;
-			HitStopData.TimeDilation = TimeDilationMinValue;
-			HitStopData.bUseTimeDilationCurve = false;
-			HitStopData.Priority = Priority;
-			
-			ActiveGlobalTimeDilation = new FGASC_TimeDilation_Subsystem_Data(HitStopData);
-		}
+		return;
 	}
-	else
+
+	// A curve with no explicit duration plays over the curve's own length
+	if (HitStopData.CustomTimeDilationCurve && HitStopData.TimeDilationDuration == 0.0f)
 	{
-		FGASC_TimeDilation_Subsystem_Data HitStopData;
-		
-		HitStopData.TimeDilationDuration = TimeDilationDuration;
-		HitStopData.TimeDilation = TimeDilationMinValue;
-		HitStopData.bUseTimeDilationCurve = false;
-		HitStopData.Priority = Priority;
-		
-		GlobalTimeDilationQueue.Enqueue(FGASC_TimeDilation_Subsystem_Data(HitStopData));
+		const TArray<FRichCurveKey>& Keys = HitStopData.CustomTimeDilationCurve->FloatCurve.GetConstRefOfKeys();
+		if (Keys.Num() > 0)
+		{
+			HitStopData.TimeDilationDuration = Keys.Last().Time;
+		}
 	}
+
+	HitStopData.CurveLUT = FindOrBakeCurveLUT(HitStopData);
 }
 
-void UGASC_TimeDilation_Subsystem::AddLocalHitStop(TArray<AActor*> AffectedActors, float TimeDilationDuration, float TimeDilationMinValue, EGASC_TimeDilation_Priority Priority)
+TSharedPtr<const FGASC_TimeDilation_CurveLUT> UGASC_TimeDilation_Subsystem::FindOrBakeCurveLUT(const FGASC_TimeDilation_Subsystem_Data& HitStopData)
 {
-	if (ActiveLocalTimeDilation)
+	// A curve overrides the blend mode, so curve tables are keyed on the curve alone; without one, requests share one
+	// table per blend/duration
+	const UCurveFloat* Curve = HitStopData.CustomTimeDilationCurve;
+	const EAlphaBlendOption BlendMode = Curve ? EAlphaBlendOption::Custom : HitStopData.BlendMode;
+
+	// Roughly one sample per 120Hz frame, so interpolation error stays below what a single tick can show.
+	// Rounded up to a power of two so every duration lands on one of five table sizes.
+	constexpr float SamplesPerSecond = 120.0f;
+	constexpr int32 MinSamples = 16;
+	constexpr int32 MaxSamples = 256;
+	const int32 NumSamples = HitStopData.TimeDilationDuration > 0.0f ?
+		FMath::Clamp(static_cast<int32>(FMath::RoundUpToPowerOfTwo(FMath::CeilToInt32(HitStopData.TimeDilationDuration * SamplesPerSecond) + 1)), MinSamples, MaxSamples) : MinSamples;
+
+	const FCurveLUTKey Key{Curve, BlendMode, NumSamples};
+	if (const TSharedPtr<const FGASC_TimeDilation_CurveLUT>* CachedLUT = CurveLUTCache.Find(Key))
 	{
-		if (Priority >= ActiveLocalTimeDilation->Priority)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("HitStopData has higher priority than active global hit stop! Replacing"));
-			delete ActiveLocalTimeDilation;
-			
-			FGASC_TimeDilation_Subsystem_Data HitStopData;
-			
-			HitStopData.TimeDilationDuration = TimeDilationDuration;
-			HitStopData.TimeDilation = TimeDilationMinValue;
-			HitStopData.bUseTimeDilationCurve = false;
-			HitStopData.Priority = Priority;
-			HitStopData.AffectedActors = AffectedActors;
-			
-			ActiveLocalTimeDilation = new FGASC_TimeDilation_Subsystem_Data(HitStopData);
-		}
+		return *CachedLUT;
 	}
-	else
+
+	// Bounded for projects that feed many distinct curves through here; dropping the cache only costs a rebake
+	constexpr int32 MaxCachedLUTs = 64;
+	if (CurveLUTCache.Num() >= MaxCachedLUTs)
 	{
-		FGASC_TimeDilation_Subsystem_Data HitStopData;
-		
-		HitStopData.TimeDilationDuration = TimeDilationDuration;
-		HitStopData.TimeDilation = TimeDilationMinValue;
-		HitStopData.bUseTimeDilationCurve = false;
-		HitStopData.Priority = Priority;
-		HitStopData.AffectedActors = AffectedActors;
-		
-		LocalTimeDilationQueue.Enqueue(FGASC_TimeDilation_Subsystem_Data(HitStopData));
+		CurveLUTCache.Reset();
+	}
+
+	// Curves are retimed over their own key range rather than having their keys edited to fit the duration
+	float CurveMinTime = 0.0f;
+	float CurveMaxTime = 1.0f;
+	if (Curve)
+	{
+		Curve->FloatCurve.GetTimeRange(CurveMinTime, CurveMaxTime);
+	}
+
+	TSharedRef<FGASC_TimeDilation_CurveLUT> NewLUT = MakeShared<FGASC_TimeDilation_CurveLUT>();
+	NewLUT->Samples.SetNumUninitialized(NumSamples);
+	for (int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		const float Alpha = static_cast<float>(Index) / static_cast<float>(NumSamples - 1);
+		NewLUT->Samples[Index] = Curve ?
+			Curve->GetFloatValue(FMath::Lerp(CurveMinTime, CurveMaxTime, Alpha)) :
+			FAlphaBlend::AlphaToBlendOption(Alpha, BlendMode, nullptr);
 	}
+
+	CurveLUTCache.Add(Key, NewLUT);
+	return NewLUT;
+}
+
+float UGASC_TimeDilation_Subsystem::EvaluateHitStopTimeDilation(const FGASC_TimeDilation_Subsystem_Data& HitStopData)
+{
+	if (!HitStopData.bUseTimeDilationCurve || !HitStopData.CurveLUT.IsValid())
+	{
+		return HitStopData.TimeDilation;
+	}
+
+	// Infinite hit stops (negative duration) run their curve over one second and then hold the last value
+	const float CurveDuration = HitStopData.TimeDilationDuration > 0.0f ? HitStopData.TimeDilationDuration : 1.0f;
+	const float CurveValue = HitStopData.CurveLUT->Evaluate(HitStopData.ElapsedTime / CurveDuration);
+
+	return FMath::GetMappedRangeValueClamped(FVector2D(0.0f, 1.0f), FVector2D(HitStopData.TimeDilation, 1.0f), CurveValue);
 }
 
 void UGASC_TimeDilation_Subsystem::StopAllTimeDilationRequests()
@@ -240,152 +285,102 @@ void UGASC_TimeDilation_Subsystem::StopAllGlobalTimeDilationRequests()
 
 void UGASC_TimeDilation_Subsystem::StopAllLocalTimeDilationRequests()
 {
-	if (ActiveLocalTimeDilation)
+	for (const TPair<TWeakObjectPtr<AActor>, FResolvedLocalTimeDilation>& Resolved : ResolvedLocalTimeDilations)
 	{
-		for (AActor* AffectedActor : ActiveLocalTimeDilation->AffectedActors)
+		if (AActor* AffectedActor = Resolved.Key.Get())
 		{
-			if (AffectedActor)
-			{
-				AffectedActor->CustomTimeDilation = 1.0f;
-			}
+			AffectedActor->CustomTimeDilation = 1.0f;
 		}
-		delete ActiveLocalTimeDilation;
-		ActiveLocalTimeDilation = nullptr;
 	}
+
+	ResolvedLocalTimeDilations.Reset();
+	PreviousResolvedLocalTimeDilations.Reset();
+	ActiveLocalTimeDilations.Reset();
 }
 
 void UGASC_TimeDilation_Subsystem::ProcessLocalHitStops(float DeltaTime)
 {
-	if (ActiveLocalTimeDilation)
+	if (ActiveLocalTimeDilations.IsEmpty() && ResolvedLocalTimeDilations.IsEmpty())
 	{
-		if (ActiveLocalTimeDilation->AffectedActors.Num() == 0)
-		{
-			delete ActiveLocalTimeDilation;
-			ActiveLocalTimeDilation = nullptr;
-			return;
-		}
-		for (int32 i = ActiveLocalTimeDilation->AffectedActors.Num() - 1; i >= 0; i--)
-		{
-			AActor* AffectedActor = ActiveLocalTimeDilation->AffectedActors[i];
-			if (!AffectedActor)
-			{
-				ActiveLocalTimeDilation->AffectedActors.RemoveAt(i);
-			}
-		}
-		
-		float ScaledDeltaTime = DeltaTime; // Provided during Tick or gameplay
-		float GlobalTimeDilation = UGameplayStatics::GetGlobalTimeDilation(GetWorld());
-		if (GlobalTimeDilation <= KINDA_SMALL_NUMBER)
+		return;
+	}
+
+	float GlobalTimeDilation = UGameplayStatics::GetGlobalTimeDilation(GetWorld());
+	if (GlobalTimeDilation <= KINDA_SMALL_NUMBER)
+	{
+		GlobalTimeDilation = 1.0f;
+	}
+	const float UnscaledDeltaTime = DeltaTime / GlobalTimeDilation;
+
+	// Last frame's winners become the "previous" set; anything not re-resolved this frame is released back to 1.0
+	Swap(ResolvedLocalTimeDilations, PreviousResolvedLocalTimeDilations);
+	ResolvedLocalTimeDilations.Reset();
+
+	for (int32 i = ActiveLocalTimeDilations.Num() - 1; i >= 0; --i)
+	{
+		FGASC_TimeDilation_Subsystem_Data& HitStop = ActiveLocalTimeDilations[i];
+		HitStop.AffectedActors.RemoveAllSwap([](const TWeakObjectPtr<AActor>& AffectedActor) { return !AffectedActor.IsValid(); }, EAllowShrinking::No);
+
+		const float ChannelTimeDilation = EvaluateHitStopTimeDilation(HitStop);
+		HitStop.ElapsedTime += UnscaledDeltaTime;
+
+		// A channel that finishes this frame no longer contributes, so its actors are released this same tick
+		const bool bExpired = HitStop.TimeDilationDuration > 0.0f && HitStop.ElapsedTime >= HitStop.TimeDilationDuration;
+		if (bExpired || HitStop.AffectedActors.IsEmpty())
 		{
-			GlobalTimeDilation = 1.0f;
+			ActiveLocalTimeDilations.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
 		}
-		const float UnscaledDeltaTime = ScaledDeltaTime / GlobalTimeDilation;
 
-		if (ActiveLocalTimeDilation->bUseTimeDilationCurve)
+		for (const TWeakObjectPtr<AActor>& AffectedActor : HitStop.AffectedActors)
 		{
-			if (ActiveLocalTimeDilation->CustomTimeDilationCurve && ActiveLocalTimeDilation->TimeDilationDuration > 0.0f)
+			FResolvedLocalTimeDilation* Resolved = ResolvedLocalTimeDilations.Find(AffectedActor);
+			if (!Resolved)
 			{
-				const TArray<FRichCurveKey>& Keys = ActiveLocalTimeDilation->CustomTimeDilationCurve->FloatCurve.GetConstRefOfKeys();
-				if (Keys.Num() > 0)
-				{
-					ActiveLocalTimeDilation->TimeDilationDuration =
-						ActiveLocalTimeDilation->TimeDilationDuration < 0.0f ? ActiveLocalTimeDilation->TimeDilationDuration : Keys.Last().Time;
-				}
+				ResolvedLocalTimeDilations.Add(AffectedActor, {HitStop.Priority, ChannelTimeDilation});
 			}
-			
-			float CurveAlpha = ActiveLocalTimeDilation->ElapsedTime / ActiveLocalTimeDilation->TimeDilationDuration;
-			float CurveValue = ActiveLocalTimeDilation->CustomTimeDilationCurve ?
-			CurveValue = ActiveLocalTimeDilation->CustomTimeDilationCurve->GetFloatValue(CurveAlpha) :
-				FAlphaBlend::AlphaToBlendOption(CurveAlpha, ActiveLocalTimeDilation->BlendMode, ActiveLocalTimeDilation->CustomTimeDilationCurve);
-			
-			CurveValue = FMath::GetMappedRangeValueClamped(FVector2D(0.0f, 1.0f), FVector2D(ActiveLocalTimeDilation->TimeDilation, 1.0f), CurveValue);
-
-			for (AActor* AffectedActor : ActiveLocalTimeDilation->AffectedActors)
+			else if (HitStop.Priority > Resolved->Priority)
 			{
-				if (AffectedActor)
-				{
-					UE_LOG(LogTemp, Warning, TEXT("TimeDilation: %f"), CurveValue);
-					AffectedActor->CustomTimeDilation = CurveValue;
-				}
+				*Resolved = {HitStop.Priority, ChannelTimeDilation};
 			}
-		}
-		else
-		{
-			for (AActor* AffectedActor : ActiveLocalTimeDilation->AffectedActors)
+			else if (HitStop.Priority == Resolved->Priority)
 			{
-				if (AffectedActor)
-				{
-					AffectedActor->CustomTimeDilation = ActiveLocalTimeDilation->TimeDilation;
-				}
+				Resolved->TimeDilation = FMath::Min(Resolved->TimeDilation, ChannelTimeDilation);
 			}
 		}
-		
-		ActiveLocalTimeDilation->ElapsedTime += UnscaledDeltaTime;
-		if (ActiveLocalTimeDilation->ElapsedTime >= ActiveLocalTimeDilation->TimeDilationDuration && ActiveLocalTimeDilation->TimeDilationDuration > 0.0f)
+	}
+
+	for (const TPair<TWeakObjectPtr<AActor>, FResolvedLocalTimeDilation>& Resolved : ResolvedLocalTimeDilations)
+	{
+		if (AActor* AffectedActor = Resolved.Key.Get())
 		{
-			for (AActor* AffectedActor : ActiveLocalTimeDilation->AffectedActors)
-			{
-				if (AffectedActor)
-				{
-					AffectedActor->CustomTimeDilation = 1.0f;
-				}
-			}
-			
-			delete ActiveLocalTimeDilation;
-			ActiveLocalTimeDilation = nullptr;
+			AffectedActor->CustomTimeDilation = Resolved.Value.TimeDilation;
 		}
+		PreviousResolvedLocalTimeDilations.Remove(Resolved.Key);
 	}
-	else
+
+	for (const TPair<TWeakObjectPtr<AActor>, FResolvedLocalTimeDilation>& Released : PreviousResolvedLocalTimeDilations)
 	{
-		if (!LocalTimeDilationQueue.IsEmpty())
+		if (AActor* AffectedActor = Released.Key.Get())
 		{
-			FGASC_TimeDilation_Subsystem_Data DequeuedHitStop;
-			if (LocalTimeDilationQueue.Dequeue(DequeuedHitStop))
-			{
-				ActiveLocalTimeDilation = new FGASC_TimeDilation_Subsystem_Data(DequeuedHitStop);
-			}
+			AffectedActor->CustomTimeDilation = 1.0f;
 		}
 	}
 }
 
 void UGASC_TimeDilation_Subsystem::ProcessGlobalHitStops(float DeltaTime)
 {
-if (ActiveGlobalTimeDilation)
+	if (ActiveGlobalTimeDilation)
 	{
 		float ScaledDeltaTime = DeltaTime; // Provided during Tick or gameplay
 		float GlobalTimeDilation = UGameplayStatics::GetGlobalTimeDilation(GetWorld());
-		float UnscaledDeltaTime = ScaledDeltaTime / GlobalTimeDilation;
-		
-		if (ActiveGlobalTimeDilation->bUseTimeDilationCurve)
-		{
-			if (ActiveGlobalTimeDilation->CustomTimeDilationCurve)
-			{
-				TArray<FRichCurveKey>& Keys = ActiveGlobalTimeDilation->CustomTimeDilationCurve->FloatCurve.Keys;
-				if (Keys.Num() > 0)
-				{
-					if (ActiveGlobalTimeDilation->TimeDilationDuration > 0.0f)
-					{
-						Keys.Last().Time = ActiveGlobalTimeDilation->TimeDilationDuration;
-					}
-					else
-					{
-						ActiveGlobalTimeDilation->TimeDilationDuration =
-								ActiveGlobalTimeDilation->TimeDilationDuration < 0.0f ? ActiveGlobalTimeDilation->TimeDilationDuration : Keys.Last().Time;
-					}
-				}
-			}
-
-			float CurrentGlobalTimeDilation = ActiveGlobalTimeDilation->TimeDilationDuration < 0.0f ? 1.0f : ActiveGlobalTimeDilation->TimeDilationDuration;
-			float CurveAlpha = ActiveGlobalTimeDilation->ElapsedTime / CurrentGlobalTimeDilation;
-			float CurveValue = FAlphaBlend::AlphaToBlendOption(CurveAlpha, ActiveGlobalTimeDilation->BlendMode, ActiveGlobalTimeDilation->CustomTimeDilationCurve);
-
-			CurveValue = FMath::GetMappedRangeValueClamped(FVector2D(0.0f, 1.0f), FVector2D(ActiveGlobalTimeDilation->TimeDilation, 1.0f), CurveValue);
-			UGameplayStatics::SetGlobalTimeDilation(GetWorld(), CurveValue);
-		}
-		else
+		if (GlobalTimeDilation <= KINDA_SMALL_NUMBER)
 		{
-			UGameplayStatics::SetGlobalTimeDilation(GetWorld(), ActiveGlobalTimeDilation->TimeDilation);
+			GlobalTimeDilation = 1.0f;
 		}
+		float UnscaledDeltaTime = ScaledDeltaTime / GlobalTimeDilation;
+		
+		UGameplayStatics::SetGlobalTimeDilation(GetWorld(), EvaluateHitStopTimeDilation(*ActiveGlobalTimeDilation));
 		
 		ActiveGlobalTimeDilation->ElapsedTime += UnscaledDeltaTime;
 		if (ActiveGlobalTimeDilation->ElapsedTime >= ActiveGlobalTimeDilation->TimeDilationDuration && ActiveGlobalTimeDilation->TimeDilationDuration > 0.0f)
@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Systems/Targeting/GASC_CursorQuerySubsystem.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+UGASC_CursorQuerySubsystem* UGASC_CursorQuerySubsystem::Get(const APlayerController* PlayerController)
+{
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	return LocalPlayer ? LocalPlayer->GetSubsystem<UGASC_CursorQuerySubsystem>() : nullptr;
+}
+
+bool UGASC_CursorQuerySubsystem::GetCursorRay(FVector& OutRayOrigin, FVector& OutRayDirection)
+{
+	RefreshForFrame();
+
+	OutRayOrigin = RayOrigin;
+	OutRayDirection = RayDirection;
+	return bHasRay;
+}
+
+TConstArrayView<FHitResult> UGASC_CursorQuerySubsystem::GetCursorHits(ECollisionChannel Channel, float MaxRange)
+{
+	RefreshForFrame();
+
+	if (!bHasRay)
+	{
+		return TConstArrayView<FHitResult>();
+	}
+
+	FCachedCursorHits* Cached = nullptr;
+	for (int32 Index = 0; Index < NumCachedHits; ++Index)
+	{
+		if (CachedHits[Index].Channel == Channel)
+		{
+			Cached = &CachedHits[Index];
+			break;
+		}
+	}
+
+	// Trace on the first request for this channel, or again if a caller needs further than the cached trace reached
+	if (!Cached || Cached->MaxRange < MaxRange)
+	{
+		if (!Cached)
+		{
+			if (NumCachedHits == CachedHits.Num())
+			{
+				CachedHits.AddDefaulted();
+			}
+			Cached = &CachedHits[NumCachedHits++];
+			Cached->Channel = Channel;
+		}
+
+		Cached->MaxRange = MaxRange;
+		Cached->Hits.Reset();
+
+		const APlayerController* PlayerController = GetLocalPlayer()->PlayerController.Get();
+		if (UWorld* World = PlayerController ? PlayerController->GetWorld() : nullptr)
+		{
+			FCollisionQueryParams Params(SCENE_QUERY_STAT(GASC_CursorQuery), false);
+			Params.bReturnPhysicalMaterial = true;
+			Params.AddIgnoredActor(PlayerController->GetPawn());
+			World->LineTraceMultiByChannel(Cached->Hits, RayOrigin, RayOrigin + RayDirection * MaxRange, Channel, Params);
+		}
+	}
+
+	// Hits are sorted by distance, so a shorter request is a prefix of the cached hits
+	int32 NumInRange = 0;
+	while (NumInRange < Cached->Hits.Num() && Cached->Hits[NumInRange].Distance <= MaxRange)
+	{
+		++NumInRange;
+	}
+	return MakeArrayView(Cached->Hits.GetData(), NumInRange);
+}
+
+bool UGASC_CursorQuerySubsystem::GetCursorHit(ECollisionChannel Channel, float MaxRange, FHitResult& OutHit)
+{
+	for (const FHitResult& Hit : GetCursorHits(Channel, MaxRange))
+	{
+		if (Hit.bBlockingHit)
+		{
+			OutHit = Hit;
+			return true;
+		}
+	}
+	return false;
+}
+
+void UGASC_CursorQuerySubsystem::RefreshForFrame()
+{
+	if (CachedFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	CachedFrame = GFrameCounter;
+	NumCachedHits = 0;
+
+	const APlayerController* PlayerController = GetLocalPlayer()->PlayerController.Get();
+	bHasRay = PlayerController && PlayerController->DeprojectMousePositionToWorld(RayOrigin, RayDirection);
+}
@@ -0,0 +1,269 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Systems/Targeting/GASC_OverlapWatchSubsystem.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+
+namespace GASCourse_OverlapWatchCVars
+{
+	static TAutoConsoleVariable<float> CVarOverlapWatchPollInterval(TEXT("GASCourse.OverlapWatch.PollInterval"),
+		0.05f,
+		TEXT("Seconds between overlap watch polls. 0 polls every frame."));
+}
+
+namespace GASC_OverlapWatch
+{
+	// Same response set as the sphere component the wait overlap task used to create
+	static const FName OverlapProfileName(TEXT("OverlapOnlyPawn"));
+
+	/** The handle's only target data, replaced with a fresh one if a listener kept a copy of the handle. */
+	template<typename TargetDataType>
+	TargetDataType& GetUnsharedTargetData(FGameplayAbilityTargetDataHandle& Handle)
+	{
+		if (Handle.Data.IsEmpty() || Handle.Data[0].GetSharedReferenceCount() > 1)
+		{
+			Handle.Clear();
+			Handle.Add(new TargetDataType());
+		}
+		return static_cast<TargetDataType&>(*Handle.Data[0]);
+	}
+}
+
+void UGASC_OverlapWatchSubsystem::Deinitialize()
+{
+	Watchers.Empty();
+	FreeWatchers.Empty();
+	PolledQueries.Empty();
+	OverlapResults.Empty();
+	QueryResults.Empty();
+
+	Super::Deinitialize();
+}
+
+void UGASC_OverlapWatchSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceLastPoll += DeltaTime;
+	if (TimeSinceLastPoll < GASCourse_OverlapWatchCVars::CVarOverlapWatchPollInterval.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	TimeSinceLastPoll = 0.0f;
+	PollWatchers();
+}
+
+bool UGASC_OverlapWatchSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && GetNumActiveWatchers() > 0;
+}
+
+void UGASC_OverlapWatchSubsystem::RegisterWatcher(FGASC_OverlapWatchHandle& OutHandle, AActor* Avatar, float Radius, FGASC_OnOverlapWatchTriggered OnTriggered, bool bDebugDraw)
+{
+	OutHandle.Reset();
+	if (!Avatar || !OnTriggered.IsBound())
+	{
+		return;
+	}
+
+	OutHandle.Index = !FreeWatchers.IsEmpty() ? FreeWatchers.Pop(EAllowShrinking::No) : Watchers.Add(new FWatcher());
+	OutHandle.Serial = NextSerial++;
+
+	const int32 WatcherIndex = OutHandle.Index;
+	FWatcher& Watcher = Watchers[WatcherIndex];
+	Watcher.Avatar = Avatar;
+	Watcher.Radius = Radius;
+	Watcher.OnTriggered = MoveTemp(OnTriggered);
+	Watcher.Serial = OutHandle.Serial;
+	Watcher.bDebugDraw = bDebugDraw;
+	Watcher.bInUse = true;
+
+	// Outside a poll the scratch queries are from an earlier frame; inside one they are current and can be shared
+	if (!bIsPolling)
+	{
+		PolledQueries.Reset();
+		OverlapResults.Reset();
+	}
+	PollWatcher(WatcherIndex, true);
+}
+
+void UGASC_OverlapWatchSubsystem::UnregisterWatcher(FGASC_OverlapWatchHandle& Handle)
+{
+	if (FWatcher* Watcher = FindWatcher(Handle))
+	{
+		if (Watcher->bBroadcasting)
+		{
+			// Unbinding the delegate it is executing is not safe; PollWatcher releases the record once it returns
+			Watcher->bInUse = false;
+		}
+		else
+		{
+			ReleaseWatcher(Handle.Index);
+		}
+	}
+
+	Handle.Reset();
+}
+
+void UGASC_OverlapWatchSubsystem::PollWatchers()
+{
+	TGuardValue<bool> PollingGuard(bIsPolling, true);
+
+	PolledQueries.Reset();
+	OverlapResults.Reset();
+
+	// Watchers registered by a callback during this poll were already polled when they registered
+	const int32 NumWatchers = Watchers.Num();
+	for (int32 WatcherIndex = 0; WatcherIndex < NumWatchers; ++WatcherIndex)
+	{
+		if (Watchers[WatcherIndex].bInUse)
+		{
+			PollWatcher(WatcherIndex, false);
+		}
+	}
+}
+
+void UGASC_OverlapWatchSubsystem::PollWatcher(int32 WatcherIndex, bool bInitialReport)
+{
+	FWatcher& Watcher = Watchers[WatcherIndex];
+	AActor* Avatar = Watcher.Avatar.Get();
+	if (!Avatar)
+	{
+		return;
+	}
+
+	const int32 QueryIndex = FindOrRunQuery(*Avatar, Watcher.Radius, Watcher.bDebugDraw);
+
+	Watcher.NewOverlapIndices.Reset();
+	const FPolledQuery& Query = PolledQueries[QueryIndex];
+	for (int32 ResultIndex = Query.FirstResult; ResultIndex < Query.FirstResult + Query.NumResults; ++ResultIndex)
+	{
+		AActor* OverlappedActor = OverlapResults[ResultIndex].GetActor();
+		if (!OverlappedActor || OverlappedActor == Avatar)
+		{
+			continue;
+		}
+
+		// A multi-component actor shows up once per overlapping component
+		bool bAlreadyReported = false;
+		Watcher.ReportedActors.Add(OverlappedActor, &bAlreadyReported);
+		if (!bAlreadyReported)
+		{
+			Watcher.NewOverlapIndices.Add(ResultIndex);
+		}
+	}
+
+	if (Watcher.NewOverlapIndices.IsEmpty())
+	{
+		return;
+	}
+
+	Watcher.bBroadcasting = true;
+	if (bInitialReport)
+	{
+		FGameplayAbilityTargetData_ActorArray& TargetData = GASC_OverlapWatch::GetUnsharedTargetData<FGameplayAbilityTargetData_ActorArray>(Watcher.InitialTargetDataHandle);
+		TargetData.TargetActorArray.Reset();
+		for (const int32 ResultIndex : Watcher.NewOverlapIndices)
+		{
+			TargetData.TargetActorArray.Add(OverlapResults[ResultIndex].GetActor());
+		}
+		Watcher.OnTriggered.ExecuteIfBound(Watcher.InitialTargetDataHandle);
+	}
+	else
+	{
+		// Callbacks may register watchers, which appends to OverlapResults, so each result is read just before use
+		const FVector Center = Avatar->GetActorLocation();
+		for (int32 NewIndex = 0; NewIndex < Watcher.NewOverlapIndices.Num() && Watcher.bInUse; ++NewIndex)
+		{
+			const FOverlapResult& Overlap = OverlapResults[Watcher.NewOverlapIndices[NewIndex]];
+			AActor* OverlappedActor = Overlap.GetActor();
+			if (!OverlappedActor)
+			{
+				// Destroyed by an earlier callback in this report
+				continue;
+			}
+			const FVector Location = OverlappedActor->GetActorLocation();
+
+			FGameplayAbilityTargetData_SingleTargetHit& TargetData = GASC_OverlapWatch::GetUnsharedTargetData<FGameplayAbilityTargetData_SingleTargetHit>(Watcher.EnteredTargetDataHandle);
+			TargetData.HitResult = FHitResult(OverlappedActor, Overlap.GetComponent(), Location, (Location - Center).GetSafeNormal());
+			TargetData.HitResult.TraceStart = Center;
+			TargetData.HitResult.TraceEnd = Location;
+
+			Watcher.OnTriggered.ExecuteIfBound(Watcher.EnteredTargetDataHandle);
+		}
+	}
+	Watcher.bBroadcasting = false;
+
+	if (!Watcher.bInUse)
+	{
+		ReleaseWatcher(WatcherIndex);
+	}
+}
+
+int32 UGASC_OverlapWatchSubsystem::FindOrRunQuery(AActor& Avatar, float Radius, bool bDebugDraw)
+{
+	const TObjectKey<AActor> AvatarKey(&Avatar);
+	for (int32 QueryIndex = 0; QueryIndex < PolledQueries.Num(); ++QueryIndex)
+	{
+		if (PolledQueries[QueryIndex].Avatar == AvatarKey && PolledQueries[QueryIndex].Radius == Radius)
+		{
+			return QueryIndex;
+		}
+	}
+
+	const FVector Center = Avatar.GetActorLocation();
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(GASC_OverlapWatch), false);
+	Params.AddIgnoredActor(&Avatar);
+
+	QueryResults.Reset();
+	GetWorld()->OverlapMultiByProfile(QueryResults, Center, FQuat::Identity, GASC_OverlapWatch::OverlapProfileName,
+		FCollisionShape::MakeSphere(Radius), Params);
+
+	FPolledQuery& Query = PolledQueries.AddDefaulted_GetRef();
+	Query.Avatar = AvatarKey;
+	Query.Radius = Radius;
+	Query.FirstResult = OverlapResults.Num();
+	Query.NumResults = QueryResults.Num();
+	OverlapResults.Append(QueryResults);
+
+#if ENABLE_DRAW_DEBUG
+	if (bDebugDraw)
+	{
+		DrawDebugSphere(GetWorld(), Center, Radius, 16, QueryResults.IsEmpty() ? FColor::Green : FColor::Red, false,
+			GASCourse_OverlapWatchCVars::CVarOverlapWatchPollInterval.GetValueOnGameThread());
+	}
+#endif
+
+	return PolledQueries.Num() - 1;
+}
+
+UGASC_OverlapWatchSubsystem::FWatcher* UGASC_OverlapWatchSubsystem::FindWatcher(const FGASC_OverlapWatchHandle& Handle)
+{
+	if (!Watchers.IsValidIndex(Handle.Index))
+	{
+		return nullptr;
+	}
+
+	FWatcher& Watcher = Watchers[Handle.Index];
+	return Watcher.bInUse && Watcher.Serial == Handle.Serial ? &Watcher : nullptr;
+}
+
+void UGASC_OverlapWatchSubsystem::ReleaseWatcher(int32 WatcherIndex)
+{
+	FWatcher& Watcher = Watchers[WatcherIndex];
+
+	// The reported set and target data are kept for the next watcher to take this record. Target data is never
+	// cleared here: a listener may still hold it, and the next report replaces it if so.
+	Watcher.Avatar.Reset();
+	Watcher.OnTriggered.Unbind();
+	Watcher.ReportedActors.Reset();
+	Watcher.NewOverlapIndices.Reset();
+	Watcher.Serial = 0;
+	Watcher.bDebugDraw = false;
+	Watcher.bInUse = false;
+
+	FreeWatchers.Add(WatcherIndex);
+}
@@ -0,0 +1,562 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Systems/WaveManager/GASC_WaveManagerSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "NavigationData.h"
+#include "NavigationSystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "GASCourse/GASCourseCharacter.h"
+#include "Game/GameplayAbilitySystem/GASCourseNativeGameplayTags.h"
+#include "Game/Systems/WaveManager/GASC_WaveManagerSystemSettings.h"
+#include "Logging/StructuredLog.h"
+
+DEFINE_LOG_CATEGORY(LOG_GASC_WaveManagerSubsystem);
+
+void UGASC_WaveManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (const UGASC_WaveManagerSystemSettings* WaveManagerSystemSettings = GetDefault<UGASC_WaveManagerSystemSettings>())
+	{
+		MaxPrewarmSpawnsPerTick = FMath::Max(WaveManagerSystemSettings->MaxPoolPrewarmSpawnsPerTick, 1);
+		ReleaseDelayAfterDeath = FMath::Max(WaveManagerSystemSettings->EnemyReleaseDelayAfterDeath, 0.0f);
+	}
+}
+
+void UGASC_WaveManagerSubsystem::Deinitialize()
+{
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->CancelHandle();
+		PreloadHandle.Reset();
+	}
+
+	PendingPrewarm.Empty();
+	PendingReleases.Empty();
+	EnemyPools.Empty();
+	ActiveEnemies.Empty();
+	EnemyBaselines.Empty();
+
+	Super::Deinitialize();
+}
+
+void UGASC_WaveManagerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	const UGASC_WaveManagerSystemSettings* WaveManagerSystemSettings = GetDefault<UGASC_WaveManagerSystemSettings>();
+	if (!WaveManagerSystemSettings || WaveManagerSystemSettings->WaveDefinitions.IsNull())
+	{
+		return;
+	}
+
+	// The definitions asset is small; it's the enemy classes it references that are streamed ahead of time
+	if (const UGASC_WaveDefinitionData* WaveDefinitionData = WaveManagerSystemSettings->WaveDefinitions.LoadSynchronous())
+	{
+		SetWaveDefinitions(WaveDefinitionData->Waves);
+	}
+}
+
+bool UGASC_WaveManagerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGASC_WaveManagerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// ReleaseEnemy edits PendingReleases, so the due enemies are collected before any is released
+	const double WorldTime = GetWorld()->GetTimeSeconds();
+	TArray<TWeakObjectPtr<APawn>, TInlineAllocator<8>> DueReleases;
+	for (const TPair<TWeakObjectPtr<APawn>, double>& PendingRelease : PendingReleases)
+	{
+		if (PendingRelease.Value <= WorldTime)
+		{
+			DueReleases.Add(PendingRelease.Key);
+		}
+	}
+	for (const TWeakObjectPtr<APawn>& Enemy : DueReleases)
+	{
+		ReleaseEnemy(Enemy.Get());
+	}
+	PendingReleases.RemoveAllSwap([WorldTime](const TPair<TWeakObjectPtr<APawn>, double>& PendingRelease)
+	{
+		return !PendingRelease.Key.IsValid() || PendingRelease.Value <= WorldTime;
+	}, EAllowShrinking::No);
+
+	// Fill the upcoming wave's pools a few pawns at a time so no single frame pays for a whole group
+	for (int32 SpawnCount = 0; SpawnCount < MaxPrewarmSpawnsPerTick && !PendingPrewarm.IsEmpty(); ++SpawnCount)
+	{
+		const TSubclassOf<APawn> EnemyClass = PendingPrewarm.Pop(EAllowShrinking::No);
+		if (APawn* Enemy = CreatePooledEnemy(EnemyClass))
+		{
+			EnemyPools.FindOrAdd(EnemyClass).InactivePawns.Add(Enemy);
+		}
+	}
+}
+
+bool UGASC_WaveManagerSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && (!PendingPrewarm.IsEmpty() || !PendingReleases.IsEmpty());
+}
+
+void UGASC_WaveManagerSubsystem::SetWaveDefinitions(const TArray<FGASC_WaveDefinition>& InWaveDefinitions)
+{
+	WaveDefinitions = InWaveDefinitions;
+	NextWaveIndex = 0;
+	PendingPrewarm.Reset();
+	PreloadWave(NextWaveIndex);
+}
+
+TArray<APawn*> UGASC_WaveManagerSubsystem::SpawnNextWave(const FVector& SpawnOrigin)
+{
+	TArray<APawn*> SpawnedEnemies;
+	if (!WaveDefinitions.IsValidIndex(NextWaveIndex))
+	{
+		return SpawnedEnemies;
+	}
+
+	const int32 WaveIndex = NextWaveIndex++;
+	if (PreloadedWaveIndex != WaveIndex)
+	{
+		PreloadWave(WaveIndex);
+	}
+	if (PreloadHandle.IsValid() && PreloadHandle->IsLoadingInProgress())
+	{
+		UE_LOGFMT(LOG_GASC_WaveManagerSubsystem, Warning, "Wave {0} spawned before its enemy classes finished streaming; waiting on the load.", WaveIndex);
+		PreloadHandle->WaitUntilComplete();
+	}
+
+	const FGASC_WaveDefinition& Wave = WaveDefinitions[WaveIndex];
+	TArray<FVector> SpawnLocations;
+	for (const FGASC_WaveEnemyGroup& Group : Wave.EnemyGroups)
+	{
+		const TSubclassOf<APawn> EnemyClass = Group.EnemyClass.Get();
+		if (!EnemyClass)
+		{
+			UE_LOGFMT(LOG_GASC_WaveManagerSubsystem, Warning, "Wave {0}: enemy class {1} could not be loaded.", WaveIndex, Group.EnemyClass.ToString());
+			continue;
+		}
+
+		FindSpawnLocations(SpawnOrigin, Wave.SpawnRadius, Group.Count, SpawnLocations);
+		for (const FVector& SpawnLocation : SpawnLocations)
+		{
+			if (APawn* Enemy = SpawnEnemy(EnemyClass, FTransform(FRotator::ZeroRotator, SpawnLocation)))
+			{
+				SpawnedEnemies.Add(Enemy);
+			}
+		}
+	}
+
+	// Start streaming and pre-warming the next wave while this one plays out
+	PendingPrewarm.Reset();
+	if (WaveDefinitions.IsValidIndex(NextWaveIndex))
+	{
+		PreloadWave(NextWaveIndex);
+	}
+
+	return SpawnedEnemies;
+}
+
+APawn* UGASC_WaveManagerSubsystem::SpawnEnemy(TSubclassOf<APawn> EnemyClass, const FTransform& SpawnTransform)
+{
+	if (!EnemyClass)
+	{
+		return nullptr;
+	}
+
+	APawn* Enemy = nullptr;
+	if (FGASC_WaveEnemyPool* Pool = EnemyPools.Find(EnemyClass))
+	{
+		while (!Enemy && !Pool->InactivePawns.IsEmpty())
+		{
+			// Pooled pawns can still be destroyed from outside (kill volumes, level unload)
+			Enemy = Pool->InactivePawns.Pop(EAllowShrinking::No);
+			if (!IsValid(Enemy))
+			{
+				Enemy = nullptr;
+			}
+		}
+	}
+
+	if (!Enemy)
+	{
+		Enemy = CreatePooledEnemy(EnemyClass);
+		if (!Enemy)
+		{
+			return nullptr;
+		}
+	}
+
+	ActiveEnemies.Add(Enemy, EnemyClass);
+	ActivateEnemy(Enemy, SpawnTransform);
+	return Enemy;
+}
+
+void UGASC_WaveManagerSubsystem::ReleaseEnemy(APawn* Enemy)
+{
+	TSubclassOf<APawn> EnemyClass;
+	if (!IsValid(Enemy) || !ActiveEnemies.RemoveAndCopyValue(Enemy, EnemyClass))
+	{
+		return;
+	}
+
+	// Released by hand before its death delay ran out
+	PendingReleases.RemoveAllSwap([Enemy](const TPair<TWeakObjectPtr<APawn>, double>& PendingRelease)
+	{
+		return PendingRelease.Key.Get() == Enemy;
+	}, EAllowShrinking::No);
+
+	RestoreBaseline(Enemy);
+	DeactivateEnemy(Enemy);
+	EnemyPools.FindOrAdd(EnemyClass).InactivePawns.Add(Enemy);
+}
+
+bool UGASC_WaveManagerSubsystem::IsWaveReady(int32 WaveIndex) const
+{
+	if (!WaveDefinitions.IsValidIndex(WaveIndex))
+	{
+		return false;
+	}
+
+	TMap<TSubclassOf<APawn>, int32> RequiredCounts;
+	for (const FGASC_WaveEnemyGroup& Group : WaveDefinitions[WaveIndex].EnemyGroups)
+	{
+		const TSubclassOf<APawn> EnemyClass = Group.EnemyClass.Get();
+		if (!EnemyClass)
+		{
+			return false;
+		}
+		RequiredCounts.FindOrAdd(EnemyClass) += Group.Count;
+	}
+
+	for (const TPair<TSubclassOf<APawn>, int32>& Required : RequiredCounts)
+	{
+		if (GetNumPooledEnemies(Required.Key) < Required.Value)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 UGASC_WaveManagerSubsystem::GetNumPooledEnemies(TSubclassOf<APawn> EnemyClass) const
+{
+	const FGASC_WaveEnemyPool* Pool = EnemyPools.Find(EnemyClass);
+	return Pool ? Pool->InactivePawns.Num() : 0;
+}
+
+void UGASC_WaveManagerSubsystem::PreloadWave(int32 WaveIndex)
+{
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->ReleaseHandle();
+		PreloadHandle.Reset();
+	}
+
+	PreloadedWaveIndex = WaveIndex;
+	if (!WaveDefinitions.IsValidIndex(WaveIndex))
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> SoftObjectPaths;
+	for (const FGASC_WaveEnemyGroup& Group : WaveDefinitions[WaveIndex].EnemyGroups)
+	{
+		if (!Group.EnemyClass.IsNull())
+		{
+			SoftObjectPaths.AddUnique(Group.EnemyClass.ToSoftObjectPath());
+		}
+	}
+
+	if (SoftObjectPaths.IsEmpty())
+	{
+		return;
+	}
+
+	FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+	PreloadHandle = StreamableManager.RequestAsyncLoad(SoftObjectPaths,
+		FStreamableDelegate::CreateUObject(this, &UGASC_WaveManagerSubsystem::OnWavePreloaded, WaveIndex));
+}
+
+void UGASC_WaveManagerSubsystem::OnWavePreloaded(int32 WaveIndex)
+{
+	// A newer preload superseded this one
+	if (WaveIndex != PreloadedWaveIndex || !WaveDefinitions.IsValidIndex(WaveIndex))
+	{
+		return;
+	}
+
+	QueuePoolPrewarm(WaveDefinitions[WaveIndex]);
+}
+
+void UGASC_WaveManagerSubsystem::QueuePoolPrewarm(const FGASC_WaveDefinition& Wave)
+{
+	TMap<TSubclassOf<APawn>, int32> RequiredCounts;
+	for (const FGASC_WaveEnemyGroup& Group : Wave.EnemyGroups)
+	{
+		if (const TSubclassOf<APawn> EnemyClass = Group.EnemyClass.Get())
+		{
+			RequiredCounts.FindOrAdd(EnemyClass) += Group.Count;
+		}
+	}
+
+	for (const TPair<TSubclassOf<APawn>, int32>& Required : RequiredCounts)
+	{
+		const int32 Missing = Required.Value - GetNumPooledEnemies(Required.Key);
+		for (int32 Index = 0; Index < Missing; ++Index)
+		{
+			PendingPrewarm.Add(Required.Key);
+		}
+	}
+}
+
+APawn* UGASC_WaveManagerSubsystem::CreatePooledEnemy(TSubclassOf<APawn> EnemyClass)
+{
+	UWorld* World = GetWorld();
+	if (!World || !EnemyClass)
+	{
+		return nullptr;
+	}
+
+	APawn* Enemy = World->SpawnActorDeferred<APawn>(EnemyClass, FTransform::Identity, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Enemy)
+	{
+		return nullptr;
+	}
+	Enemy->FinishSpawning(FTransform::Identity);
+
+	// Possession initializes the ability system; pooled pawns keep their controller for life so it only happens once
+	if (!Enemy->GetController())
+	{
+		Enemy->SpawnDefaultController();
+	}
+
+	CaptureBaseline(Enemy);
+	DeactivateEnemy(Enemy);
+
+	// The ability system and the actor outlive every trip through the pool, so these are bound once per pawn
+	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Enemy))
+	{
+		ASC->AddGameplayEventTagContainerDelegate(FGameplayTagContainer(Event_OnStatusDeath),
+			FGameplayEventTagMulticastDelegate::FDelegate::CreateUObject(this, &ThisClass::OnEnemyDeathEvent, TWeakObjectPtr<APawn>(Enemy)));
+	}
+	Enemy->OnEndPlay.AddDynamic(this, &ThisClass::OnEnemyEndPlay);
+
+	return Enemy;
+}
+
+void UGASC_WaveManagerSubsystem::OnEnemyDeathEvent(FGameplayTag MatchingTag, const FGameplayEventData* Payload, TWeakObjectPtr<APawn> Enemy)
+{
+	if (!Enemy.IsValid() || !ActiveEnemies.Contains(Enemy.Get()))
+	{
+		return;
+	}
+
+	PendingReleases.Emplace(Enemy, GetWorld()->GetTimeSeconds() + ReleaseDelayAfterDeath);
+}
+
+void UGASC_WaveManagerSubsystem::OnEnemyEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	APawn* Enemy = Cast<APawn>(Actor);
+	if (!Enemy)
+	{
+		return;
+	}
+
+	ActiveEnemies.Remove(Enemy);
+	EnemyBaselines.Remove(Enemy);
+	for (TPair<TSubclassOf<APawn>, FGASC_WaveEnemyPool>& Pool : EnemyPools)
+	{
+		Pool.Value.InactivePawns.RemoveSingleSwap(Enemy, EAllowShrinking::No);
+	}
+	PendingReleases.RemoveAllSwap([Enemy](const TPair<TWeakObjectPtr<APawn>, double>& PendingRelease)
+	{
+		return !PendingRelease.Key.IsValid() || PendingRelease.Key.Get() == Enemy;
+	}, EAllowShrinking::No);
+}
+
+void UGASC_WaveManagerSubsystem::ActivateEnemy(APawn* Enemy, const FTransform& SpawnTransform)
+{
+	Enemy->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	Enemy->SetActorHiddenInGame(false);
+	Enemy->SetActorEnableCollision(true);
+	Enemy->SetActorTickEnabled(true);
+
+	if (UPawnMovementComponent* MovementComponent = Enemy->GetMovementComponent())
+	{
+		MovementComponent->Activate(true);
+	}
+
+	if (const AAIController* AIController = Cast<AAIController>(Enemy->GetController()))
+	{
+		if (UBrainComponent* BrainComponent = AIController->GetBrainComponent())
+		{
+			BrainComponent->RestartLogic();
+		}
+	}
+}
+
+void UGASC_WaveManagerSubsystem::DeactivateEnemy(APawn* Enemy)
+{
+	if (AAIController* AIController = Cast<AAIController>(Enemy->GetController()))
+	{
+		AIController->StopMovement();
+		if (UBrainComponent* BrainComponent = AIController->GetBrainComponent())
+		{
+			BrainComponent->StopLogic(TEXT("Returned to wave manager pool"));
+		}
+	}
+
+	if (UPawnMovementComponent* MovementComponent = Enemy->GetMovementComponent())
+	{
+		MovementComponent->StopMovementImmediately();
+		MovementComponent->Deactivate();
+	}
+
+	Enemy->SetActorHiddenInGame(true);
+	Enemy->SetActorEnableCollision(false);
+	Enemy->SetActorTickEnabled(false);
+}
+
+void UGASC_WaveManagerSubsystem::CaptureBaseline(APawn* Enemy)
+{
+	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Enemy);
+	if (!ASC)
+	{
+		return;
+	}
+
+	FPooledEnemyBaseline& Baseline = EnemyBaselines.FindOrAdd(Enemy);
+
+	TArray<FGameplayAttribute> Attributes;
+	ASC->GetAllAttributes(Attributes);
+	Baseline.AttributeBaseValues.Reset(Attributes.Num());
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		Baseline.AttributeBaseValues.Emplace(Attribute, ASC->GetNumericAttributeBase(Attribute));
+	}
+
+	// Effects granted by the default ability set and start-up status effects survive a reset
+	Baseline.Effects.Reset();
+	for (const FActiveGameplayEffectHandle& EffectHandle : ASC->GetActiveEffects(FGameplayEffectQuery()))
+	{
+		if (const FActiveGameplayEffect* ActiveEffect = ASC->GetActiveGameplayEffect(EffectHandle))
+		{
+			Baseline.Effects.Add({EffectHandle, ActiveEffect->Spec});
+		}
+	}
+
+	Baseline.TagCounts.Reset();
+	for (const FGameplayTag& OwnedTag : ASC->GetOwnedGameplayTags())
+	{
+		Baseline.TagCounts.Add(OwnedTag, ASC->GetTagCount(OwnedTag));
+	}
+}
+
+void UGASC_WaveManagerSubsystem::RestoreBaseline(APawn* Enemy)
+{
+	if (AGASCourseCharacter* EnemyCharacter = Cast<AGASCourseCharacter>(Enemy))
+	{
+		EnemyCharacter->SetCharacterDead(false);
+	}
+
+	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Enemy);
+	FPooledEnemyBaseline* Baseline = EnemyBaselines.Find(Enemy);
+	if (!ASC || !Baseline)
+	{
+		return;
+	}
+
+	ASC->CancelAllAbilities();
+
+	for (const FActiveGameplayEffectHandle& ActiveEffect : ASC->GetActiveEffects(FGameplayEffectQuery()))
+	{
+		if (!Baseline->Effects.ContainsByPredicate([&ActiveEffect](const FPooledEnemyBaselineEffect& BaselineEffect)
+		{
+			return BaselineEffect.Handle == ActiveEffect;
+		}))
+		{
+			ASC->RemoveActiveGameplayEffect(ActiveEffect);
+		}
+	}
+
+	// Start-up status effects are removed on death and timed effects run out (or part of the way); both are applied
+	// again from their spec so the next trip out starts with the full set
+	for (FPooledEnemyBaselineEffect& BaselineEffect : Baseline->Effects)
+	{
+		const bool bActive = ASC->GetActiveGameplayEffect(BaselineEffect.Handle) != nullptr;
+		if (bActive && BaselineEffect.Spec.GetDuration() == FGameplayEffectConstants::INFINITE_DURATION)
+		{
+			continue;
+		}
+		if (bActive)
+		{
+			ASC->RemoveActiveGameplayEffect(BaselineEffect.Handle);
+		}
+		BaselineEffect.Handle = ASC->ApplyGameplayEffectSpecToSelf(BaselineEffect.Spec);
+	}
+
+	for (const TPair<FGameplayAttribute, float>& AttributeBaseValue : Baseline->AttributeBaseValues)
+	{
+		ASC->SetNumericAttributeBase(AttributeBaseValue.Key, AttributeBaseValue.Value);
+	}
+
+	// With the effects back to their captured set, any tag count that still differs comes from loose tags
+	const FGameplayTagContainer OwnedTags = ASC->GetOwnedGameplayTags();
+	for (const FGameplayTag& OwnedTag : OwnedTags)
+	{
+		if (!Baseline->TagCounts.Contains(OwnedTag))
+		{
+			ASC->SetLooseGameplayTagCount(OwnedTag, 0);
+		}
+	}
+	for (const TPair<FGameplayTag, int32>& TagCount : Baseline->TagCounts)
+	{
+		if (ASC->GetTagCount(TagCount.Key) != TagCount.Value)
+		{
+			ASC->SetLooseGameplayTagCount(TagCount.Key, TagCount.Value);
+		}
+	}
+}
+
+void UGASC_WaveManagerSubsystem::FindSpawnLocations(const FVector& SpawnOrigin, float SpawnRadius, int32 Count, TArray<FVector>& OutLocations) const
+{
+	OutLocations.Reset(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const float Angle = FMath::FRandRange(0.0f, UE_TWO_PI);
+		OutLocations.Add(SpawnOrigin + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * SpawnRadius);
+	}
+
+	// Without a navmesh (e.g. automation worlds) the raw points are used, as is any point that fails to project
+	const UNavigationSystemV1* NavigationSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const ANavigationData* NavData = NavigationSystem ? NavigationSystem->GetDefaultNavDataInstance() : nullptr;
+	if (!NavData || OutLocations.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FNavigationProjectionWork> ProjectionWork;
+	ProjectionWork.Reserve(OutLocations.Num());
+	for (const FVector& Candidate : OutLocations)
+	{
+		ProjectionWork.Emplace(Candidate);
+	}
+
+	NavData->BatchProjectPoints(ProjectionWork, FVector(500.0f, 500.0f, 500.0f));
+	for (int32 Index = 0; Index < ProjectionWork.Num(); ++Index)
+	{
+		if (ProjectionWork[Index].bResult)
+		{
+			OutLocations[Index] = ProjectionWork[Index].OutLocation.Location;
+		}
+	}
+}
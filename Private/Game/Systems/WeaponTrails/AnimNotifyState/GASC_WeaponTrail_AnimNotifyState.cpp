@@ -3,10 +3,9 @@
 
 #include "Game/Systems/WeaponTrails/AnimNotifyState/GASC_WeaponTrail_AnimNotifyState.h"
 #include "NiagaraComponent.h"
-#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Animation/AnimNotifyLibrary.h"
-#include "Curves/CurveLinearColor.h"
+#include "Game/Systems/WeaponTrails/GASC_WeaponTrailSubsystem.h"
 #include "Game/Systems/WeaponTrails/GASC_WeaponTrails_DataAsset.h"
 
 DEFINE_LOG_CATEGORY(LogGASCourseWeaponTrail);
@@ -18,6 +17,15 @@ UGASC_WeaponTrail_AnimNotifyState::UGASC_WeaponTrail_AnimNotifyState(const FObje
 	bDestroyAtEnd = false;
 }
 
+namespace GASC_WeaponTrail
+{
+	UGASC_WeaponTrailSubsystem* GetSubsystem(const USkeletalMeshComponent* MeshComp)
+	{
+		const UWorld* World = MeshComp ? MeshComp->GetWorld() : nullptr;
+		return World ? World->GetSubsystem<UGASC_WeaponTrailSubsystem>() : nullptr;
+	}
+}
+
 void UGASC_WeaponTrail_AnimNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation,
                                                     float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
@@ -26,14 +34,10 @@ void UGASC_WeaponTrail_AnimNotifyState::NotifyBegin(USkeletalMeshComponent* Mesh
 		UE_LOG(LogGASCourseWeaponTrail, Warning, TEXT("Invalid Weapon Trail data found in %s. Please fix."), *GetPathNameSafe(this));
 		return;
 	}
-	
-	WeaponTrailNiagaraComponent = GetSpawnedEffect(MeshComp);
-	if (WeaponTrailNiagaraComponent)
+
+	if (UGASC_WeaponTrailSubsystem* WeaponTrailSubsystem = GASC_WeaponTrail::GetSubsystem(MeshComp))
 	{
-		SetWeaponTrailMaterialInterface(WeaponTrailNiagaraComponent);
-		SetWeaponTrailColorArrayAtTime(WeaponTrailNiagaraComponent, 0.0f);
-		SetWeaponTrailLifeTime(WeaponTrailNiagaraComponent, WeaponTrailData->TrailLifeTime);
-		
+		WeaponTrailSubsystem->BeginTrail(MeshComp, this);
 	}
 	
 	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
@@ -42,15 +46,10 @@ void UGASC_WeaponTrail_AnimNotifyState::NotifyBegin(USkeletalMeshComponent* Mesh
 void UGASC_WeaponTrail_AnimNotifyState::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation,
 	float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
 {
-	if (!WeaponTrailData->IsValidLowLevelFast())
-	{
-		return;
-	}
-
-	if (WeaponTrailNiagaraComponent)
+	if (UGASC_WeaponTrailSubsystem* WeaponTrailSubsystem = GASC_WeaponTrail::GetSubsystem(MeshComp))
 	{
-		float CurrentTimeRatio =  UAnimNotifyLibrary::GetCurrentAnimationNotifyStateTimeRatio(EventReference);
-		SetWeaponTrailColorArrayAtTime(WeaponTrailNiagaraComponent, CurrentTimeRatio);
+		const float CurrentTimeRatio = UAnimNotifyLibrary::GetCurrentAnimationNotifyStateTimeRatio(EventReference);
+		WeaponTrailSubsystem->UpdateTrail(MeshComp, this, CurrentTimeRatio);
 	}
 	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
 }
@@ -58,7 +57,10 @@ void UGASC_WeaponTrail_AnimNotifyState::NotifyTick(USkeletalMeshComponent* MeshC
 void UGASC_WeaponTrail_AnimNotifyState::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation,
 	const FAnimNotifyEventReference& EventReference)
 {
-	DestroyWeaponTrailVFX();
+	if (UGASC_WeaponTrailSubsystem* WeaponTrailSubsystem = GASC_WeaponTrail::GetSubsystem(MeshComp))
+	{
+		WeaponTrailSubsystem->EndTrail(MeshComp, this);
+	}
 	Super::NotifyEnd(MeshComp, Animation, EventReference);
 }
 
@@ -77,59 +79,8 @@ UNiagaraComponent* UGASC_WeaponTrail_AnimNotifyState::GetSpawnedEffect(UMeshComp
 	return nullptr;
 }
 
-void UGASC_WeaponTrail_AnimNotifyState::SetWeaponTrailMaterialInterface(UNiagaraComponent* InWeaponTrailNiagaraComponent) const
+UNiagaraComponent* UGASC_WeaponTrail_AnimNotifyState::GetActiveTrail(USkeletalMeshComponent* MeshComp) const
 {
-	if (!WeaponTrailData->WeaponTrailMaterialInterface.Get())
-	{
-		UE_LOG(LogGASCourseWeaponTrail, Warning, TEXT("Invalid Weapon Trail Material Interface in Weapon Trail Data: %s found in %s. Please fix."), *GetPathNameSafe(WeaponTrailData),
-			*GetPathNameSafe(this));
-		return;
-	}
-	
-	InWeaponTrailNiagaraComponent->SetVariableMaterial(FName("Material Interface") ,WeaponTrailData->WeaponTrailMaterialInterface.Get());
-}
-
-void UGASC_WeaponTrail_AnimNotifyState::SetWeaponTrailColorArrayAtTime(UNiagaraComponent* InWeaponTrailNiagaraComponent,
-	float InTime) const
-{
-	if (!WeaponTrailData->ColorCurve.Get())
-	{
-		UE_LOG(LogGASCourseWeaponTrail, Warning, TEXT("Invalid Weapon Trail Color curve in Weapon Trail Data: %s found in %s. Please fix."), *GetPathNameSafe(WeaponTrailData),
-			*GetPathNameSafe(this));
-		return;
-	}
-
-	UCurveLinearColor* ColorCurve = WeaponTrailData->ColorCurve.Get();
-	FLinearColor ColorData = ColorCurve->GetLinearColorValue(InTime);
-	TArray<FLinearColor> ArrayData = {ColorData};
-	
-	
-	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayColor(InWeaponTrailNiagaraComponent, "Color Selection Array_Color", ArrayData);
-}
-
-void UGASC_WeaponTrail_AnimNotifyState::SetWeaponTrailLifeTime(UNiagaraComponent* InWeaponTrailNiagaraComponent,
-	float InLifeTime) const
-{
-	if (!WeaponTrailData)
-	{
-		UE_LOG(LogGASCourseWeaponTrail, Warning, TEXT("Invalid Weapon Trail Data found in %s. Please fix."), *GetPathNameSafe(this));
-		return;
-	}
-
-	InWeaponTrailNiagaraComponent->SetVariableFloat(FName("LifeTime"), InLifeTime);
-}
-
-void UGASC_WeaponTrail_AnimNotifyState::DestroyWeaponTrailVFX() const
-{
-	if (WeaponTrailNiagaraComponent)
-	{
-		if (bDestroyAtEnd)
-		{
-			WeaponTrailNiagaraComponent->DestroyComponent();
-		}
-		else
-		{
-			WeaponTrailNiagaraComponent->Deactivate();
-		}
-	}
+	const UGASC_WeaponTrailSubsystem* WeaponTrailSubsystem = GASC_WeaponTrail::GetSubsystem(MeshComp);
+	return WeaponTrailSubsystem ? WeaponTrailSubsystem->FindTrailComponent(MeshComp, this) : nullptr;
 }
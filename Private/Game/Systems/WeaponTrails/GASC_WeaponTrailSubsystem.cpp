@@ -0,0 +1,253 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Systems/WeaponTrails/GASC_WeaponTrailSubsystem.h"
+#include "NiagaraComponent.h"
+#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Game/Systems/WeaponTrails/GASC_WeaponTrails_DataAsset.h"
+#include "Game/Systems/WeaponTrails/AnimNotifyState/GASC_WeaponTrail_AnimNotifyState.h"
+
+namespace GASC_WeaponTrail
+{
+	// User parameter names the weapon trail systems are authored with
+	static const FName MaterialInterfaceName(TEXT("Material Interface"));
+	static const FName LifeTimeName(TEXT("LifeTime"));
+	static const FName ColorArrayName(TEXT("Color Selection Array_Color"));
+}
+
+void UGASC_WeaponTrailSubsystem::Deinitialize()
+{
+	TrailInstances.Empty();
+	FreeTrailInstances.Empty();
+	MeshTrails.Empty();
+	SystemBindings.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UGASC_WeaponTrailSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Notifies also fire in the animation editor's preview world
+	return Super::DoesSupportWorldType(WorldType) || WorldType == EWorldType::EditorPreview || WorldType == EWorldType::GamePreview;
+}
+
+UNiagaraComponent* UGASC_WeaponTrailSubsystem::BeginTrail(USkeletalMeshComponent* MeshComp, UGASC_WeaponTrail_AnimNotifyState* Notify)
+{
+	if (!MeshComp || !Notify)
+	{
+		return nullptr;
+	}
+
+	// A montage restarting on the same mesh can begin a notify before ending the last one
+	EndTrail(MeshComp, Notify);
+
+	const UGASC_WeaponTrails_DataAsset* TrailData = Notify->WeaponTrailData;
+	UNiagaraComponent* NiagaraComponent = Notify->GetSpawnedEffect(MeshComp);
+	if (!NiagaraComponent || !TrailData)
+	{
+		return nullptr;
+	}
+
+	const int32 InstanceIndex = AllocateTrailInstance();
+	FTrailInstance& Instance = TrailInstances[InstanceIndex];
+	Instance.NiagaraComponent = NiagaraComponent;
+	Instance.TrailData = TrailData;
+	Instance.MeshComp = MeshComp;
+	Instance.Notify = Notify;
+	Instance.Bindings = FindOrResolveBindings(NiagaraComponent->GetAsset());
+	Instance.LastColor = FLinearColor::Transparent;
+	Instance.bDestroyAtEnd = Notify->bDestroyAtEnd;
+
+	MeshTrails.FindOrAdd(MeshComp).Add(InstanceIndex);
+
+	const FGASC_WeaponTrailBindings& Bindings = Instance.Bindings;
+	if (Bindings.bHasMaterialInterface)
+	{
+		if (TrailData->WeaponTrailMaterialInterface)
+		{
+			NiagaraComponent->SetVariableMaterial(Bindings.MaterialInterfaceName, TrailData->WeaponTrailMaterialInterface);
+		}
+		else
+		{
+			UE_LOG(LogGASCourseWeaponTrail, Warning, TEXT("Invalid Weapon Trail Material Interface in Weapon Trail Data: %s found in %s. Please fix."),
+				*GetPathNameSafe(TrailData), *GetPathNameSafe(Notify));
+		}
+	}
+
+	if (Bindings.bHasLifeTime)
+	{
+		NiagaraComponent->SetVariableFloat(Bindings.LifeTimeName, TrailData->TrailLifeTime);
+	}
+
+	PushColor(Instance, *NiagaraComponent, TrailData->GetBakedColor(0.0f));
+
+	return NiagaraComponent;
+}
+
+void UGASC_WeaponTrailSubsystem::UpdateTrail(const USkeletalMeshComponent* MeshComp, const UGASC_WeaponTrail_AnimNotifyState* Notify, float TimeRatio)
+{
+	const int32 InstanceIndex = FindTrailIndex(MeshComp, Notify);
+	if (InstanceIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FTrailInstance& Instance = TrailInstances[InstanceIndex];
+	UNiagaraComponent* NiagaraComponent = Instance.NiagaraComponent.Get();
+	const UGASC_WeaponTrails_DataAsset* TrailData = Instance.TrailData.Get();
+	if (!NiagaraComponent || !TrailData)
+	{
+		return;
+	}
+
+	PushColor(Instance, *NiagaraComponent, TrailData->GetBakedColor(TimeRatio));
+}
+
+void UGASC_WeaponTrailSubsystem::EndTrail(const USkeletalMeshComponent* MeshComp, const UGASC_WeaponTrail_AnimNotifyState* Notify)
+{
+	const int32 InstanceIndex = FindTrailIndex(MeshComp, Notify);
+	if (InstanceIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (UNiagaraComponent* NiagaraComponent = TrailInstances[InstanceIndex].NiagaraComponent.Get())
+	{
+		// Both paths hand the component back to the Niagara pool once it is inactive
+		if (TrailInstances[InstanceIndex].bDestroyAtEnd)
+		{
+			NiagaraComponent->DeactivateImmediate();
+		}
+		else
+		{
+			NiagaraComponent->Deactivate();
+		}
+	}
+
+	ReleaseTrailInstance(InstanceIndex);
+}
+
+UNiagaraComponent* UGASC_WeaponTrailSubsystem::FindTrailComponent(const USkeletalMeshComponent* MeshComp,
+	const UGASC_WeaponTrail_AnimNotifyState* Notify) const
+{
+	const int32 InstanceIndex = FindTrailIndex(MeshComp, Notify);
+	return InstanceIndex != INDEX_NONE ? TrailInstances[InstanceIndex].NiagaraComponent.Get() : nullptr;
+}
+
+const FGASC_WeaponTrailBindings& UGASC_WeaponTrailSubsystem::FindOrResolveBindings(const UNiagaraSystem* System)
+{
+	if (const FGASC_WeaponTrailBindings* Existing = SystemBindings.Find(System))
+	{
+		return *Existing;
+	}
+
+	FGASC_WeaponTrailBindings& Bindings = SystemBindings.Add(System);
+	Bindings.MaterialInterfaceName = GASC_WeaponTrail::MaterialInterfaceName;
+	Bindings.LifeTimeName = GASC_WeaponTrail::LifeTimeName;
+	Bindings.ColorArrayName = GASC_WeaponTrail::ColorArrayName;
+
+	if (!System)
+	{
+		return Bindings;
+	}
+
+	// Exposed parameters carry the user namespace; the component setters take the bare name
+	const FName UserMaterialInterfaceName(*(TEXT("User.") + Bindings.MaterialInterfaceName.ToString()));
+	const FName UserLifeTimeName(*(TEXT("User.") + Bindings.LifeTimeName.ToString()));
+	const FName UserColorArrayName(*(TEXT("User.") + Bindings.ColorArrayName.ToString()));
+
+	for (const FNiagaraVariableWithOffset& Parameter : System->GetExposedParameters().ReadParameterVariables())
+	{
+		const FName ParameterName = Parameter.GetName();
+		Bindings.bHasMaterialInterface |= ParameterName == UserMaterialInterfaceName;
+		Bindings.bHasLifeTime |= ParameterName == UserLifeTimeName;
+		Bindings.bHasColorArray |= ParameterName == UserColorArrayName;
+	}
+
+	if (!Bindings.bHasColorArray)
+	{
+		UE_LOG(LogGASCourseWeaponTrail, Warning, TEXT("Weapon trail system %s does not expose %s; trail color will not be driven."),
+			*GetPathNameSafe(System), *UserColorArrayName.ToString());
+	}
+
+	return Bindings;
+}
+
+int32 UGASC_WeaponTrailSubsystem::FindTrailIndex(const USkeletalMeshComponent* MeshComp, const UGASC_WeaponTrail_AnimNotifyState* Notify) const
+{
+	const TArray<int32, TInlineAllocator<2>>* Trails = MeshTrails.Find(MeshComp);
+	if (!Trails)
+	{
+		return INDEX_NONE;
+	}
+
+	const TObjectKey<UGASC_WeaponTrail_AnimNotifyState> NotifyKey(Notify);
+	for (const int32 InstanceIndex : *Trails)
+	{
+		if (TrailInstances[InstanceIndex].Notify == NotifyKey)
+		{
+			return InstanceIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 UGASC_WeaponTrailSubsystem::AllocateTrailInstance()
+{
+	if (FreeTrailInstances.IsEmpty())
+	{
+		// Only look for leaked trails when the pool would otherwise grow
+		PruneStaleTrails();
+	}
+
+	const int32 InstanceIndex = !FreeTrailInstances.IsEmpty() ? FreeTrailInstances.Pop(EAllowShrinking::No) : TrailInstances.AddDefaulted();
+	TrailInstances[InstanceIndex].bInUse = true;
+	return InstanceIndex;
+}
+
+void UGASC_WeaponTrailSubsystem::ReleaseTrailInstance(int32 InstanceIndex)
+{
+	FTrailInstance& Instance = TrailInstances[InstanceIndex];
+	if (!Instance.bInUse)
+	{
+		return;
+	}
+
+	if (TArray<int32, TInlineAllocator<2>>* Trails = MeshTrails.Find(Instance.MeshComp))
+	{
+		Trails->RemoveSingleSwap(InstanceIndex, EAllowShrinking::No);
+		if (Trails->IsEmpty())
+		{
+			MeshTrails.Remove(Instance.MeshComp);
+		}
+	}
+
+	Instance = FTrailInstance();
+	FreeTrailInstances.Add(InstanceIndex);
+}
+
+void UGASC_WeaponTrailSubsystem::PruneStaleTrails()
+{
+	for (int32 InstanceIndex = 0; InstanceIndex < TrailInstances.Num(); ++InstanceIndex)
+	{
+		const FTrailInstance& Instance = TrailInstances[InstanceIndex];
+		if (Instance.bInUse && (!Instance.NiagaraComponent.IsValid() || !Instance.MeshComp.ResolveObjectPtr()))
+		{
+			ReleaseTrailInstance(InstanceIndex);
+		}
+	}
+}
+
+void UGASC_WeaponTrailSubsystem::PushColor(FTrailInstance& Instance, UNiagaraComponent& NiagaraComponent, const FLinearColor& Color) const
+{
+	if (!Instance.Bindings.bHasColorArray || Color == Instance.LastColor)
+	{
+		return;
+	}
+
+	// Writes the single element in place instead of rebuilding the array parameter
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayColorValue(&NiagaraComponent, Instance.Bindings.ColorArrayName, 0, Color, true);
+	Instance.LastColor = Color;
+}
@@ -2,8 +2,118 @@
 
 
 #include "Game/Systems/WeaponTrails/GASC_WeaponTrails_DataAsset.h"
+#include "Curves/CurveLinearColor.h"
 
 UGASC_WeaponTrails_DataAsset::UGASC_WeaponTrails_DataAsset(const FObjectInitializer& ObjectInitializer)
 {
 
-}
\ No newline at end of file
+}
+
+void UGASC_WeaponTrails_DataAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	BakeColorSamples();
+
+#if WITH_EDITOR
+	BindColorCurveChanged();
+#endif
+}
+
+void UGASC_WeaponTrails_DataAsset::BeginDestroy()
+{
+#if WITH_EDITOR
+	UnbindColorCurveChanged();
+#endif
+
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UGASC_WeaponTrails_DataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BakeColorSamples();
+	BindColorCurveChanged();
+}
+
+void UGASC_WeaponTrails_DataAsset::BindColorCurveChanged()
+{
+	if (BoundColorCurve.Get() == ColorCurve)
+	{
+		return;
+	}
+
+	UnbindColorCurveChanged();
+	if (!ColorCurve)
+	{
+		return;
+	}
+
+	BoundColorCurve = ColorCurve;
+	ColorCurveUpdatedHandle = ColorCurve->OnUpdateCurve.AddUObject(this, &ThisClass::OnColorCurveUpdated);
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &ThisClass::OnObjectPropertyChanged);
+}
+
+void UGASC_WeaponTrails_DataAsset::UnbindColorCurveChanged()
+{
+	if (UCurveLinearColor* Curve = BoundColorCurve.Get())
+	{
+		Curve->OnUpdateCurve.Remove(ColorCurveUpdatedHandle);
+	}
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+
+	BoundColorCurve.Reset();
+	ColorCurveUpdatedHandle.Reset();
+	ObjectPropertyChangedHandle.Reset();
+}
+
+void UGASC_WeaponTrails_DataAsset::OnColorCurveUpdated(UCurveBase* Curve, EPropertyChangeType::Type ChangeType)
+{
+	BakeColorSamples();
+}
+
+void UGASC_WeaponTrails_DataAsset::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Color adjustments on the curve asset change its output without going through the curve editor
+	if (Object && Object == BoundColorCurve.Get())
+	{
+		BakeColorSamples();
+	}
+}
+#endif
+
+void UGASC_WeaponTrails_DataAsset::BakeColorSamples()
+{
+	BakedColorSamples.Reset();
+
+	UCurveLinearColor* Curve = ColorCurve.Get();
+	if (!Curve)
+	{
+		return;
+	}
+
+	// During PostLoad the curve may not have finished loading its keys yet
+	Curve->ConditionalPostLoad();
+
+	BakedColorSamples.SetNumUninitialized(NumBakedColorSamples);
+	for (int32 Index = 0; Index < NumBakedColorSamples; ++Index)
+	{
+		BakedColorSamples[Index] = Curve->GetLinearColorValue(static_cast<float>(Index) / (NumBakedColorSamples - 1));
+	}
+}
+
+FLinearColor UGASC_WeaponTrails_DataAsset::GetBakedColor(float Ratio) const
+{
+	if (BakedColorSamples.IsEmpty())
+	{
+		return FLinearColor::White;
+	}
+
+	const float SamplePosition = FMath::Clamp(Ratio, 0.0f, 1.0f) * (BakedColorSamples.Num() - 1);
+	const int32 LowerIndex = FMath::FloorToInt32(SamplePosition);
+	const int32 UpperIndex = FMath::Min(LowerIndex + 1, BakedColorSamples.Num() - 1);
+
+	return FMath::Lerp(BakedColorSamples[LowerIndex], BakedColorSamples[UpperIndex], SamplePosition - LowerIndex);
+}
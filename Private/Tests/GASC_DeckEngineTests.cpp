@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Game/Deck/GASC_DeckEngine.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASC_DeckEngineShuffleCardIntoActiveDeckTest, "GASCourse.Deck.DeckEngine.ShuffleCardIntoActiveDeck",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGASC_DeckEngineShuffleCardIntoActiveDeckTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumDeckCards = 5;
+
+	// Enough seeds that the inserted card lands in every slot, including the bottom and the top
+	TSet<int32> LandedSlots;
+	for (int32 Seed = 0; Seed < 32; ++Seed)
+	{
+		TArray<FCardInstance> StartingDeck;
+		StartingDeck.SetNum(NumDeckCards);
+		const FCardInstance ShuffledCard;
+
+		FGASC_DeckEngine Deck;
+		Deck.Initialize(StartingDeck, {}, {ShuffledCard}, {});
+		Deck.SetShuffleSeed(Seed);
+
+		if (!TestTrue(TEXT("A card in the deck can be shuffled in"), Deck.ShuffleCardIntoActiveDeck(ShuffledCard.CardInstanceId)))
+		{
+			return false;
+		}
+
+		const TArray<FCardInstance>& ActiveDeck = Deck.GetPile(EGASC_DeckPile::ActiveDeck);
+		TestEqual(TEXT("The card left the hand"), Deck.GetNumCards(EGASC_DeckPile::Hand), 0);
+		if (!TestEqual(TEXT("The card joined the active deck"), ActiveDeck.Num(), NumDeckCards + 1))
+		{
+			return false;
+		}
+
+		// Removing the inserted card must give back the starting deck in its original order
+		TArray<FGuid> RemainingOrder;
+		for (int32 Slot = 0; Slot < ActiveDeck.Num(); ++Slot)
+		{
+			const FGuid& CardInstanceId = ActiveDeck[Slot].CardInstanceId;
+			EGASC_DeckPile FoundPile = EGASC_DeckPile::Hand;
+			const FCardInstance* FoundCard = Deck.FindCard(CardInstanceId, &FoundPile);
+			TestTrue(TEXT("Every slot stays indexed"), FoundCard == &ActiveDeck[Slot] && FoundPile == EGASC_DeckPile::ActiveDeck);
+
+			if (CardInstanceId == ShuffledCard.CardInstanceId)
+			{
+				LandedSlots.Add(Slot);
+			}
+			else
+			{
+				RemainingOrder.Add(CardInstanceId);
+			}
+		}
+
+		for (int32 Slot = 0; Slot < NumDeckCards; ++Slot)
+		{
+			TestEqual(TEXT("The other cards keep their order"), RemainingOrder[Slot], StartingDeck[Slot].CardInstanceId);
+		}
+	}
+
+	TestTrue(TEXT("The card can land at the bottom"), LandedSlots.Contains(0));
+	TestTrue(TEXT("The card can land on top"), LandedSlots.Contains(NumDeckCards));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,161 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GameFramework/Actor.h"
+#include "Game/GameplayAbilitySystem/GASCourseAbilitySystemComponent.h"
+#include "Game/GameplayAbilitySystem/GASCourseNativeGameplayTags.h"
+#include "GASC_AutomationTestWorld.h"
+
+namespace GASC_GameplayEventQueueTests
+{
+	/** A registered ability system in a test world, recording every event it handles as (tag, magnitude). */
+	struct FEventQueueFixture
+	{
+		UWorld* World = nullptr;
+		UGASCourseAbilitySystemComponent* ASC = nullptr;
+		TArray<TPair<FGameplayTag, float>> HandledEvents;
+		FDelegateHandle EventDelegateHandle;
+
+		FEventQueueFixture()
+		{
+			World = GASC_AutomationTest::CreateTestWorld();
+			AActor* Owner = World->SpawnActor<AActor>();
+			ASC = NewObject<UGASCourseAbilitySystemComponent>(Owner);
+			ASC->RegisterComponent();
+
+			EventDelegateHandle = ASC->AddGameplayEventTagContainerDelegate(FGameplayTagContainer::CreateFromArray(TArray<FGameplayTag>{Event_Gameplay_OnHit, Event_OnStatusDeath}),
+				FGameplayEventTagMulticastDelegate::FDelegate::CreateLambda([this](FGameplayTag MatchingTag, const FGameplayEventData* Payload)
+				{
+					HandledEvents.Emplace(MatchingTag, Payload->EventMagnitude);
+				}));
+		}
+
+		~FEventQueueFixture()
+		{
+			GASC_AutomationTest::DestroyTestWorld(World);
+		}
+
+		void Queue(FGameplayTag EventTag, float Magnitude, bool bAllowMerge = false, AActor* Instigator = nullptr)
+		{
+			FGameplayEventData EventData;
+			EventData.EventTag = EventTag;
+			EventData.EventMagnitude = Magnitude;
+			EventData.Instigator = Instigator;
+			ASC->QueueGameplayEvent(EventTag, MoveTemp(EventData), bAllowMerge);
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASC_GameplayEventQueueOrderTest, "GASCourse.AbilitySystem.GameplayEventQueue.Order",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGASC_GameplayEventQueueOrderTest::RunTest(const FString& Parameters)
+{
+	GASC_GameplayEventQueueTests::FEventQueueFixture Fixture;
+
+	Fixture.Queue(Event_Gameplay_OnHit, 1.0f);
+	Fixture.Queue(Event_OnStatusDeath, 2.0f);
+	Fixture.Queue(Event_Gameplay_OnHit, 3.0f);
+	TestEqual(TEXT("Queued events wait for the flush"), Fixture.HandledEvents.Num(), 0);
+
+	Fixture.ASC->FlushGameplayEventQueue();
+	if (TestEqual(TEXT("Every queued event is handled"), Fixture.HandledEvents.Num(), 3))
+	{
+		TestEqual(TEXT("First sent is handled first"), Fixture.HandledEvents[0].Value, 1.0f);
+		TestEqual(TEXT("Second sent is handled second"), Fixture.HandledEvents[1].Value, 2.0f);
+		TestEqual(TEXT("Unmergeable repeats are handled separately"), Fixture.HandledEvents[2].Value, 3.0f);
+	}
+
+	Fixture.ASC->FlushGameplayEventQueue();
+	TestEqual(TEXT("A flush handles each event once"), Fixture.HandledEvents.Num(), 3);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASC_GameplayEventQueueMergeTest, "GASCourse.AbilitySystem.GameplayEventQueue.Merge",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGASC_GameplayEventQueueMergeTest::RunTest(const FString& Parameters)
+{
+	GASC_GameplayEventQueueTests::FEventQueueFixture Fixture;
+	AActor* OtherInstigator = Fixture.World->SpawnActor<AActor>();
+
+	Fixture.Queue(Event_Gameplay_OnHit, 1.0f, true);
+	Fixture.Queue(Event_OnStatusDeath, 10.0f);
+	Fixture.Queue(Event_Gameplay_OnHit, 2.0f, true);
+	Fixture.Queue(Event_Gameplay_OnHit, 100.0f, true, OtherInstigator);
+	Fixture.Queue(Event_Gameplay_OnHit, 1000.0f, false);
+
+	Fixture.ASC->FlushGameplayEventQueue();
+	if (TestEqual(TEXT("Only matching mergeable events merge"), Fixture.HandledEvents.Num(), 4))
+	{
+		TestEqual(TEXT("Merged event keeps the first position and sums magnitudes"), Fixture.HandledEvents[0].Value, 3.0f);
+		TestEqual(TEXT("Other tags keep their position"), Fixture.HandledEvents[1].Value, 10.0f);
+		TestEqual(TEXT("Another instigator does not merge"), Fixture.HandledEvents[2].Value, 100.0f);
+		TestEqual(TEXT("An unmergeable event does not merge"), Fixture.HandledEvents[3].Value, 1000.0f);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASC_GameplayEventQueueReentrancyTest, "GASCourse.AbilitySystem.GameplayEventQueue.Reentrancy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGASC_GameplayEventQueueReentrancyTest::RunTest(const FString& Parameters)
+{
+	GASC_GameplayEventQueueTests::FEventQueueFixture Fixture;
+
+	// The first handled event queues another one from inside the flush
+	bool bQueuedFromHandler = false;
+	Fixture.ASC->AddGameplayEventTagContainerDelegate(FGameplayTagContainer(Event_Gameplay_OnHit),
+		FGameplayEventTagMulticastDelegate::FDelegate::CreateLambda([&Fixture, &bQueuedFromHandler](FGameplayTag, const FGameplayEventData*)
+		{
+			if (!bQueuedFromHandler)
+			{
+				bQueuedFromHandler = true;
+				Fixture.Queue(Event_OnStatusDeath, 3.0f);
+			}
+		}));
+
+	Fixture.Queue(Event_Gameplay_OnHit, 1.0f);
+	Fixture.Queue(Event_OnStatusDeath, 2.0f);
+
+	Fixture.ASC->FlushGameplayEventQueue();
+	if (TestEqual(TEXT("Events queued during a flush are handled by it"), Fixture.HandledEvents.Num(), 3))
+	{
+		TestEqual(TEXT("Already queued events come first"), Fixture.HandledEvents[1].Value, 2.0f);
+		TestEqual(TEXT("Events queued during the flush come last"), Fixture.HandledEvents[2].Value, 3.0f);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASC_GameplayEventQueueCapacityTest, "GASCourse.AbilitySystem.GameplayEventQueue.Capacity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGASC_GameplayEventQueueCapacityTest::RunTest(const FString& Parameters)
+{
+	GASC_GameplayEventQueueTests::FEventQueueFixture Fixture;
+	constexpr int32 Capacity = UGASCourseAbilitySystemComponent::GameplayEventQueueCapacity;
+
+	for (int32 EventIndex = 0; EventIndex < Capacity; ++EventIndex)
+	{
+		Fixture.Queue(Event_Gameplay_OnHit, static_cast<float>(EventIndex));
+	}
+	TestEqual(TEXT("A full queue still waits for the flush"), Fixture.HandledEvents.Num(), 0);
+
+	Fixture.Queue(Event_Gameplay_OnHit, static_cast<float>(Capacity));
+	if (TestEqual(TEXT("Sending to a full queue flushes it first"), Fixture.HandledEvents.Num(), Capacity))
+	{
+		TestEqual(TEXT("The overflowing event is not handled ahead of the queue"), Fixture.HandledEvents.Last().Value, Capacity - 1.0f);
+	}
+
+	Fixture.ASC->FlushGameplayEventQueue();
+	if (TestEqual(TEXT("The overflowing event is queued for the next flush"), Fixture.HandledEvents.Num(), Capacity + 1))
+	{
+		TestEqual(TEXT("The overflowing event is handled last"), Fixture.HandledEvents.Last().Value, static_cast<float>(Capacity));
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
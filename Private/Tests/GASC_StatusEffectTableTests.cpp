@@ -0,0 +1,178 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "NativeGameplayTags.h"
+#include "Game/GameplayAbilitySystem/GameplayTagResponseTable/GASCourseStatusEffectTable.h"
+#include "HAL/PlatformTime.h"
+
+namespace GASC_StatusEffectTableTests
+{
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(Test_StatusEffectTable_EntryA, "Test.StatusEffectTable.EntryA");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(Test_StatusEffectTable_EntryA_Child, "Test.StatusEffectTable.EntryA.Child");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(Test_StatusEffectTable_EntryB, "Test.StatusEffectTable.EntryB");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(Test_StatusEffectTable_Burn, "Effect.Gameplay.Status.Test.Burn");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(Test_StatusEffectTable_Chill, "Effect.Gameplay.Status.Test.Chill");
+
+	FGameplayTagEventResponsePair MakePair(FGameplayTag StatusEffectStateTag, TSubclassOf<UGameplayEffect> ResponseGameplayEffect)
+	{
+		FGameplayTagEventResponsePair Pair;
+		Pair.StatusEffectStateTag = StatusEffectStateTag;
+		Pair.ResponseGameplayEffect = ResponseGameplayEffect;
+		return Pair;
+	}
+
+	using FUncompiledEffectArray = TArray<TSubclassOf<UGameplayEffect>, TInlineAllocator<4>>;
+
+	/**
+	 * The lookup the table did before it was compiled, kept verbatim (minus the ensure) as the reference for both
+	 * results and speed: a by-value scan of every entry on every hit.
+	 */
+	void FindResponseEffectsUncompiled(const UGASCourseStatusEffectTable& Table, const FGameplayTagContainer& StatusEffectTags,
+		FUncompiledEffectArray& OutEffects)
+	{
+		OutEffects.Reset();
+
+		FGameplayTagEventResponseTableEntry FoundStatusEffectEntry;
+		FGameplayTag FoundStatusTag;
+		bool bHasFoundTag = false;
+		for (FGameplayTagEventResponseTableEntry Entry : Table.Entries)
+		{
+			if (StatusEffectTags.HasTag(Entry.StatusEffectTag))
+			{
+				FoundStatusEffectEntry = Entry;
+				for (FGameplayTag StatusTag : StatusEffectTags.GetGameplayTagArray())
+				{
+					if (StatusTag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Effect.Gameplay.Status"))))
+					{
+						FoundStatusTag = StatusTag;
+						bHasFoundTag = true;
+						break;
+					}
+				}
+			}
+		}
+
+		if (bHasFoundTag)
+		{
+			for (FGameplayTagEventResponsePair StatusEffectPair : FoundStatusEffectEntry.StatusEffectTypes)
+			{
+				if (StatusEffectPair.StatusEffectStateTag == FoundStatusTag)
+				{
+					OutEffects.Add(StatusEffectPair.ResponseGameplayEffect);
+				}
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASC_StatusEffectTableLookupTest, "GASCourse.AbilitySystem.StatusEffectTable.Lookup",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGASC_StatusEffectTableLookupTest::RunTest(const FString& Parameters)
+{
+	using namespace GASC_StatusEffectTableTests;
+
+	UGASCourseStatusEffectTable* Table = NewObject<UGASCourseStatusEffectTable>();
+	const TSubclassOf<UGameplayEffect> EffectClass = UGameplayEffect::StaticClass();
+
+	FGameplayTagEventResponseTableEntry& FirstEntry = Table->Entries.AddDefaulted_GetRef();
+	FirstEntry.StatusEffectTag = Test_StatusEffectTable_EntryA;
+	FirstEntry.StatusEffectTypes.Add(MakePair(Test_StatusEffectTable_Burn, EffectClass));
+	FirstEntry.StatusEffectTypes.Add(MakePair(Test_StatusEffectTable_Chill, EffectClass));
+
+	FGameplayTagEventResponseTableEntry& SecondEntry = Table->Entries.AddDefaulted_GetRef();
+	SecondEntry.StatusEffectTag = Test_StatusEffectTable_EntryB;
+	SecondEntry.StatusEffectTypes.Add(MakePair(Test_StatusEffectTable_Burn, EffectClass));
+	SecondEntry.StatusEffectTypes.Add(MakePair(Test_StatusEffectTable_Burn, EffectClass));
+
+	Table->CompileEntries();
+
+	const TArray<FGameplayTagContainer> Queries = {
+		FGameplayTagContainer::CreateFromArray(TArray<FGameplayTag>{Test_StatusEffectTable_EntryA, Test_StatusEffectTable_Burn}),
+		FGameplayTagContainer::CreateFromArray(TArray<FGameplayTag>{Test_StatusEffectTable_EntryA, Test_StatusEffectTable_Chill}),
+		FGameplayTagContainer::CreateFromArray(TArray<FGameplayTag>{Test_StatusEffectTable_EntryA, Test_StatusEffectTable_EntryB, Test_StatusEffectTable_Burn}),
+		FGameplayTagContainer::CreateFromArray(TArray<FGameplayTag>{Test_StatusEffectTable_EntryA, Test_StatusEffectTable_EntryB, Test_StatusEffectTable_Chill}),
+		FGameplayTagContainer(Test_StatusEffectTable_Burn),
+		FGameplayTagContainer(Test_StatusEffectTable_EntryA),
+		FGameplayTagContainer::CreateFromArray(TArray<FGameplayTag>{Test_StatusEffectTable_EntryA_Child, Test_StatusEffectTable_Chill})
+	};
+	const TArray<int32> ExpectedCounts = {1, 1, 2, 0, 0, 0, 1};
+
+	FUncompiledEffectArray Uncompiled;
+	for (int32 QueryIndex = 0; QueryIndex < Queries.Num(); ++QueryIndex)
+	{
+		const UGASCourseStatusEffectTable::FResponseArray* Compiled = Table->FindResponseEffects(Queries[QueryIndex]);
+		const int32 NumCompiled = Compiled ? Compiled->Num() : 0;
+		FindResponseEffectsUncompiled(*Table, Queries[QueryIndex], Uncompiled);
+
+		TestEqual(FString::Printf(TEXT("Query %d finds the expected responses"), QueryIndex), NumCompiled, ExpectedCounts[QueryIndex]);
+		TestEqual(FString::Printf(TEXT("Query %d matches the uncompiled lookup"), QueryIndex), NumCompiled, Uncompiled.Num());
+		for (int32 ResponseIndex = 0; ResponseIndex < FMath::Min(NumCompiled, Uncompiled.Num()); ++ResponseIndex)
+		{
+			TestTrue(FString::Printf(TEXT("Query %d response %d is the same effect"), QueryIndex, ResponseIndex),
+				(*Compiled)[ResponseIndex].Effect == Uncompiled[ResponseIndex].GetDefaultObject());
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASC_StatusEffectTableBenchmark, "GASCourse.AbilitySystem.StatusEffectTable.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FGASC_StatusEffectTableBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace GASC_StatusEffectTableTests;
+
+	// A table about the size of the shipping one: a dozen entries with a few responses each
+	UGASCourseStatusEffectTable* Table = NewObject<UGASCourseStatusEffectTable>();
+	const TSubclassOf<UGameplayEffect> EffectClass = UGameplayEffect::StaticClass();
+	for (int32 EntryIndex = 0; EntryIndex < 12; ++EntryIndex)
+	{
+		FGameplayTagEventResponseTableEntry& Entry = Table->Entries.AddDefaulted_GetRef();
+		Entry.StatusEffectTag = EntryIndex == 11 ? Test_StatusEffectTable_EntryB : Test_StatusEffectTable_EntryA;
+		for (int32 PairIndex = 0; PairIndex < 4; ++PairIndex)
+		{
+			Entry.StatusEffectTypes.Add(MakePair(PairIndex % 2 ? Test_StatusEffectTable_Chill : Test_StatusEffectTable_Burn, EffectClass));
+		}
+	}
+
+	Table->CompileEntries();
+
+	const FGameplayTagContainer HitTags = FGameplayTagContainer::CreateFromArray(TArray<FGameplayTag>{Test_StatusEffectTable_EntryB, Test_StatusEffectTable_Burn});
+	constexpr int32 NumIterations = 100000;
+
+	// The uncompiled scan copies every entry and its response array per hit; the compiled path is a couple of hash
+	// lookups. Anything short of a clear multiple means the compiled path regressed.
+	constexpr double MinSpeedup = 4.0;
+
+	int32 NumFound = 0;
+	FUncompiledEffectArray UncompiledEffects;
+	const double UncompiledStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		FindResponseEffectsUncompiled(*Table, HitTags, UncompiledEffects);
+		NumFound += UncompiledEffects.Num();
+	}
+	const double UncompiledSeconds = FPlatformTime::Seconds() - UncompiledStart;
+
+	const double CompiledStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		const UGASCourseStatusEffectTable::FResponseArray* CompiledEffects = Table->FindResponseEffects(HitTags);
+		NumFound -= CompiledEffects ? CompiledEffects->Num() : 0;
+	}
+	const double CompiledSeconds = FPlatformTime::Seconds() - CompiledStart;
+
+	TestEqual(TEXT("Both lookups find the same responses"), NumFound, 0);
+	AddInfo(FString::Printf(TEXT("Status effect lookup over %d hits: uncompiled %.1f ns/hit, compiled %.1f ns/hit (%.1fx)"),
+		NumIterations, UncompiledSeconds * 1.0e9 / NumIterations, CompiledSeconds * 1.0e9 / NumIterations,
+		CompiledSeconds > 0.0 ? UncompiledSeconds / CompiledSeconds : 0.0));
+	TestTrue(FString::Printf(TEXT("Compiled lookup is at least %.0fx faster than the uncompiled scan"), MinSpeedup),
+		CompiledSeconds * MinSpeedup <= UncompiledSeconds);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
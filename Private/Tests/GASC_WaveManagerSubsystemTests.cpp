@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GameFramework/Pawn.h"
+#include "Game/Systems/WaveManager/GASC_WaveManagerSubsystem.h"
+#include "GASC_AutomationTestWorld.h"
+
+namespace GASC_WaveManagerTests
+{
+	FGASC_WaveDefinition MakeWave(int32 Count)
+	{
+		FGASC_WaveEnemyGroup Group;
+		Group.EnemyClass = TSoftClassPtr<APawn>(APawn::StaticClass());
+		Group.Count = Count;
+
+		FGASC_WaveDefinition Wave;
+		Wave.EnemyGroups.Add(Group);
+		return Wave;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGASC_WaveManagerPoolingTest, "GASCourse.WaveManager.Pooling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGASC_WaveManagerPoolingTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GASC_AutomationTest::CreateTestWorld();
+	UGASC_WaveManagerSubsystem* WaveManager = World->GetSubsystem<UGASC_WaveManagerSubsystem>();
+	if (!TestNotNull(TEXT("Wave manager exists in a game world"), WaveManager))
+	{
+		GASC_AutomationTest::DestroyTestWorld(World);
+		return false;
+	}
+
+	const TSubclassOf<APawn> EnemyClass = APawn::StaticClass();
+	WaveManager->SetWaveDefinitions({GASC_WaveManagerTests::MakeWave(3), GASC_WaveManagerTests::MakeWave(3)});
+
+	const TArray<APawn*> FirstWave = WaveManager->SpawnNextWave(FVector::ZeroVector);
+	TestEqual(TEXT("First wave spawns every enemy"), FirstWave.Num(), 3);
+	TestEqual(TEXT("Spawned enemies are active"), WaveManager->GetNumActiveEnemies(), 3);
+	TestEqual(TEXT("Spawned enemies leave the pool"), WaveManager->GetNumPooledEnemies(EnemyClass), 0);
+
+	for (APawn* Enemy : FirstWave)
+	{
+		WaveManager->ReleaseEnemy(Enemy);
+		TestTrue(TEXT("Released enemy is hidden"), Enemy->IsHidden());
+	}
+	TestEqual(TEXT("Released enemies are no longer active"), WaveManager->GetNumActiveEnemies(), 0);
+	TestEqual(TEXT("Released enemies return to the pool"), WaveManager->GetNumPooledEnemies(EnemyClass), 3);
+
+	const TArray<APawn*> SecondWave = WaveManager->SpawnNextWave(FVector::ZeroVector);
+	TestEqual(TEXT("Second wave spawns every enemy"), SecondWave.Num(), 3);
+	for (APawn* Enemy : SecondWave)
+	{
+		TestTrue(TEXT("Second wave reuses pooled pawns"), FirstWave.Contains(Enemy));
+	}
+	TestEqual(TEXT("Second wave drains the pool"), WaveManager->GetNumPooledEnemies(EnemyClass), 0);
+
+	SecondWave[0]->Destroy();
+	TestEqual(TEXT("Destroyed enemy is dropped from the active set"), WaveManager->GetNumActiveEnemies(), 2);
+
+	TestTrue(TEXT("Finished wave list spawns nothing"), WaveManager->SpawnNextWave(FVector::ZeroVector).IsEmpty());
+
+	GASC_AutomationTest::DestroyTestWorld(World);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
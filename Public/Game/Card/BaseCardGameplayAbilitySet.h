@@ -5,6 +5,7 @@
 #include "Game/GameplayAbilitySystem/GASCourseGameplayAbilitySet.h"
 #include "Engine/StreamableManager.h"
 #include "Game/GameplayAbilitySystem/GameplayEffect/Ability/GASC_AbilityDurationEffect.h"
+#include "Game/Card/GASC_CardGrantTypes.h"
 #include "BaseCardGameplayAbilitySet.generated.h"
 
 class UAssetManager;
@@ -106,23 +107,6 @@ struct FGASCourseCardAbilitySet_AttributeSet
 	TSubclassOf<UGASCourseAttributeSet> AttributeSet;
 };
 
-USTRUCT(BlueprintType)
-struct FGASCourseCardAbilitySet_GrantedHandles
-{
-	GENERATED_BODY()
-
-public:
-	void AddAbilitySpecHandle(const FGameplayAbilitySpecHandle& Handle);
-	void AddGameplayEffectHandle(const FActiveGameplayEffectHandle& Handle);
-	void AddAttributeSet(UGASCourseAttributeSet* Set);
-	void TakeFromAbilitySystem(UAbilitySystemComponent* ASC);
-
-protected:
-	UPROPERTY() TArray<FGameplayAbilitySpecHandle> AbilitySpecHandles;
-	UPROPERTY() TArray<FActiveGameplayEffectHandle> GameplayEffectHandles;
-	UPROPERTY() TArray<TObjectPtr<UGASCourseAttributeSet>> GrantedAttributeSets;
-};
-
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCardDataLoaded, bool, bLoadSuccess);
 
 /**
@@ -161,11 +145,21 @@ public:
 	// Grants the ability set to the specified ability system component.
 	// The returned handles can be used later to take away anything that was granted.
 	void GiveToAbilitySystem(UAbilitySystemComponent* ASC, int32 CardLevel,
-		FGASCourseAbilitySet_GrantedHandles* OutGrantedHandles, 
+		FGASCourseCardAbilitySet_GrantedHandles* OutGrantedHandles, 
 		UObject* SourceObject = nullptr) const;
+
+	// Grants the ability set into a grant record previously reserved on ASC, at the record's card level.
+	void GiveToAbilitySystem(UGASCourseAbilitySystemComponent* ASC, const FGASC_CardGrantHandle& GrantHandle) const;
 	
+	// Activates the card without tying it to a deck card instance. OutGrantHandle is the only way back to what the
+	// activation granted; pass it to UGASCourseAbilitySystemComponent::RevokeCardGrant when the activation ends.
 	UFUNCTION(BlueprintCallable, Category="Card")
-	bool ActivateCard(UAbilitySystemComponent* ASC, int32 CardLevel = 1, bool bAutoLoadThenActivate = true);
+	bool ActivateCard(UAbilitySystemComponent* ASC, FGASC_CardGrantHandle& OutGrantHandle, int32 CardLevel = 1, bool bAutoLoadThenActivate = true);
+
+	// Activates the card for a single deck card instance. OutGrantHandle addresses the activation's grant record on
+	// the ASC, and is valid even while the grant is waiting on the card data to load.
+	bool ActivateCardInstance(UAbilitySystemComponent* ASC, int32 CardLevel, const FGuid& CardInstanceId,
+		FGASC_CardGrantHandle& OutGrantHandle, bool bAutoLoadThenActivate = true);
 	
 	UFUNCTION(BlueprintCallable, Category="Card")
 	void LoadCardDataAsync();
@@ -173,9 +167,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Card")
 	bool IsCardDataLoaded() const { return bCardDataLoaded; }
 	
-	UFUNCTION(BlueprintCallable, Category="Card")
-	void OverrideCardLevel(float InCardLevelOverride);
-	
 	UPROPERTY(BlueprintAssignable, Category="Card")
 	FOnCardDataLoaded OnCardDataLoaded;
 	
@@ -202,16 +193,14 @@ private:
 	
 	bool bCardDataLoaded = false;
 	bool bCardDataLoading = false;
-	int32 CardLevel_Internal = 1;
 	
 	TSharedPtr<FStreamableHandle> CardDataLoadHandle;
 	
 	// If ActivateCard called before load, we can optionally auto-grant after load
 	struct FPendingActivation
 	{
-		TWeakObjectPtr<UAbilitySystemComponent> ASC;
-		FGASCourseAbilitySet_GrantedHandles* Handles = nullptr; // caller-owned
-		TWeakObjectPtr<UObject> SourceObject;
+		TWeakObjectPtr<UGASCourseAbilitySystemComponent> ASC;
+		FGASC_CardGrantHandle GrantHandle; // record owned by the ASC
 	};
 
 	// NOTE: This is shared per DataAsset, so keep it minimal.
@@ -0,0 +1,91 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ActiveGameplayEffectHandle.h"
+#include "GameplayAbilitySpecHandle.h"
+#include "GASC_CardGrantTypes.generated.h"
+
+class UAbilitySystemComponent;
+class UBaseCardGameplayAbilitySet;
+class UGASCourseAttributeSet;
+
+USTRUCT(BlueprintType)
+struct FGASCourseCardAbilitySet_GrantedHandles
+{
+	GENERATED_BODY()
+
+public:
+	void AddAbilitySpecHandle(const FGameplayAbilitySpecHandle& Handle);
+	void AddGameplayEffectHandle(const FActiveGameplayEffectHandle& Handle);
+	void AddAttributeSet(UGASCourseAttributeSet* Set);
+	void TakeFromAbilitySystem(UAbilitySystemComponent* ASC);
+
+	bool RemoveAbilitySpecHandle(const FGameplayAbilitySpecHandle& Handle);
+
+	const TArray<FGameplayAbilitySpecHandle>& GetAbilitySpecHandles() const { return AbilitySpecHandles; }
+
+	bool IsEmpty() const { return AbilitySpecHandles.IsEmpty() && GameplayEffectHandles.IsEmpty() && GrantedAttributeSets.IsEmpty(); }
+
+protected:
+	UPROPERTY() TArray<FGameplayAbilitySpecHandle> AbilitySpecHandles;
+	UPROPERTY() TArray<FActiveGameplayEffectHandle> GameplayEffectHandles;
+	UPROPERTY() TArray<TObjectPtr<UGASCourseAttributeSet>> GrantedAttributeSets;
+};
+
+/**
+ * @brief Generational handle to a single card activation's grant record on a UGASCourseAbilitySystemComponent.
+ *
+ * Index addresses a slot in the component's record pool; Generation is bumped every time that slot is released,
+ * so a handle kept after its grants were revoked can never alias a later activation that reused the slot.
+ */
+USTRUCT(BlueprintType)
+struct FGASC_CardGrantHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY()
+	int32 Generation = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; Generation = 0; }
+
+	bool operator==(const FGASC_CardGrantHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FGASC_CardGrantHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FGASC_CardGrantHandle& Handle)
+	{
+		return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation));
+	}
+};
+
+/**
+ * Everything one activation of a card ability set granted, plus the level it was activated at.
+ * Records are pooled by the owning ability system component; a released record keeps its array storage for reuse.
+ */
+USTRUCT()
+struct FGASC_CardGrantRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGASCourseCardAbilitySet_GrantedHandles GrantedHandles;
+
+	TWeakObjectPtr<const UBaseCardGameplayAbilitySet> CardAbilitySet;
+
+	/** The deck card this activation came from; invalid for activations not tied to a card instance. */
+	UPROPERTY()
+	FGuid CardInstanceId;
+
+	UPROPERTY()
+	int32 CardLevel = 1;
+
+	UPROPERTY()
+	int32 Generation = 0;
+
+	UPROPERTY()
+	bool bInUse = false;
+};
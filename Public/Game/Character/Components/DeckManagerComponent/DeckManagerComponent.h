@@ -4,6 +4,7 @@
 
 #include "Components/ActorComponent.h"
 #include "Game/Card/CardDataAsset.h"
+#include "Game/Deck/GASC_DeckEngine.h"
 #include "DeckManagerComponent.generated.h"
 
 /**
@@ -16,23 +17,6 @@
  * The class is designed to work with collections of UCardDataAsset objects, providing functionality via Blueprint and C++ APIs.
  */
 
-USTRUCT(BlueprintType)
-struct FCardInstance
-{
-	GENERATED_BODY()
-	
-	UPROPERTY(BlueprintReadOnly, SaveGame)
-	FGuid CardInstanceId = FGuid::NewGuid();
-	
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, SaveGame)
-	TSoftObjectPtr<UCardDataAsset> CardDataAsset;
-	
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, SaveGame)
-	int32 CardLevel = 1;
-	
-	bool IsValid() const {return CardInstanceId.IsValid() && CardDataAsset.IsValid();}
-};
-
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDeckManager_OnCardActivated, const FCardInstance&, Card);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDeckManager_OnCardAddedToHand, const FCardInstance&, Card);
 
@@ -56,56 +40,24 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
-	/**
-	 * Represents the active set of cards currently in play within the deck system.
-	 *
-	 * This array is managed by the deck handling component to track and store instances of cards
-	 * that are actively in use during gameplay or processing. It enables operations like drawing,
-	 * updating, or manipulating cards that are part of the active deck.
-	 *
-	 * Designed to work seamlessly within the Unreal Engine framework, this variable supports both
-	 * Blueprint and C++ access for efficient integration and flexibility in deck-related systems.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Deck")
+	// The four piles below are seed data only. They fill the persistent deck the first time this owner's deck is
+	// created and are never written back, so they are not exposed to Blueprint; read the live piles through
+	// GetCardsInPile.
+
+	/** Cards the active deck starts with; the last element is the top card. */
+	UPROPERTY(EditAnywhere, Category="Deck|Starting Piles", meta=(DisplayName="Starting Active Deck"))
 	TArray<FCardInstance> ActiveDeckInstance;
 
-	/**
-	 * An array that stores the collection of card instances managed by the deck system.
-	 *
-	 * Represents the primary container for cards within a deck, supporting functionalities such as modifications,
-	 * shuffling, and retrieval of card data. This array is primarily used in conjunction with the deck management
-	 * systems to facilitate game mechanics or application features involving card operations.
-	 *
-	 * Accessible via both Blueprint and C++ for flexibility in game or application development workflows.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Deck")
+	/** Cards the binder starts with. */
+	UPROPERTY(EditAnywhere, Category="Deck|Starting Piles", meta=(DisplayName="Starting Binder"))
 	TArray<FCardInstance> CardBinderInstance;
 
-	/**
-	 * Represents the current set of cards held in the player's hand within the deck management system.
-	 *
-	 * This array contains instances of FCardInstance, each of which corresponds to an individual card currently in play
-	 * as part of the active hand. It is primarily used to track cards that have been drawn from the deck but not yet
-	 * returned, discarded, or otherwise removed from play.
-	 *
-	 * The property is accessible both in the editor and during runtime, allowing designers and developers to inspect
-	 * and modify the current hand state via Blueprint or other tools.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Deck")
+	/** Cards the hand starts with. */
+	UPROPERTY(EditAnywhere, Category="Deck|Starting Piles", meta=(DisplayName="Starting Hand"))
 	TArray<FCardInstance> CurrentHandInstance;
 
-	/**
-	 * Represents the collection of discarded card instances within the deck system.
-	 *
-	 * This array tracks card instances that have been moved to the graveyard during gameplay.
-	 * It provides an organized structure to store and manage cards that are no longer active
-	 * in the player's hand or main deck but are retained for future processing or reference.
-	 *
-	 * Typically used to maintain the state of the graveyard for game rules or mechanics that
-	 * interact specifically with discarded cards. Accessible via Blueprint and C++ for
-	 * enhanced customization and gameplay integration.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Deck")
+	/** Cards the graveyard starts with. */
+	UPROPERTY(EditAnywhere, Category="Deck|Starting Piles", meta=(DisplayName="Starting Graveyard"))
 	TArray<FCardInstance> DeckGraveyardInstance;
 
 public:
@@ -157,16 +109,43 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable)
 	static void FindAllCards(TArray<FAssetData>& OutAllCards);
-	
-	//TODO: Add helper functions for both graveyard and active decks
+
+	/**
+	 * Moves a card, wherever it currently is, on top of the given pile.
+	 *
+	 * @return False if no card with this instance ID is in the deck.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deck")
+	bool MoveCardToPile(const FGuid& CardInstanceID, EGASC_DeckPile ToPile);
+
+	/** Inserts a card into the active deck at a random position; the other cards keep their order. */
+	UFUNCTION(BlueprintCallable, Category = "Deck")
+	bool ShuffleCardIntoActiveDeck(const FGuid& CardInstanceID);
+
 	/**
-	 * Deck count -> remaining cards in both active and graveyard decks
-	 * How many cards of type remaining in both active and graveyard decks
-	 * Add card from graveyard to hand
-	 * Add card from graveyard to active deck
-	 * Add card from hand to graveyard
-	 * Add card from hand back into active deck (randomized)
+	 * Takes back everything granted by activations of a card, e.g. once it has left play.
+	 *
+	 * @return The number of activations revoked.
 	 */
+	UFUNCTION(BlueprintCallable, Category = "Deck")
+	int32 RevokeCardActivations(const FGuid& CardInstanceID);
+
+	UFUNCTION(BlueprintCallable, Category = "Deck")
+	void ShuffleActiveDeck();
+
+	/** Seeds the deck's shuffle stream; the same seed and the same sequence of deck operations give the same draws. */
+	UFUNCTION(BlueprintCallable, Category = "Deck")
+	void SetShuffleSeed(int32 Seed);
+
+	UFUNCTION(BlueprintPure, Category = "Deck")
+	int32 GetNumCardsInPile(EGASC_DeckPile Pile) const;
+
+	UFUNCTION(BlueprintPure, Category = "Deck")
+	int32 GetNumCardsOfTypeInPile(TSoftObjectPtr<UCardDataAsset> CardDataAsset, EGASC_DeckPile Pile) const;
+
+	/** The live contents of Pile in the persistent deck. */
+	UFUNCTION(BlueprintPure, Category = "Deck")
+	TArray<FCardInstance> GetCardsInPile(EGASC_DeckPile Pile) const;
 	
 protected:
 	
@@ -174,6 +153,18 @@ protected:
 	UAbilitySystemComponent* AbilitySystemComponent = nullptr;
 	
 private:
+
+	/** Key of this owner's deck in UDeckManagerGameInstanceSubsystem. */
+	FName GetDeckId() const;
+
+	/** The persistent deck held by the game instance, or a component-local deck if the subsystem is unavailable. */
+	FGASC_DeckEngine& GetDeck() const;
+
+	void PreloadCardData() const;
+
+	// Holds only soft references, so it needs no UPROPERTY to be safe from GC
+	mutable FGASC_DeckEngine FallbackDeck;
+
 	/**
 	 * Delegate triggered when a card is activated within the deck system.
 	 *
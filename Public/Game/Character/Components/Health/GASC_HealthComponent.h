@@ -12,8 +12,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHealthViewModelInstantiated, UGAS
 
 /**
  * This class represents a health component for an actor in the game.
- * It provides functionality for managing the current and maximum health values of the actor.
- * The health component also supports replication to ensure consistent gameplay across the network.
+ * It exposes the actor's health to the UI through a UGASC_UVM_Health view model handed out by
+ * UGASC_HealthViewModelSubsystem, which keeps it in sync with the owner's replicated health attribute set.
+ * The component itself holds no replicated state.
  */
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent), Blueprintable )
 class GASCOURSE_API UGASC_HealthComponent : public UActorComponent
@@ -23,133 +24,40 @@ class GASCOURSE_API UGASC_HealthComponent : public UActorComponent
 public:
 	/**
 	 * Default constructor for the UGASC_HealthComponent class.
-	 * Sets up the component to be initialized when the game starts and to be ticked every frame.
-	 * It also enables replication for the component.
+	 * The component never ticks; view model updates are driven by the health view model subsystem.
 	 */
 	UGASC_HealthComponent();
 
+	/**
+	 * Binds the view model to the owner's ability system and, for the locally controlled player, registers it in
+	 * the global view model collection. Call this whenever the owner's ability system or controller changes
+	 * (possession, player state replication); it is also called once from BeginPlay.
+	 */
+	void OnOwnerAbilitySystemInitialized();
 
 protected:
 	virtual void BeginPlay() override;
-	
-	/**
-	 * GetLifetimeReplicatedProps is a method of the UGASC_HealthComponent class.
-	 * It is a const method that overrides the GetLifetimeReplicatedProps method of the UActorComponent class.
-	 * This method is responsible for defining the properties that will be replicated over the network.
-	 * It adds the CurrentHealth and MaxHealth properties to the OutLifetimeProps array using the DOREPLIFETIME macro.
-	 * The replicated properties will be automatically synchronized between the server and clients.
-	 *
-	 * @param OutLifetimeProps - The array of lifetime replicated properties to be populated.
-	 */
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/**
 	 * Initializes the view model for the UGASC_HealthComponent.
 	 *
-	 * The view model is responsible for managing the health-related properties and functions of the UGASC_HealthComponent.
-	 * This method creates a UGASC_UVM_Health instance and adds it to the global view model collection.
-	 * It then sets the HealthViewModel property of the UGASC_HealthComponent to the created instance.
-	 *
-	 * Prerequisites:
-	 * - The UGASC_HealthComponent must be attached to an actor.
-	 * - The owning game instance must have a valid UMVVMGameSubsystem instance.
+	 * Acquires this actor's UGASC_UVM_Health from the UGASC_HealthViewModelSubsystem pool and assigns it to
+	 * HealthViewModel, then broadcasts OnHealthViewModelInstantiated.
 	 *
-	 * @see UGASC_HealthComponent
-	 * @see UMVVMGameSubsystem
-	 * @see UMVVMViewModelCollectionObject
+	 * @see UGASC_HealthViewModelSubsystem
 	 * @see UGASC_UVM_Health
-	 * @see FMVVMViewModelContext
-	 * @see CharacterHealthViewModelContextClass
-	 * @see CharacterHealthContextName
 	 * @see HealthViewModel
 	 */
 	UFUNCTION()
 	void InitializeViewModel();
 
 	/**
-	 * @brief CurrentHealth is a float variable that represents the current health of the actor.
-	 * It is replicated using the "OnRep_CurrentHealth" function.
-	 */
-	UPROPERTY(BlueprintReadWrite, ReplicatedUsing="OnRep_CurrentHealth")
-	float CurrentHealth = 0.0f;
-
-	/**
-	 * @brief The maximum health of the actor.
-	 *
-	 * This variable represents the maximum health value that an actor can have.
-	 * It is used in conjunction with the current health variable to determine the health status of the actor.
-	 * The value of this variable should be set according to the specific requirements of the game or application.
-	 *
-	 * @details
-	 * - The variable is of type `float`.
-	 * - It is marked with the `ReplicatedUsing` attribute, indicating that changes to its value will be replicated to all clients.
-	 * - The default value of the variable is `0.0f`.
-	 *
-	 * @note
-	 * - Modifying the value of this variable directly may have unintended side effects.
-	 *   It is recommended to use appropriate functions or methods to update the health value.
-	 * - This variable can be accessed and modified during runtime, as needed.
-	 * - The variable should be synchronized across all instances of the actor in a networked environment to ensure consistent gameplay.
-	 *   The `OnRep_MaxHealth` function will be called when the value of this variable is updated on the server.
-	 *   Therefore, any logic related to synchronizing the value on clients should be implemented in that function.
-	 *
-	 * @see OnRep_MaxHealth
-	 *
-	 * @warning This variable should not be initialized or modified directly in external code.
-	 *          Use appropriate functions or methods within the associated class to manage the health value.
-	 */
-	UPROPERTY(BlueprintReadWrite, ReplicatedUsing="OnRep_MaxHealth")
-	float MaxHealth = 0.0f;
-
-	/**
-	 * Callback function invoked when the replicated property CurrentHealth is replicated to clients.
-	 * This function is automatically called by the engine when the replicated property changes.
-	 * It updates the current health in the health view model, if available.
-	 *
-	 * Usage:
-	 * - Override this function in subclasses of UGASC_HealthComponent to provide custom logic when the current health changes.
-	 * - Within the implementation of the overridden function, call the base implementation first, and then add any additional code specific to the subclass.
-	 * - Example usage:
-	 *   ```cpp
-	 *   void UMyHealthComponent::OnRep_CurrentHealth()
-	 *   {
-	 *       Super::OnRep_CurrentHealth();
-	 *
-	 *       // Custom logic here
-	 *   }
-	 *   ```
-	 * - Note that the base implementation of this function already sets the current health in the health view model if available, so you may not need to modify this behavior in most cases.
-	 */
-	UFUNCTION(BlueprintCallable)
-	virtual void OnRep_CurrentHealth();
-
-	/**
-	 * Called when the MaxHealth property is replicated from the server to the clients.
-	 * This method is automatically called by the Unreal Engine's replication system.
-	 * It updates the Max Health value in the HealthViewModel if it exists.
-	 *
-	 * @remarks
-	 * This method assumes that the HealthViewModel has been properly initialized and assigned.
-	 * If the HealthViewModel is null, no action will be taken.
-	 *
-	 * @see UGASC_HealthViewModel
-	 */
-	UFUNCTION(BlueprintCallable)
-	virtual void OnRep_MaxHealth();
-
-	/**
-	 * Initializes the health attributes for the server.
-	 * This method is called on the server when the health component is being initialized.
-	 * It retrieves the health attribute values from the owning character's ability system component and sets the local CurrentHealth and MaxHealth variables accordingly.
-	 * It also triggers the OnRep_CurrentHealth and OnRep_MaxHealth methods to ensure proper replication.
-	 *
-	 * @note This method should be called on the server only.
+	 * Adds HealthViewModel to the global view model collection under CharacterHealthContextName.
+	 * Only the locally controlled player's health belongs in the global context; other characters would
+	 * evict it, so for them this does nothing.
 	 */
-	UFUNCTION(Reliable, Server)
-	void Server_InitializeHealthAttributes();
-
-	UFUNCTION(Reliable, Client)
-	void Client_InitializeHealthAttributes();
+	void UpdateGlobalViewModelRegistration();
 
 	UPROPERTY(BlueprintAssignable, BlueprintCallable)
 	FOnHealthViewModelInstantiated OnHealthViewModelInstantiated;
@@ -222,4 +130,9 @@ public:
 	 */
 	UPROPERTY(BlueprintReadOnly)
 	UGASC_UVM_Health* HealthViewModel;
+
+private:
+
+	// Set while HealthViewModel is the instance registered under CharacterHealthContextName
+	bool bRegisteredInGlobalCollection = false;
 };
@@ -7,6 +7,8 @@
 #include "GASCourse/GASCourseCharacter.h"
 #include "GASCoursePlayerController.generated.h"
 
+class UGASC_CursorQuerySubsystem;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDamageDealt, const FGameplayEventData&, Payload);
 
 /**
@@ -66,36 +68,10 @@ public:
 	void CreateHUD_Implementation();
 
 	/**
- * \brief Represents the direction of the mouse cursor projected onto the world space.
- *
- * This variable is used to store the direction of the mouse cursor after it has been deprojected onto the world space.
- *
- * \details The mouse direction is deprojected onto the world space to determine the direction in which the mouse cursor is pointing in the game world.
- * This allows for accurate targeting and interaction between the player and the game environment.
- *
- * \note This variable is replicated to all clients to ensure consistency across the network.
- * It is also marked as BlueprintReadOnly to prevent modification from outside the class.
- * Finally, it is marked as Transient to indicate that it is not relevant for serialization.
- *
- * \see FVector
- */
-	UPROPERTY(Transient)
-	FVector MouseDirectionDeprojectedToWorld;
-
-	/**
-	 * @brief The MousePositionDeprojectedToWorld variable represents the position of the mouse cursor in the world after deprojection.
-	 *
-	 * It is a 3D vector using the FVector class and is marked as Replicated, BlueprintReadOnly, and Transient.
-	 * Replicated means the variable is replicated across networked instances.
-	 * BlueprintReadOnly means the variable can only be read and not modified from blueprints.
-	 * Transient means the variable is not serialized and does not need to be saved or restored.
-	 *
-	 * This variable is typically updated when the mouse cursor is moved and is used to determine the world position of the cursor.
-	 *
-	 * @see FVector
+	 * Cursor ray and cursor hits for this frame, computed on first request and shared by every targeting consumer.
+	 * Only valid on the locally controlling instance.
 	 */
-	UPROPERTY(Transient)
-	FVector MousePositionDeprojectedToWorld;
+	UGASC_CursorQuerySubsystem* GetCursorQuery() const;
 
 	/**
 	 * @brief The HitResultUnderMouseCursorObjectTypes variable is an array of object types used for performing object type queries in hit results.
@@ -116,11 +92,6 @@ protected:
 	virtual void OnRep_PlayerState() override;
 	virtual void OnRep_Pawn() override;
 
-	virtual void Tick(float DeltaSeconds) override;
-
 	UFUNCTION(BlueprintImplementableEvent)
 	void OnDamageDealt(const FGameplayEventData& Payload);
-
-	UFUNCTION()
-	void GetMousePositionInViewport();
 };
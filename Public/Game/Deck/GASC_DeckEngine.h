@@ -0,0 +1,126 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "Math/RandomStream.h"
+#include "Game/Card/CardDataAsset.h"
+#include "GASC_DeckEngine.generated.h"
+
+USTRUCT(BlueprintType)
+struct FCardInstance
+{
+	GENERATED_BODY()
+	
+	UPROPERTY(BlueprintReadOnly, SaveGame)
+	FGuid CardInstanceId = FGuid::NewGuid();
+	
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, SaveGame)
+	TSoftObjectPtr<UCardDataAsset> CardDataAsset;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, SaveGame)
+	int32 CardLevel = 1;
+	
+	bool IsValid() const {return CardInstanceId.IsValid() && CardDataAsset.IsValid();}
+};
+
+UENUM(BlueprintType)
+enum class EGASC_DeckPile : uint8
+{
+	ActiveDeck,
+	Binder,
+	Hand,
+	Graveyard
+};
+
+/**
+ * @struct FGASC_DeckEngine
+ * @brief Card piles of a single deck plus an index from card instance ID to its pile and slot.
+ *
+ * Lookups by instance ID are O(1). Moving a card between piles only touches the two slots involved: the hand,
+ * binder and graveyard are unordered and fill a removed slot with their last card, while the active deck keeps
+ * its order (its last element is the top card, so draws pop from the end). Shuffling uses a seeded stream whose
+ * state is saved with the deck, so a given seed always produces the same draw order.
+ */
+USTRUCT(BlueprintType)
+struct GASCOURSE_API FGASC_DeckEngine
+{
+	GENERATED_BODY()
+
+	/** Replaces the deck's contents and rebuilds the index. */
+	void Initialize(const TArray<FCardInstance>& InActiveDeck, const TArray<FCardInstance>& InBinder,
+		const TArray<FCardInstance>& InHand, const TArray<FCardInstance>& InGraveyard);
+
+	/** Adds a card on top of Pile. A card whose instance ID is already in the deck is given a new one. */
+	void AddCard(FCardInstance Card, EGASC_DeckPile Pile);
+
+	bool RemoveCard(const FGuid& CardInstanceId, FCardInstance* OutCard = nullptr);
+
+	/** Moves a card on top of ToPile. */
+	bool MoveCard(const FGuid& CardInstanceId, EGASC_DeckPile ToPile);
+
+	const FCardInstance* FindCard(const FGuid& CardInstanceId, EGASC_DeckPile* OutPile = nullptr) const;
+
+	/** Moves the top card of the active deck into the hand. */
+	bool DrawCard(FCardInstance& OutCard);
+
+	void SetShuffleSeed(int32 Seed);
+
+	FORCEINLINE int32 GetShuffleSeed() const
+	{
+		return ShuffleStream.GetInitialSeed();
+	}
+
+	void ShuffleActiveDeck();
+
+	/**
+	 * Inserts a card into the active deck at a random position drawn from the shuffle stream. The other cards keep
+	 * their order; only the cards above the new one move up a slot.
+	 */
+	bool ShuffleCardIntoActiveDeck(const FGuid& CardInstanceId);
+
+	const TArray<FCardInstance>& GetPile(EGASC_DeckPile Pile) const;
+
+	FORCEINLINE int32 GetNumCards(EGASC_DeckPile Pile) const
+	{
+		return GetPile(Pile).Num();
+	}
+
+	int32 CountCardsOfType(const TSoftObjectPtr<UCardDataAsset>& CardDataAsset, EGASC_DeckPile Pile) const;
+
+	/** Card data referenced by any pile, for pre-streaming. */
+	void GatherCardDataPaths(TArray<FSoftObjectPath>& OutPaths) const;
+
+	/** The index is not serialized; call this after loading the piles from a save. */
+	void RebuildIndex();
+
+private:
+
+	struct FCardLocation
+	{
+		EGASC_DeckPile Pile = EGASC_DeckPile::ActiveDeck;
+		int32 Slot = INDEX_NONE;
+	};
+
+	TArray<FCardInstance>& GetMutablePile(EGASC_DeckPile Pile);
+
+	void PushCard(FCardInstance&& Card, EGASC_DeckPile Pile);
+	FCardInstance TakeCard(EGASC_DeckPile Pile, int32 Slot);
+	void ReindexPile(EGASC_DeckPile Pile, int32 FirstSlot = 0);
+
+	UPROPERTY(SaveGame)
+	TArray<FCardInstance> ActiveDeck;
+
+	UPROPERTY(SaveGame)
+	TArray<FCardInstance> Binder;
+
+	UPROPERTY(SaveGame)
+	TArray<FCardInstance> Hand;
+
+	UPROPERTY(SaveGame)
+	TArray<FCardInstance> Graveyard;
+
+	UPROPERTY(SaveGame)
+	FRandomStream ShuffleStream;
+
+	TMap<FGuid, FCardLocation> CardIndex;
+};
@@ -119,6 +119,24 @@ public:
 	
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "GASCourse|Damage|Immunities")
 	TSubclassOf<UGameplayEffect> FireDamageImmunityEffect;
+
+	/**
+	 * bBatchDamagePipelineEvents
+	 *
+	 * When enabled, the damage pipeline subsystem queues damage and healing modifications during the frame and
+	 * delivers them to listeners once, at the end of the frame, instead of from inside attribute execution.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "GASCourse|Damage|Pipeline")
+	bool bBatchDamagePipelineEvents = false;
+
+	/**
+	 * DamageLogCapacity
+	 *
+	 * Number of damage/healing events kept by the damage pipeline debug subsystem. The log is a ring buffer, so once
+	 * it is full each new event overwrites the oldest one.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "GASCourse|Damage|Debug", meta=(ClampMin="1"))
+	int32 DamageLogCapacity = 1024;
 	
 	UGASC_AbilitySystemSettings();
 	
@@ -9,6 +9,7 @@
 
 
 class UObject;
+class UGameplayAbility;
 
 /** Struct that defines the relationship between different ability tags */
 USTRUCT()
@@ -37,6 +38,13 @@ struct FGASCourseAbilityTagRelationship
 	FGameplayTagContainer ActivationBlockedTags;
 };
 
+/** Activation tags a mapping adds to one ability class, flattened from every relationship its ability tags match */
+struct FGASCourseCompiledActivationTags
+{
+	FGameplayTagContainer RequiredTags;
+	FGameplayTagContainer BlockedTags;
+};
+
 /** Mapping of how ability tags block or cancel other abilities */
 UCLASS()
 class UGASAbilityTagRelationshipMapping : public UDataAsset
@@ -57,5 +65,29 @@ public:
 
 	/** Returns true if the specified ability tags are canceled by the passed in action tag */
 	bool IsAbilityCancelledByTag(const FGameplayTagContainer& AbilityTags, const FGameplayTag& ActionTag) const;
+
+	/**
+	 * Returns the additional required and blocked activation tags for Ability's class. They are resolved the first
+	 * time a class is queried and cached until the mapping changes. Ability tags are class defaults, so every
+	 * instance of a class shares the entry.
+	 */
+	const FGASCourseCompiledActivationTags& GetCompiledActivationTags(const UGameplayAbility& Ability) const;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	void CompileRelationships() const;
+
+	// Relationship indices keyed by their AbilityTag, built from AbilityTagRelationships
+	mutable TMultiMap<FGameplayTag, int32> RelationshipsByAbilityTag;
+
+	mutable TMap<TObjectKey<UClass>, FGASCourseCompiledActivationTags> CompiledActivationTagsByClass;
+
+	mutable bool bRelationshipsCompiled = false;
 	
 };
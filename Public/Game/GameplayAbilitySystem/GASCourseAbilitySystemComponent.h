@@ -6,6 +6,7 @@
 #include "GASCourseGameplayAbility.h"
 #include "Game/GameplayAbilitySystem/GASAbilityTagRelationshipMapping.h"
 #include "GameplayTagResponseTable/GASCourseStatusEffectTable.h"
+#include "Game/Card/GASC_CardGrantTypes.h"
 #include "GASCourseAbilitySystemComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FActiveCardAbilityStackCountChanged, int32, NewStackCount, TSubclassOf<UGameplayAbility>, AbilityClass);
@@ -24,6 +25,33 @@ class GASCOURSE_API UGCAbilitySystemReplicationProxyInterface : public UAbilityS
 
 struct FGameplayAbilityRepAnimMontage;
 
+class UGASCourseAbilitySystemComponent;
+
+/**
+ * Secondary tick function that flushes a UGASCourseAbilitySystemComponent's gameplay event queue.
+ * Only enabled while the queue holds events.
+ */
+USTRUCT()
+struct FGASC_GameplayEventQueueTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UGASCourseAbilitySystemComponent* Target = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FGASC_GameplayEventQueueTickFunction> : public TStructOpsTypeTraitsBase2<FGASC_GameplayEventQueueTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
 class GASCOURSE_API IGCAbilitySystemReplicationProxyInterface : public IAbilitySystemReplicationProxyInterface
 {
 	GENERATED_BODY()
@@ -75,6 +103,9 @@ public:
 	/** Looks at ability tags and gathers additional required and blocking tags */
 	void GetAdditionalActivationTagRequirements(const FGameplayTagContainer& AbilityTags, FGameplayTagContainer& OutActivationRequired, FGameplayTagContainer& OutActivationBlocked) const;
 
+	/** Cached form of GetAdditionalActivationTagRequirements for an ability's class; null without a tag relationship mapping */
+	const FGASCourseCompiledActivationTags* GetCompiledActivationTagRequirements(const UGameplayAbility& Ability) const;
+
 	// Replication proxy helpers and accesors - CRITICAL TO KEEP UPDATED ON MAJOR REVISIONS
 	IGCAbilitySystemReplicationProxyInterface* GetExtendedReplicationInterface();
 
@@ -88,7 +119,25 @@ public:
 
 	void WaitForAbilityCooldownEnd(UGameplayAbility* InAbility, const FActiveGameplayEffectHandle InCooldownActiveGEHandle);
 	
-	void SendGameplayEventAsync(FGameplayTag EventTag, const FGameplayEventData& EventData) const;
+	/**
+	 * Queues a gameplay event to be handled when the queue is flushed in TG_LastDemotable. Events sent after that
+	 * point in the frame (e.g. from tickable subsystems) are handled in the next frame's flush unless the sender calls
+	 * FlushGameplayEventQueue itself, as the melee trace subsystem does.
+	 *
+	 * Ordering guarantees:
+	 * - Queued events are handled in the order they were first sent.
+	 * - With bAllowMerge, an event whose tag, instigator and target match a mergeable event that is still waiting
+	 *   replaces that event's payload in place, keeping its position, and adds its EventMagnitude to it.
+	 * - Events sent while the queue is being flushed are handled in the same flush, after everything already queued.
+	 * - The queue holds at most GameplayEventQueueCapacity events. Sending to a full queue flushes it first; during a
+	 *   flush, the new event is handled immediately instead.
+	 */
+	void QueueGameplayEvent(FGameplayTag EventTag, FGameplayEventData EventData, bool bAllowMerge = false);
+
+	/** Handles every queued gameplay event now. Does nothing if called while the queue is already being flushed. */
+	void FlushGameplayEventQueue();
+
+	static constexpr int32 GameplayEventQueueCapacity = 16;
 
 	UFUNCTION(BlueprintPure, meta=(GameplayTagFilter="Input.NativeAction.Ability"))
 	TSubclassOf<UGameplayAbility> GetAbilityFromTaggedInput(FGameplayTag InputTag);
@@ -101,6 +150,52 @@ public:
 	
 	UPROPERTY(BlueprintAssignable)
 	FActiveCardAbilityStackCountChanged OnActiveCardAbilityStackCountChanged;
+
+	/** Returns the charges held in CurrentStackAttribute, or 0 if this component has no such attribute. */
+	float GetAbilityStackCount(const FGameplayAttribute& CurrentStackAttribute) const;
+
+	/**
+	 * Sets an ability's max and current stack attributes to StackCount by writing their base values directly, without
+	 * creating or applying an effect. On the server the values replicate as usual; on a client this is a local
+	 * prediction that the next replicated values overwrite.
+	 */
+	void SetAbilityStackCount(const FGameplayAttribute& CurrentStackAttribute, const FGameplayAttribute& MaxStackAttribute, float StackCount);
+
+	/**
+	 * Adds Delta charges to CurrentStackAttribute, clamped between 0 and the value of MaxStackAttribute, with the same
+	 * direct write as SetAbilityStackCount.
+	 *
+	 * @return The new stack count.
+	 */
+	float ModifyAbilityStackCount(const FGameplayAttribute& CurrentStackAttribute, const FGameplayAttribute& MaxStackAttribute, float Delta);
+
+	/**
+	 * Reserves a pooled grant record for one activation of CardAbilitySet at CardLevel. The record owns the handles
+	 * of everything that activation grants, and is addressed by the returned handle until it is revoked.
+	 */
+	FGASC_CardGrantHandle AllocateCardGrant(const UBaseCardGameplayAbilitySet* CardAbilitySet, int32 CardLevel, const FGuid& CardInstanceId);
+
+	/** Returns the live record for GrantHandle, or null if it has been revoked. */
+	FGASC_CardGrantRecord* FindCardGrant(const FGASC_CardGrantHandle& GrantHandle);
+
+	UFUNCTION(BlueprintPure, Category="CardAbilityConfigHandles")
+	int32 GetCardGrantLevel(const FGASC_CardGrantHandle& GrantHandle) const;
+
+	/** Changes the level of a single activation and of the abilities it granted. */
+	UFUNCTION(BlueprintCallable, Category="CardAbilityConfigHandles")
+	bool SetCardGrantLevel(const FGASC_CardGrantHandle& GrantHandle, int32 CardLevel);
+
+	/** Takes back everything one activation granted and returns its record to the pool. */
+	UFUNCTION(BlueprintCallable, Category="CardAbilityConfigHandles")
+	bool RevokeCardGrant(const FGASC_CardGrantHandle& GrantHandle);
+
+	/** Revokes every activation of a deck card, e.g. when the card leaves play. Returns the number revoked. */
+	UFUNCTION(BlueprintCallable, Category="CardAbilityConfigHandles")
+	int32 RevokeCardGrantsForCardInstance(const FGuid& CardInstanceId);
+
+	/** Revokes every activation of CardAbilitySet. Returns the number revoked. */
+	UFUNCTION(BlueprintCallable, Category="CardAbilityConfigHandles")
+	int32 RevokeCardGrantsFromSet(const UBaseCardGameplayAbilitySet* CardAbilitySet);
 	
 protected:
 
@@ -124,5 +219,51 @@ protected:
 	
 	virtual void ApplyAbilityBlockAndCancelTags(const FGameplayTagContainer& AbilityTags, UGameplayAbility* RequestingAbility, bool bEnableBlockTags, const FGameplayTagContainer& BlockTags, bool bExecuteCancelTags, const FGameplayTagContainer& CancelTags) override;
 	virtual void HandleChangeAbilityCanBeCanceled(const FGameplayTagContainer& AbilityTags, UGameplayAbility* RequestingAbility, bool bCanBeCanceled) override;
+
+	virtual void RegisterComponentTickFunctions(bool bRegister) override;
+
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRep_ActivateAbilities() override;
+
+private:
+
+	void AddToInputTagIndex(const FGameplayAbilitySpec& AbilitySpec);
+	void RemoveFromInputTagIndex(const FGameplayAbilitySpecHandle& SpecHandle);
+	void RebuildInputTagIndex();
+
+	// Dynamic source tag -> granted specs carrying it, so input routing only visits the abilities bound to a tag
+	TMultiMap<FGameplayTag, FGameplayAbilitySpecHandle> InputTagToSpecHandles;
+
+	// Tags each spec was indexed under, to unindex it without reading a spec that may already be gone
+	TMap<FGameplayAbilitySpecHandle, FGameplayTagContainer> IndexedSpecInputTags;
+
+	// Scratch list reused by ProcessAbilityInput
+	TArray<FGameplayAbilitySpecHandle> AbilitiesToActivate;
+
+	struct FQueuedGameplayEvent
+	{
+		FGameplayTag EventTag;
+		FGameplayEventData EventData;
+		bool bAllowMerge = false;
+	};
+
+	// Never grows past its inline storage, so queued entries stay put while handlers queue more events
+	TArray<FQueuedGameplayEvent, TInlineAllocator<GameplayEventQueueCapacity>> QueuedGameplayEvents;
+
+	// First queued event not yet handled by the running flush; everything before it is spent
+	int32 NextQueuedGameplayEvent = 0;
+
+	bool bFlushingGameplayEvents = false;
+
+	FGASC_GameplayEventQueueTickFunction GameplayEventQueueTickFunction;
+
+	void ReleaseCardGrant(int32 RecordIndex);
+
+	// Per-activation card grants. Slots are recycled through FreeCardGrantRecords and keep their storage when released.
+	UPROPERTY()
+	TArray<FGASC_CardGrantRecord> CardGrantRecords;
+
+	TArray<int32> FreeCardGrantRecords;
 	
 };
@@ -229,6 +229,10 @@ public:
 	 */
 	UFUNCTION()
 	bool HasStacksAvailable();
+
+	FORCEINLINE const FGameplayAttribute& GetMaxStackAttribute() const {return MaxStackAttribute;}
+
+	FORCEINLINE const FGameplayAttribute& GetCurrentStackAttribute() const {return CurrentStackAttribute;}
 	
 protected:
 	
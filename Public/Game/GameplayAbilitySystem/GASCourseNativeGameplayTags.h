@@ -55,6 +55,8 @@ UE_DECLARE_GAMEPLAY_TAG_EXTERN(Status_Invulnerable_Damage);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(Status_Invulnerable_Reactions);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(Status_CardEnergyCostOverride);
 
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(Effect_Gameplay_Status);
+
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_IncomingDamage);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_IncomingHealing);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_IncomingCardEnergyXP);
@@ -66,6 +68,7 @@ UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_DamageResisted);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_HealingLifeSteal);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_ActiveCardEnergyXP);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_CardCost);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_AbilityStackCount);
 
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(DamageType_Root);
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(DamageType_Physical);
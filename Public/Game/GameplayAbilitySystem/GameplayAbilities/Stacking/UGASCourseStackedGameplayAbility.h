@@ -34,7 +34,7 @@ protected:
 
 private:
 
-	void InitializeStackCountAttributes();
+	void InitializeStackCountAttributes(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) const;
 
 	FActiveGameplayEffectHandle ActiveStackingEffectHandle;
 	
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "GameplayEffect.h"
+#include "GameplayEffectExecutionCalculation.h"
+#include "GASC_AbilityStackInitEffect.generated.h"
+
+/**
+ * Execution behind UGASC_AbilityStackInitEffect. Overrides the max and current stack attributes of the ability that
+ * made the spec with the Data.Ability.StackCount SetByCaller magnitude.
+ */
+UCLASS()
+class GASCOURSE_API UGASC_AbilityStackInitExecution : public UGameplayEffectExecutionCalculation
+{
+	GENERATED_BODY()
+
+	virtual void Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
+};
+
+/**
+ * Instant effect that initializes an ability's stack attributes. The attributes come from the ability in the effect
+ * context, so a single native class serves every stacked ability and applying it creates no transient objects.
+ */
+UCLASS()
+class GASCOURSE_API UGASC_AbilityStackInitEffect : public UGameplayEffect
+{
+	GENERATED_UCLASS_BODY()
+};
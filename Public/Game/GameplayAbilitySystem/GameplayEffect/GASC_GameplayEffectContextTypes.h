@@ -11,8 +11,9 @@ struct FGASCourseGameplayEffectContext : public FGameplayEffectContext
 {
 	GENERATED_BODY()
 
-	UPROPERTY()
+#if GASC_WITH_DAMAGE_LOG
 	FDamageLogEntry DamageLogEntry;
+#endif
 	
 	virtual FGameplayEffectContext* Duplicate() const override
 	{
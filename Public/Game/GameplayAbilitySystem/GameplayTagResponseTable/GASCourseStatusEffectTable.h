@@ -41,6 +41,13 @@ struct FGameplayTagEventResponseTableEntry
 	
 };
 
+/** A response effect resolved when the table compiles, applied without looking up its class default per hit. */
+struct FGASC_CompiledStatusEffectResponse
+{
+	UGameplayEffect* Effect = nullptr;
+	float Level = UGameplayEffect::INVALID_LEVEL;
+};
+
 UCLASS()
 class GASCOURSE_API UGASCourseStatusEffectTable : public UDataAsset
 {
@@ -50,6 +57,11 @@ class GASCOURSE_API UGASCourseStatusEffectTable : public UDataAsset
 	TArray<FGameplayTagEventResponseTableEntry>	Entries;
 
 	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 
 	/**
 	 * Function to apply a gameplay status effect to the target ability system component based on the provided status effect tags.
@@ -61,16 +73,35 @@ class GASCOURSE_API UGASCourseStatusEffectTable : public UDataAsset
 	UFUNCTION()
 	void ApplyGameplayStatusEffect(UAbilitySystemComponent* TargetASC, UAbilitySystemComponent* InstigatorASC, const FGameplayTagContainer& StatusEffectTags);
 
-protected:
-	
+	using FResponseArray = TArray<FGASC_CompiledStatusEffectResponse, TInlineAllocator<2>>;
+
 	/**
-	 * Check if any of the given status effect tags matches the entries in the status effect table.
+	 * Finds the responses ApplyGameplayStatusEffect applies for the given tags: those of the last entry whose
+	 * StatusEffectTag the tags carry, paired with the first status tag among them.
 	 *
-	 * @param StatusEffectTags The tags to check against the status effect table entries.
-	 * @param FoundStatusEffectEntry The found status effect entry when a match is found.
-	 * @param FoundTag The found tag when a match is found.
-	 * @return True if a match is found, false otherwise.
+	 * @param StatusEffectTags The gameplay tags representing the status effect to be applied.
+	 * @return The responses, in the order the entry lists them, or nullptr if there are none.
 	 */
-	bool HasMatchingStatusEffectTag(const FGameplayTagContainer& StatusEffectTags, FGameplayTagEventResponseTableEntry& FoundStatusEffectEntry, FGameplayTag& FoundTag);
-	
+	const FResponseArray* FindResponseEffects(const FGameplayTagContainer& StatusEffectTags) const;
+
+	/** Rebuilds the compiled lookup from Entries. Runs on load and edit; call it after changing Entries at runtime. */
+	void CompileEntries();
+
+private:
+
+#if WITH_EDITOR
+	/** Response effect blueprints recompiled in the editor get new class defaults; recompile to pick them up. */
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+#endif
+
+#if WITH_EDITORONLY_DATA
+	FDelegateHandle ObjectsReplacedHandle;
+#endif
+
+	// Entry tag, and every tag under it, -> index into CompiledEntries of the last entry that tag matches.
+	// An incoming tag matches an entry when it is the entry's tag or a child of it, as FGameplayTagContainer::HasTag.
+	TMap<FGameplayTag, int32> CompiledEntryByTag;
+
+	// Per compiled entry: status state tag -> responses. Entry index order is table order, so the highest index wins.
+	TArray<TMap<FGameplayTag, FResponseArray>> CompiledEntries;
 };
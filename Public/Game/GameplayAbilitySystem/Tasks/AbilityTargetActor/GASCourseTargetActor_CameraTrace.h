@@ -3,9 +3,11 @@
 #pragma once
 
 #include "GASCourseTargetActor_Trace.h"
+#include "Engine/OverlapResult.h"
 #include "GASCourseTargetActor_CameraTrace.generated.h"
 
 class UGameplayAbility;
+class UGASC_CursorQuerySubsystem;
 
 /**
  * 
@@ -43,21 +45,46 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, meta = (ExposeOnSpawn = true), Category = Targeting)
 	FTargetingOutline TargetOutlineData;
 
+	/** The outline trace and overlap are skipped while the cursor ray origin moves less than this (cm) and its direction does not change. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Targeting)
+	float CursorRayMoveThreshold = 1.0f;
+
+	/** Even with a still cursor, the outline is re-queried at least this often (seconds) so targets moving under it are picked up. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Targeting)
+	float MaxOutlineQueryInterval = 0.1f;
+
 protected:
 	virtual FHitResult PerformTrace(AActor* InSourceActor) override;
 
 	virtual bool IsConfirmTargetingAllowed() override;
 
 	TArray<TWeakObjectPtr<AActor> >	PerformOverlap(const FVector& Origin);
-	
-	bool OverlapMultiByObjectTypes(TArray<TWeakObjectPtr<AActor>>& OutHitActors, const FVector& Pos, const FQuat& Rot, const FCollisionShape& OverlapCollisionShape,
-		const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam) const;
+
+	/** One overlap against every channel in QueryChannels; the filtered, de-duplicated actors are left in OverlapActors. */
+	bool OverlapMultiByObjectTypes(const FVector& Pos, const FQuat& Rot, const FCollisionShape& OverlapCollisionShape,
+		const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam);
 	
 	FGameplayAbilityTargetDataHandle MakeTargetData(const TArray<TWeakObjectPtr<AActor>>& Actors, const FVector& Origin) const;
 
-	void DrawTargetOutline(TArray<TWeakObjectPtr<AActor>> InHitActors, TArray<TWeakObjectPtr<AActor>> InLatestHitActors) override;
-	void ClearTargetOutline(TArray<TWeakObjectPtr<AActor>> InHitActors) override;
+	virtual void DrawTargetOutline(const TSet<AActor*>& LatestHitActors) override;
+	virtual void ClearTargetOutline() override;
+
+	UGASC_CursorQuerySubsystem* GetCursorQuery() const;
+	bool GetCursorRay(FVector& OutRayStart, FVector& OutRayDirection) const;
+	bool ShouldRefreshTargetOutline(const FVector& RayStart, const FVector& RayDirection) const;
+	void SetActorOutlined(AActor& Actor, bool bOutlined) const;
 	
 protected:	
 	bool bLastTraceWasGood;
+
+	// Built once from QueryChannels when targeting starts
+	FCollisionObjectQueryParams OverlapObjectQueryParams;
+
+	// Scratch for the per-frame overlap; kept as members so steady-state frames don't allocate
+	TArray<FOverlapResult> OverlapResults;
+	TSet<AActor*> OverlapActors;
+
+	FVector LastOutlineRayStart = FVector::ZeroVector;
+	FVector LastOutlineRayDirection = FVector::ZeroVector;
+	double LastOutlineQueryTime = -UE_BIG_NUMBER;
 };
@@ -78,7 +78,8 @@ public:
 	UPROPERTY(BlueprintReadOnly, meta = (ExposeOnSpawn = true), Category = Targeting)
 	TEnumAsByte<ECollisionChannel> TraceChannel;
 
-	TArray<TWeakObjectPtr<AActor>> ActorsToOutline;
+	// Actors whose outline is currently drawn; outline updates only touch actors entering or leaving this set
+	TSet<TWeakObjectPtr<AActor>> OutlinedActors;
 
 protected:
 	
@@ -90,8 +91,11 @@ protected:
 
 	virtual void UpdateLooseGameplayTagsDuringTargeting(FGameplayTag InGameplayTag, int32 InCount);
 
-	virtual void DrawTargetOutline(TArray<TWeakObjectPtr<AActor> > InHitActors,  TArray<TWeakObjectPtr<AActor>> InLatestHitActors);
-	virtual void ClearTargetOutline(TArray<TWeakObjectPtr<AActor> > InHitActors);
+	/** Brings OutlinedActors in line with LatestHitActors. */
+	virtual void DrawTargetOutline(const TSet<AActor*>& LatestHitActors);
+
+	/** Removes the outline from every actor in OutlinedActors and empties it. */
+	virtual void ClearTargetOutline();
 
 	virtual void SendTargetDataBacktoServer(const FGameplayAbilityTargetDataHandle& InData, FGameplayTag ApplicationTag);
 
@@ -60,4 +60,7 @@ private:
 
 	/** Did we override the target? */
 	bool bUseExternalTarget = false;
+
+	/** Bucket the listener was registered in; the target itself may be gone by the time we unregister */
+	FObjectKey RegisteredTargetKey;
 };
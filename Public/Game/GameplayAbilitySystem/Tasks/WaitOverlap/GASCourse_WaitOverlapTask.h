@@ -3,13 +3,13 @@
 #pragma once
 
 #include "Abilities/Tasks/AbilityTask.h"
+#include "Game/Systems/Targeting/GASC_OverlapWatchSubsystem.h"
 #include "UObject/ObjectMacros.h"
 #include "GASCourse_WaitOverlapTask.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGASCourseWaitOverlapDelegate, const FGameplayAbilityTargetDataHandle&, TargetData);
 
 class AActor;
-class USphereComponent;
 
 /**
  * 
@@ -22,9 +22,6 @@ class GASCOURSE_API UGASCourse_WaitOverlapTask : public UAbilityTask
 	UPROPERTY(BlueprintAssignable)
 	FGASCourseWaitOverlapDelegate	OnOverlap;
 
-	UFUNCTION()
-	void OnComponentOverlapCallback(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult & SweepResult);
-
 	virtual void Activate() override;
 
 	/** Wait until an overlap occurs. This will need to be better fleshed out so we can specify game specific collision requirements */
@@ -35,14 +32,11 @@ private:
 
 	virtual void OnDestroy(bool AbilityEnded) override;
 
-	bool InitializeOverlapComponent(); 
+	/** Receives the actors that entered the sphere; the handle belongs to the overlap watch subsystem. */
+	void OnOverlapWatchTriggered(const FGameplayAbilityTargetDataHandle& TargetData);
 
-	UPROPERTY()
-	USphereComponent* OverlapComponent = nullptr;
+	FGASC_OverlapWatchHandle OverlapWatchHandle;
 	
 	float SphereRadius = 0.0f;
 	bool bDebugDraw = false;
-
-	UPROPERTY()
-	TArray<AActor*> OverlappedActors;
 };
@@ -34,13 +34,8 @@ public:
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Damage")
 	TSubclassOf<UGASC_UI_DamageNumber> DamageNumberClass;
 
-	/** Called by the damage pipeline subsystem */
-	UFUNCTION()
-	void OnDamageApplied_Event(const FDamageModificationContext& DamageContext);
-
-	/** Called by the damage pipeline subsystem */
-	UFUNCTION()
-	void OnHealingReceived_Event(const FDamageModificationContext& HealingContext);
+	/** Called by the damage pipeline subsystem with every damage/healing modification since the last flush */
+	void OnDamageEventBatch(TArrayView<const FDamageModificationContext> Events);
 
 protected:
 
@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "GASC_HealthViewModelSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGASC_UVM_Health;
+struct FOnAttributeChangeData;
+
+/**
+ * One actor's health view model and the ability system it is fed from.
+ */
+USTRUCT()
+struct FGASC_HealthViewModelBinding
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UGASC_UVM_Health> ViewModel = nullptr;
+
+	TWeakObjectPtr<AActor> Owner;
+	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystem;
+
+	FDelegateHandle CurrentHealthChangedHandle;
+	FDelegateHandle MaxHealthChangedHandle;
+
+	bool bDirty = false;
+	bool bInUse = false;
+};
+
+/**
+ * @class UGASC_HealthViewModelSubsystem
+ * @brief Hands out per-actor health view models and keeps them in sync with the health attribute set.
+ *
+ * View models are pooled: releasing an actor's view model resets it and keeps it for the next actor that asks,
+ * so enemies spawning and dying do not create and discard objects. Values are read straight from the replicated
+ * health attributes; attribute changes only mark the binding dirty, and dirty bindings are pushed to their view
+ * model once at the end of the frame no matter how many times health changed in between.
+ */
+UCLASS()
+class GASCOURSE_API UGASC_HealthViewModelSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/* Tick (only while bindings are dirty) */
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UGASC_HealthViewModelSubsystem, STATGROUP_Tickables);
+	}
+
+	/** Returns Owner's view model, taking one from the pool the first time Owner asks. */
+	UGASC_UVM_Health* AcquireHealthViewModel(AActor* Owner);
+
+	/** Feeds Owner's view model from AbilitySystem's health attributes, replacing any previous ability system. */
+	void BindAbilitySystem(const AActor* Owner, UAbilitySystemComponent* AbilitySystem);
+
+	/** Resets Owner's view model and returns it to the pool. */
+	void ReleaseHealthViewModel(const AActor* Owner);
+
+	UFUNCTION(BlueprintPure, Category = "GASCourse|Health")
+	UGASC_UVM_Health* FindHealthViewModel(const AActor* Owner) const;
+
+	/** Pushes every dirty binding to its view model. Safe to call at any time. */
+	void FlushDirtyViewModels();
+
+private:
+
+	void UnbindAbilitySystem(FGASC_HealthViewModelBinding& Binding);
+	void OnHealthAttributeChanged(const FOnAttributeChangeData& ChangeData, int32 BindingIndex);
+	void PushHealthValues(FGASC_HealthViewModelBinding& Binding);
+
+	UPROPERTY()
+	TArray<FGASC_HealthViewModelBinding> Bindings;
+
+	TArray<int32> FreeBindings;
+	TMap<TObjectKey<AActor>, int32> BindingIndices;
+
+	// Bindings whose attributes changed since the last flush
+	TArray<int32> DirtyBindings;
+};
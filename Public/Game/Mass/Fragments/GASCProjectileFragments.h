@@ -0,0 +1,82 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "GameplayTagContainer.h"
+#include "Game/GameplayAbilitySystem/GASCourseNativeGameplayTags.h"
+#include "GASCProjectileFragments.generated.h"
+
+/**
+ * Marks an entity as a projectile simulated by UGASCProjectileSimulationProcessor.
+ */
+USTRUCT()
+struct GASCOURSE_API FGASCProjectileTag : public FMassTag
+{
+	GENERATED_BODY()
+};
+
+USTRUCT()
+struct GASCOURSE_API FGASCProjectileLocationFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector Location = FVector::ZeroVector;
+};
+
+USTRUCT()
+struct GASCOURSE_API FGASCProjectileVelocityFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector Velocity = FVector::ZeroVector;
+};
+
+USTRUCT()
+struct GASCOURSE_API FGASCProjectileLifetimeFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float RemainingLifetime = 0.0f;
+};
+
+/**
+ * Actor credited with the projectile's damage, and ignored by its sweeps.
+ */
+USTRUCT()
+struct GASCOURSE_API FGASCProjectileInstigatorFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TWeakObjectPtr<AActor> Instigator;
+};
+
+/**
+ * Per-volley projectile parameters. Shared between every entity spawned with the same values, so a volley of
+ * identical projectiles lands in a single chunk and the simulation reads these once per chunk.
+ */
+USTRUCT()
+struct GASCOURSE_API FGASCProjectileParamsFragment : public FMassConstSharedFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float CollisionRadius = 10.0f;
+
+	UPROPERTY()
+	FName CollisionProfileName = TEXT("Projectile");
+
+	UPROPERTY()
+	float Damage = 0.0f;
+
+	UPROPERTY()
+	FGameplayTag DamageType = DamageType_Physical;
+
+	UPROPERTY()
+	bool bCanDamageAllies = false;
+};
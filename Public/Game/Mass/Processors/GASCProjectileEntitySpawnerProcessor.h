@@ -4,13 +4,33 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Game/Mass/Subsystems/GASCProjectileEntitySubsystem.h"
 #include "GASCProjectileEntitySpawnerProcessor.generated.h"
 
 /**
- * 
+ * Turns projectile requests queued on UGASCProjectileEntitySubsystem into Mass entities. Requests are grouped by
+ * their shared parameters and each group is created with a single batch call, so one volley costs one archetype
+ * write instead of one entity creation per projectile.
  */
 UCLASS()
 class GASCOURSE_API UGASCProjectileEntitySpawnerProcessor : public UMassProcessor
 {
 	GENERATED_BODY()
+
+public:
+
+	UGASCProjectileEntitySpawnerProcessor();
+
+protected:
+
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+
+	void CreateProjectileEntities(FMassEntityManager& EntityManager, const TArray<FGASCProjectileEntitySpawnParams>& SpawnParams);
+
+	FMassArchetypeHandle ProjectileArchetype;
+
+	TArray<FGASCProjectileEntitySpawnParams> SpawnScratch;
 };
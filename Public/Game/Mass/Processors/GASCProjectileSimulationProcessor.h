@@ -0,0 +1,47 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "GameplayTagContainer.h"
+#include "Engine/HitResult.h"
+#include "GASCProjectileSimulationProcessor.generated.h"
+
+/**
+ * Moves projectile entities and sweeps them against the world one chunk at a time. Shared parameters (shape,
+ * profile, damage) are read once per chunk; entities that hit something or run out of lifetime are destroyed,
+ * and only the hits reach the damage pipeline, after iteration has finished.
+ */
+UCLASS()
+class GASCOURSE_API UGASCProjectileSimulationProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+
+	UGASCProjectileSimulationProcessor();
+
+protected:
+
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+
+	struct FProjectileImpact
+	{
+		TWeakObjectPtr<AActor> Target;
+		TWeakObjectPtr<AActor> Instigator;
+		float Damage = 0.0f;
+		FGameplayTag DamageType;
+		bool bCanDamageAllies = false;
+		FHitResult HitResult;
+	};
+
+	void ApplyImpacts(UWorld* World);
+
+	FMassEntityQuery ProjectileQuery;
+
+	TArray<FProjectileImpact> ImpactScratch;
+};
@@ -0,0 +1,84 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Game/Mass/Fragments/GASCProjectileFragments.h"
+#include "GASCProjectileEntitySubsystem.generated.h"
+
+/**
+ * Description of a single Mass-simulated projectile.
+ */
+USTRUCT(BlueprintType)
+struct GASCOURSE_API FGASCProjectileEntitySpawnParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Projectile")
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Projectile")
+	FVector Velocity = FVector::ZeroVector;
+
+	/** Seconds before the projectile expires without hitting anything. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Projectile", meta = (ClampMin = "0.0"))
+	float Lifetime = 5.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Projectile", meta = (ClampMin = "0.0"))
+	float CollisionRadius = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Projectile")
+	FName CollisionProfileName = TEXT("Projectile");
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Projectile|Damage")
+	float Damage = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Projectile|Damage", meta = (Categories = "Damage.Type"))
+	FGameplayTag DamageType = DamageType_Physical;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Projectile|Damage")
+	bool bCanDamageAllies = false;
+
+	/** Weak, since requests can sit in the queue until the next Mass update. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Projectile")
+	TWeakObjectPtr<AActor> Instigator;
+};
+
+/**
+ * @class UGASCProjectileEntitySubsystem
+ * @brief Entry point for projectiles simulated as Mass entities instead of AGASCourseProjectile actors.
+ *
+ * Requests are queued here and turned into entities in batches by UGASCProjectileEntitySpawnerProcessor;
+ * UGASCProjectileSimulationProcessor moves them, sweeps them per chunk, and forwards impacts to the damage
+ * pipeline. Use AGASCourseProjectile for projectiles that need visuals, homing, ricochet or replication.
+ */
+UCLASS()
+class GASCOURSE_API UGASCProjectileEntitySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, Category = "GASCourse|Projectile")
+	void SpawnProjectileEntity(const FGASCProjectileEntitySpawnParams& SpawnParams);
+
+	UFUNCTION(BlueprintCallable, Category = "GASCourse|Projectile")
+	void SpawnProjectileEntities(const TArray<FGASCProjectileEntitySpawnParams>& SpawnParams);
+
+	/** Hands the queued requests to the caller and leaves the queue empty. */
+	void ConsumePendingSpawns(TArray<FGASCProjectileEntitySpawnParams>& OutSpawnParams);
+
+	FORCEINLINE bool HasPendingSpawns() const
+	{
+		return !PendingSpawns.IsEmpty();
+	}
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	TArray<FGASCProjectileEntitySpawnParams> PendingSpawns;
+};
@@ -40,4 +40,10 @@ public:
 	 */
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Active Card Resource|Mapping Data")
 	TSoftObjectPtr<UActiveCardResourceEventMappingData> ActiveCardResourceEventMappingData;
+
+	/**
+	 * Number of active card energy XP events kept for debugging. Once full, the oldest event is overwritten.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Active Card Resource|Debug", meta = (ClampMin = "1"))
+	int32 ActiveCardEnergyXPHistoryCapacity = 256;
 };
@@ -3,12 +3,15 @@
 #pragma once
 
 #include "ActiveCardResourceSettings.h"
+#include "AttributeSet.h"
 #include "Abilities/GameplayAbilityTypes.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
 #include "GASC_ActiveCardResourceManager.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LOG_GASC_ActiveCardResourceSubsystem, Log, All);
 
+class UGASCourseGameplayEffect;
+
 /**
  * @class FActiveCardEnergyXPHistoryEntry
  * @brief Represents a historical record of energy and experience point (XP) changes for an active card.
@@ -38,15 +41,24 @@ struct FActiveCardEnergyXPHistoryEntry
 	float ActiveCardEnergyXPModifiedValue = 0.f;
 
 	UPROPERTY()
-	FString InstigatorName;
+	FName InstigatorName;
 
-	UPROPERTY()
-	FString ModificationToolTip;
+	// Multipliers that changed the base value; formatted into a tooltip only when displayed
+	TArray<TPair<FGameplayAttribute, float>, TInlineAllocator<2>> Modifiers;
 
 	FActiveCardEnergyXPHistoryEntry() {}
-	FActiveCardEnergyXPHistoryEntry(FGameplayTag InActiveCardEnergyXPEventTag, float InActiveCardEnergyXPBaseValue, float InActiveCardEnergyXPModifiedValue, const FString& InInstigator, const FString& InToolTip)
-		: ActiveCardEnergyXPEventTag(InActiveCardEnergyXPEventTag), ActiveCardEnergyXPBaseValue(InActiveCardEnergyXPBaseValue), ActiveCardEnergyXPModifiedValue(InActiveCardEnergyXPModifiedValue), InstigatorName(InInstigator),
-	ModificationToolTip(InToolTip){}
+	FActiveCardEnergyXPHistoryEntry(FGameplayTag InActiveCardEnergyXPEventTag, float InActiveCardEnergyXPBaseValue, float InActiveCardEnergyXPModifiedValue, FName InInstigator)
+		: ActiveCardEnergyXPEventTag(InActiveCardEnergyXPEventTag), ActiveCardEnergyXPBaseValue(InActiveCardEnergyXPBaseValue), ActiveCardEnergyXPModifiedValue(InActiveCardEnergyXPModifiedValue), InstigatorName(InInstigator){}
+
+	FString GetModificationToolTip() const
+	{
+		FString ModificationToolTip;
+		for (const TPair<FGameplayAttribute, float>& Modifier : Modifiers)
+		{
+			ModificationToolTip.Append(LINE_TERMINATOR).Appendf(TEXT("Attribute: %s -> %f"), *Modifier.Key.AttributeName, Modifier.Value);
+		}
+		return ModificationToolTip;
+	}
 };
 
 /**
@@ -91,14 +103,25 @@ public:
 
 	void LoadActiveCardResourceMapping();
 
-	UFUNCTION()
-	FORCEINLINE TArray<FActiveCardEnergyXPHistoryEntry>& GetActiveCardEnergyHistory()
+	/** Number of entries currently held in the bounded history. */
+	FORCEINLINE int32 GetNumActiveCardEnergyXPHistoryEntries() const
 	{
-		return ActiveCardEnergyXPHistory;
-	};
+		return ActiveCardEnergyXPHistoryCount;
+	}
+
+	/** History entry by age, 0 being the oldest entry still held. */
+	const FActiveCardEnergyXPHistoryEntry& GetActiveCardEnergyXPHistoryEntry(int32 Index) const;
+
+	/** Most recently recorded entry, or nullptr if the history is empty. */
+	FActiveCardEnergyXPHistoryEntry* GetLatestActiveCardEnergyXPHistoryEntry();
 
 private:
 
+	/** Builds the execution-only instant effect once and reuses it for every event. */
+	UGASCourseGameplayEffect* GetOrCreateActiveCardEnergyXPEffect(TSubclassOf<UGameplayEffectExecutionCalculation> CalculationClass);
+
+	FActiveCardEnergyXPHistoryEntry& AddActiveCardEnergyXPHistoryEntry();
+
 	UPROPERTY()
 	APlayerController* RegisteredLocalPlayerController = nullptr;
 
@@ -113,6 +136,13 @@ private:
 	UPROPERTY()
 	const UActiveCardResourceEventMappingData* ActiveCardResourceEventMappingData = nullptr;
 
+	UPROPERTY()
+	TObjectPtr<UGASCourseGameplayEffect> ActiveCardEnergyXPEffect = nullptr;
+
+	// Ring buffer, sized once from ActiveCardEnergyXPHistoryCapacity
 	UPROPERTY()
 	TArray<FActiveCardEnergyXPHistoryEntry> ActiveCardEnergyXPHistory;
+
+	int32 ActiveCardEnergyXPHistoryHead = 0;
+	int32 ActiveCardEnergyXPHistoryCount = 0;
 };
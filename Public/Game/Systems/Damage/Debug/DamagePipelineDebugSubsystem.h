@@ -41,15 +41,21 @@ public:
 	
 	UFUNCTION()
 	void LogDamageEvent(const FDamageLogEntry& DamageContext);
-	
-	UFUNCTION()
-	TArray<FDamageLogEntry> GetDamageLogEntries();
 
-	UFUNCTION()
-	TArray<FDamageLogEntry> GetDamageLogEntriesForActorID(uint32 InActorID);
+	/** Number of entries currently held by the log (never more than the configured capacity). */
+	int32 GetNumDamageLogEntries() const { return DamageLogCount; }
+
+	/** Visits every logged entry, newest first, without copying. */
+	void ForEachDamageLogEntry(TFunctionRef<void(const FDamageLogEntry&)> Visitor) const;
+
+	/**
+	 * Gathers pointers to every entry where the actor is the target or instigator, newest first.
+	 * Pointers stay valid until the next LogDamageEvent call.
+	 */
+	void GetDamageLogEntriesForActorID(uint32 InActorID, TArray<const FDamageLogEntry*>& OutEntries) const;
 	
-	UFUNCTION()
-	FDamageLogEntry GetDamageLogEntryByDamageID(uint32 InDamageID);
+	/** Returns the entry with this DamageID, or nullptr if it was never logged or has been overwritten. */
+	const FDamageLogEntry* GetDamageLogEntryByDamageID(uint32 InDamageID) const;
 	
 	UFUNCTION()
 	AActor* GetActorFromID(const uint32& InActorID);
@@ -63,14 +69,33 @@ public:
 	const UGASC_AbilitySystemSettings* AbilitySystemSettings = nullptr;
 	
 private:
+
+	/** Sequence numbers of one actor's entries, oldest first; evicted entries are skipped via FirstLive. */
+	struct FActorDamageLogIndex
+	{
+		TArray<uint64> Sequences;
+		int32 FirstLive = 0;
+	};
 	
+	/** Fixed-capacity ring storage; entry with sequence N lives at N % capacity. */
 	UPROPERTY()
 	TArray<FDamageLogEntry> DamageLogEntries;
+
+	uint64 NextDamageLogSequence = 0;
+	int32 DamageLogCount = 0;
+
+	TMap<uint32, uint64> DamageIDToSequence;
+	TMap<uint32, FActorDamageLogIndex> ActorDamageLogIndices;
+
+	const FDamageLogEntry& GetDamageLogEntryBySequence(uint64 Sequence) const;
+	void EvictDamageLogEntry(uint64 Sequence);
+	void AddActorDamageLogIndex(uint32 InActorID, uint64 Sequence);
+	void RemoveActorDamageLogIndex(uint32 InActorID, uint64 Sequence);
 	
 	UPROPERTY()
 	TMap<FGameplayAttribute, float> InstigatorAttributesBackup;
 	
-	void TempApplyAttributeModToInstigator(FDamageLogEntry DamageLogEntry, AActor* InInstigator);
+	void TempApplyAttributeModToInstigator(const FDamageLogEntry& DamageLogEntry, AActor* InInstigator);
 	void RestoreBackupAttributesToInstigator(AActor* InInstigator);
 	
 };
@@ -55,6 +55,9 @@ DECLARE_DELEGATE_OneParam(FOnDamageReceivedNative, const FDamageModificationCont
 DECLARE_DELEGATE_OneParam(FOnHealingAppliedNative,  const FDamageModificationContext&);
 DECLARE_DELEGATE_OneParam(FOnHealingReceivedNative, const FDamageModificationContext&);
 
+// Batched damage + healing modifications, flushed once per frame in batched mode
+DECLARE_DELEGATE_OneParam(FOnDamageEventBatchNative, TArrayView<const FDamageModificationContext>);
+
 /*
 ====================================================================
    NATIVE LISTENER STRUCTS
@@ -96,3 +99,14 @@ struct FNativeHealingListener
 	FOnHealingAppliedNative  OnApplied;
 	FOnHealingReceivedNative OnReceived;
 };
+
+USTRUCT()
+struct FNativeDamageBatchListener
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TWeakObjectPtr<UObject> Listener;
+
+	FOnDamageEventBatchNative OnBatch;
+};
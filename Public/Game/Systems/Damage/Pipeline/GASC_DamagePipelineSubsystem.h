@@ -67,12 +67,45 @@ struct FOnHealingEventListener
 	}
 };
 
+/* =======================================================================================
+ *  Per-actor listener bucket
+ * ======================================================================================= */
+
+/**
+ * Listeners that only care about events involving one specific actor.
+ * "Applied" listeners fire when the keyed actor is the instigator, "Received" listeners
+ * fire when it is the target. Native entries follow the same rule for their two delegates.
+ */
+struct FGASC_DamagePipelineActorBucket
+{
+	TArray<FOnHitEventListener> HitAppliedListeners;
+	TArray<FOnHitEventListener> HitReceivedListeners;
+
+	TArray<FOnDamageEventListener> DamageAppliedListeners;
+	TArray<FOnDamageEventListener> DamageReceivedListeners;
+
+	TArray<FOnHealingEventListener> HealingAppliedListeners;
+	TArray<FOnHealingEventListener> HealingReceivedListeners;
+
+	TArray<FNativeHitListener>     NativeHitListeners;
+	TArray<FNativeDamageListener>  NativeDamageListeners;
+	TArray<FNativeHealingListener> NativeHealingListeners;
+
+	bool IsEmpty() const
+	{
+		return HitAppliedListeners.IsEmpty() && HitReceivedListeners.IsEmpty() &&
+			   DamageAppliedListeners.IsEmpty() && DamageReceivedListeners.IsEmpty() &&
+			   HealingAppliedListeners.IsEmpty() && HealingReceivedListeners.IsEmpty() &&
+			   NativeHitListeners.IsEmpty() && NativeDamageListeners.IsEmpty() && NativeHealingListeners.IsEmpty();
+	}
+};
+
 /* =======================================================================================
  *  SUBSYSTEM
  * ======================================================================================= */
 
 UCLASS()
-class GASCOURSE_API UGASC_DamagePipelineSubsystem : public UWorldSubsystem
+class GASCOURSE_API UGASC_DamagePipelineSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -85,6 +118,17 @@ public:
 	virtual void Deinitialize() override;
 	virtual void PostInitialize() override;
 
+	/* ---------------------------------------------------------------------------------------
+	 *  Tick (only while batched events are pending)
+	 * --------------------------------------------------------------------------------------- */
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UGASC_DamagePipelineSubsystem, STATGROUP_Tickables);
+	}
+
 	/* ---------------------------------------------------------------------------------------
 	 *  Blueprint global multicast convenience events (UI/HUD)
 	 * --------------------------------------------------------------------------------------- */
@@ -112,27 +156,72 @@ public:
 
 	/* ---------------------------------------------------------------------------------------
 	 *  Native fast-path listeners (C++ only)
+	 *
+	 *  Passing a FilterActor subscribes the listener to that actor only: Applied callbacks fire
+	 *  when it is the instigator, Received callbacks when it is the target. Without a filter the
+	 *  listener lands in the global bucket and sees every event (HUD-style consumers).
 	 * --------------------------------------------------------------------------------------- */
 
 	// Hit
-	void RegisterNativeHitAppliedListener(UObject* Listener, FOnHitAppliedNative&& Callback);
-	void RegisterNativeHitReceivedListener(UObject* Listener, FOnHitReceivedNative&& Callback);
+	void RegisterNativeHitAppliedListener(UObject* Listener, FOnHitAppliedNative&& Callback, const AActor* FilterActor = nullptr);
+	void RegisterNativeHitReceivedListener(UObject* Listener, FOnHitReceivedNative&& Callback, const AActor* FilterActor = nullptr);
 	void UnregisterNativeHitListener(UObject* Listener);
 
 	// Damage
-	void RegisterNativeDamageAppliedListener(UObject* Listener, FOnDamageAppliedNative&& Callback);
-	void RegisterNativeDamageReceivedListener(UObject* Listener, FOnDamageReceivedNative&& Callback);
+	void RegisterNativeDamageAppliedListener(UObject* Listener, FOnDamageAppliedNative&& Callback, const AActor* FilterActor = nullptr);
+	void RegisterNativeDamageReceivedListener(UObject* Listener, FOnDamageReceivedNative&& Callback, const AActor* FilterActor = nullptr);
 	void UnregisterNativeDamageListener(UObject* Listener);
 
 	// Healing
-	void RegisterNativeHealingAppliedListener(UObject* Listener, FOnHealingAppliedNative&& Callback);
-	void RegisterNativeHealingReceivedListener(UObject* Listener, FOnHealingReceivedNative&& Callback);
+	void RegisterNativeHealingAppliedListener(UObject* Listener, FOnHealingAppliedNative&& Callback, const AActor* FilterActor = nullptr);
+	void RegisterNativeHealingReceivedListener(UObject* Listener, FOnHealingReceivedNative&& Callback, const AActor* FilterActor = nullptr);
 	void UnregisterNativeHealingListener(UObject* Listener);
 
 	// Backward-compatibility wrappers (old healing API)
 	void AddHealEventListener(AActor* ListenerActor, FOnHealingReceivedNative&& Delegate);
 	void RemoveHealingListener(AActor* ListenerActor);
 
+	/* ---------------------------------------------------------------------------------------
+	 *  Batched event bus
+	 *
+	 *  In batched mode damage/healing modifications are appended to a per-frame buffer and
+	 *  flushed once from Tick: per-event listeners are invoked in submission order, then every
+	 *  batch listener receives the whole frame as one contiguous view. In immediate mode batch
+	 *  listeners receive single-element views as events happen.
+	 * --------------------------------------------------------------------------------------- */
+
+	void RegisterNativeDamageBatchListener(UObject* Listener, FOnDamageEventBatchNative&& Callback);
+	void UnregisterNativeDamageBatchListener(UObject* Listener);
+
+	UFUNCTION(BlueprintCallable, Category = "GASCourse|Damage Pipeline")
+	void SetBatchedEventsEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category = "GASCourse|Damage Pipeline")
+	bool IsBatchingEvents() const { return bBatchEvents; }
+
+	/** Delivers everything queued so far. Safe to call at any time; a no-op when the buffer is empty. */
+	void FlushPendingDamageEvents();
+
+	/**
+	 * Entry point for attribute sets. Broadcasts immediately or queues for the end-of-frame flush.
+	 * ContextTags is copied when queued, so it may reference short-lived spec data.
+	 */
+	void Internal_SubmitDamageModification(const FDamageModificationContext& Context, const FGameplayTagContainer& ContextTags);
+
+	/* ---------------------------------------------------------------------------------------
+	 *  Deferred lifesteal
+	 *
+	 *  Lifesteal from every hit landed this frame is summed per instigator and applied from Tick
+	 *  as one instant healing spec, so a multi-hit AoE costs one heal application per instigator
+	 *  instead of one per target per hit.
+	 * --------------------------------------------------------------------------------------- */
+
+	/** Adds Amount to Instigator's pending lifesteal heal; DamagedTarget is kept for the damage log. */
+	void QueueLifestealHeal(AActor* Instigator, const AActor* DamagedTarget, float Amount);
+
+	/** Applies every pending lifesteal heal. Safe to call at any time; a no-op when nothing is queued. */
+	void FlushPendingLifesteal();
+
 	/* ---------------------------------------------------------------------------------------
 	 *  Internal broadcast entry points (called from AttributeSets / pipeline)
 	 * --------------------------------------------------------------------------------------- */
@@ -161,25 +250,29 @@ public:
 
 	/* ---------------------------------------------------------------------------------------
 	 *  Dynamic listener registration (Blueprint)
+	 *  FilterActor has the same meaning as for the native listeners above.
 	 * --------------------------------------------------------------------------------------- */
 
 	UFUNCTION()
-	void RegisterActorOnHit(UObject* Listener, EHitEventType EventType, FOnHitApplied_Event Callback);
+	void RegisterActorOnHit(UObject* Listener, EHitEventType EventType, FOnHitApplied_Event Callback, AActor* FilterActor = nullptr);
 
 	UFUNCTION()
-	void UnRegisterActorOnHit(UObject* Listener, EHitEventType EventType, FOnHitApplied_Event Callback);
+	void UnRegisterActorOnHit(UObject* Listener, EHitEventType EventType, FOnHitApplied_Event Callback, AActor* FilterActor = nullptr);
+
+	/** Same as UnRegisterActorOnHit, for callers that kept the filter actor's key because the actor may be gone by now. */
+	void UnRegisterActorOnHitForKey(UObject* Listener, EHitEventType EventType, FName CallbackFunctionName, const FObjectKey& FilterKey);
 
 	UFUNCTION()
-	void RegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType EventType, FOnDamageApplied_Event Callback);
+	void RegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType EventType, FOnDamageApplied_Event Callback, AActor* FilterActor = nullptr);
 
 	UFUNCTION()
-	void UnRegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType EventType, FOnDamageApplied_Event Callback);
+	void UnRegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType EventType, FOnDamageApplied_Event Callback, AActor* FilterActor = nullptr);
 
 	UFUNCTION()
-	void RegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType EventType, FOnHealingApplied_Event Callback);
+	void RegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType EventType, FOnHealingApplied_Event Callback, AActor* FilterActor = nullptr);
 
 	UFUNCTION()
-	void UnRegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType EventType, FOnHealingApplied_Event Callback);
+	void UnRegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType EventType, FOnHealingApplied_Event Callback, AActor* FilterActor = nullptr);
 
 	/* ---------------------------------------------------------------------------------------
 	 *  Legacy forwarder function names (kept, but now just call broadcast)
@@ -253,6 +346,66 @@ private:
 	UPROPERTY()
 	TArray<FNativeHealingListener> NativeHealingListeners;
 
+	UPROPERTY()
+	TArray<FNativeDamageBatchListener> NativeDamageBatchListeners;
+
+	/* ---------------------------------------------------------------------------------------
+	 *  BATCHED EVENT BUFFERS
+	 *  PendingContextTags runs parallel to PendingDamageEvents; tag pointers are fixed up at
+	 *  flush time since the buffers may reallocate while the frame fills them.
+	 * --------------------------------------------------------------------------------------- */
+
+	bool bBatchEvents = false;
+
+	TArray<FDamageModificationContext> PendingDamageEvents;
+	TArray<FGameplayTagContainer> PendingContextTags;
+
+	// Swapped with the pending buffers during a flush so listeners can safely queue more events.
+	TArray<FDamageModificationContext> FlushingDamageEvents;
+	TArray<FGameplayTagContainer> FlushingContextTags;
+
+	void BroadcastModification(const FDamageModificationContext& Context);
+	void BroadcastToBatchListeners(TArrayView<const FDamageModificationContext> Events);
+
+	/* ---------------------------------------------------------------------------------------
+	 *  PENDING LIFESTEAL
+	 *  One entry per instigator with lifesteal this frame; PendingLifestealIndex maps the
+	 *  instigator to its slot so repeated hits only add to the running total.
+	 * --------------------------------------------------------------------------------------- */
+
+	struct FPendingLifestealHeal
+	{
+		TWeakObjectPtr<AActor> Instigator;
+		float TotalHeal = 0.0f;
+
+		// Only filled when GASC_WITH_DAMAGE_LOG is on
+		TArray<FDamageLogLifestealSource> Sources;
+	};
+
+	TArray<FPendingLifestealHeal> PendingLifestealHeals;
+	TMap<FObjectKey, int32> PendingLifestealIndex;
+
+	// Swapped with PendingLifestealHeals during a flush, for the same reason as FlushingDamageEvents.
+	TArray<FPendingLifestealHeal> FlushingLifestealHeals;
+
+	/* ---------------------------------------------------------------------------------------
+	 *  PER-ACTOR LISTENER BUCKETS
+	 *  Everything stored here is weak, so the map does not need to be reflected for GC.
+	 * --------------------------------------------------------------------------------------- */
+
+	// Buckets are shared so a broadcast can keep one alive while a callback unregisters from it.
+	TMap<FObjectKey, TSharedPtr<FGASC_DamagePipelineActorBucket>> ActorListenerBuckets;
+
+	TSharedPtr<FGASC_DamagePipelineActorBucket> FindActorBucket(const AActor* Actor) const;
+	TSharedPtr<FGASC_DamagePipelineActorBucket> FindActorBucket(const FObjectKey& ActorKey) const;
+	FGASC_DamagePipelineActorBucket& FindOrAddActorBucket(const AActor* Actor);
+	void PruneActorBucket(const AActor* Actor);
+	void PruneActorBucket(const FObjectKey& ActorKey);
+
+	/** Drops buckets whose actor has been destroyed; their listeners can never be called again. */
+	void PruneDestroyedActorBuckets();
+	void RemoveFromAllActorBuckets(TFunctionRef<void(FGASC_DamagePipelineActorBucket&)> RemoveFn);
+
 	/* ---------------------------------------------------------------------------------------
 	 *  Logging & GameplayEffect helpers
 	 * --------------------------------------------------------------------------------------- */
@@ -150,8 +150,35 @@ struct FDamagePipelineEffectOverTimeContext
 	bool bApplyValueOverTotalDuration = false;
 };
 
+/**
+ * Damage log capture is debug-only. With this off, executions and the health set skip every log write and the
+ * effect context carries no log record; damage math never reads the log, so results are identical either way.
+ */
+#ifndef GASC_WITH_DAMAGE_LOG
+#define GASC_WITH_DAMAGE_LOG !UE_BUILD_SHIPPING
+#endif
+
+/**
+ * One captured attribute value in a damage log entry. The attribute is stored as its FProperty
+ * (what FGameplayAttribute wraps) so recording it never builds a name string.
+ */
+struct FDamageLogAttributeValue
+{
+	const FProperty* AttributeProperty = nullptr;
+	float Value = 0.0f;
+};
+
+/** One damaged target's share of a batched lifesteal heal. */
+struct FDamageLogLifestealSource
+{
+	uint32 SourceTargetID = 0;
+	FName SourceTargetName;
+	float Amount = 0.0f;
+};
+
 /**
  * Logging entry – used for debug UI / pipeline logging.
+ * Kept compact: names are FNames, attributes live inline, and only the impact point/normal of the hit is kept.
  */
 USTRUCT(BlueprintType)
 struct FDamageLogEntry
@@ -164,27 +191,51 @@ struct FDamageLogEntry
 
 	uint32 DamageID          = 0;
 	float  DamageTimeStamp   = 0.0f;
-	FHitResult HitResult;
 
-	FString HitTargetName;
-	FString HitInstigatorName;
-	FString OptionalSourceObjectName;
+	FVector_NetQuantize       ImpactPoint  = FVector::ZeroVector;
+	FVector_NetQuantizeNormal ImpactNormal = FVector::ZeroVector;
+
+	FName HitTargetName;
+	FName HitInstigatorName;
+	FName OptionalSourceObjectName;
 
 	FGameplayTagContainer HitTargetTagsContainer;
 	FGameplayTagContainer HitInstigatorTagsContainer;
 	FGameplayTagContainer HitContextTagsContainer;
 	
-	TMap<FString, float> Attributes;
+	TArray<FDamageLogAttributeValue, TInlineAllocator<6>> Attributes;
+
+	// Only filled for lifesteal heals: the hits that were merged into this one application
+	TArray<FDamageLogLifestealSource> LifestealSources;
+
 	float BaseDamageValue = 0.0f;
 	float ModifiedDamageValue = 0.0f;
 	float FinalDamageValue = 0.0f;
 	
-	bool bIsDamageEffect = false;
-	bool bIsCriticalHit = false;
-	bool bIsOverTimeEffect = false;
-	bool bIsSimulatedDamage = false;
-	bool bDamageResisted = false;
-	bool bLifeSteal = false;
+	uint8 bHasHitResult : 1 = false;
+	uint8 bIsDamageEffect : 1 = false;
+	uint8 bIsCriticalHit : 1 = false;
+	uint8 bIsOverTimeEffect : 1 = false;
+	uint8 bIsSimulatedDamage : 1 = false;
+	uint8 bDamageResisted : 1 = false;
+	uint8 bLifeSteal : 1 = false;
 
 	FDamageLogEntry() = default;
+
+	void SetHitResult(const FHitResult& HitResult)
+	{
+		bHasHitResult = HitResult.bBlockingHit;
+		ImpactPoint = HitResult.ImpactPoint;
+		ImpactNormal = HitResult.ImpactNormal;
+	}
+
+	void AddAttribute(const FProperty* AttributeProperty, float Value)
+	{
+		Attributes.Add({AttributeProperty, Value});
+	}
+
+	const FDamageLogAttributeValue* FindAttribute(const FProperty* AttributeProperty) const
+	{
+		return Attributes.FindByPredicate([AttributeProperty](const FDamageLogAttributeValue& Entry) { return Entry.AttributeProperty == AttributeProperty; });
+	}
 };
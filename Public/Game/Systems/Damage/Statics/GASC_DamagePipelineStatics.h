@@ -48,23 +48,23 @@ public:
 	UFUNCTION(BlueprintPure, Category="Damage|Context")
 	static FHitResult GetHitResultCopyFromDamageContext(const FDamageModificationContext& DamageContext);
 	
-	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline")
-	static bool RegisterActorOnHit(AActor* Listener, EHitEventType HitEvent , FOnHitApplied_Event Callback);
+	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline", meta=(AdvancedDisplay="FilterActor"))
+	static bool RegisterActorOnHit(AActor* Listener, EHitEventType HitEvent , FOnHitApplied_Event Callback, AActor* FilterActor = nullptr);
 	
-	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline")
-	static bool UnRegisterActorOnHit(AActor* Listener, EHitEventType HitEvent , FOnHitApplied_Event Callback);
+	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline", meta=(AdvancedDisplay="FilterActor"))
+	static bool UnRegisterActorOnHit(AActor* Listener, EHitEventType HitEvent , FOnHitApplied_Event Callback, AActor* FilterActor = nullptr);
 	
-	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline")
-	static bool RegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType DamageEvent , FOnDamageApplied_Event Callback);
+	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline", meta=(AdvancedDisplay="FilterActor"))
+	static bool RegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType DamageEvent , FOnDamageApplied_Event Callback, AActor* FilterActor = nullptr);
 	
-	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline")
-	static bool UnRegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType DamageEvent , FOnDamageApplied_Event Callback);
+	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline", meta=(AdvancedDisplay="FilterActor"))
+	static bool UnRegisterActorOnDamageEvent(UObject* Listener, EOnDamageEventType DamageEvent , FOnDamageApplied_Event Callback, AActor* FilterActor = nullptr);
 	
-	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline")
-	static bool RegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType HealingEvent , FOnHealingApplied_Event Callback);
+	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline", meta=(AdvancedDisplay="FilterActor"))
+	static bool RegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType HealingEvent , FOnHealingApplied_Event Callback, AActor* FilterActor = nullptr);
 	
-	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline")
-	static bool UnRegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType HealingEvent , FOnHealingApplied_Event Callback);
+	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline", meta=(AdvancedDisplay="FilterActor"))
+	static bool UnRegisterActorOnHealingEvent(UObject* Listener, EOnHealingEventType HealingEvent , FOnHealingApplied_Event Callback, AActor* FilterActor = nullptr);
 	
 	UFUNCTION(BlueprintCallable, Category = "Damage Pipeline")
 	static bool ApplyDamageToTarget(AActor* Target, AActor* Instigator, float Damage, const FDamagePipelineContext& DamageContext);
@@ -31,5 +31,4 @@ private:
 	
 	static TWeakObjectPtr<APawn> SelectedPawn;
 	static TWeakObjectPtr<UGASC_ActiveCardResourceManager> SelectedResourceManager;
-	static TArray<FActiveCardEnergyXPHistoryEntry> ActiveCardEnergyXPHistoryEntries;
 };
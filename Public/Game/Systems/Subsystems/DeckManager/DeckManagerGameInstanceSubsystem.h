@@ -3,8 +3,11 @@
 #pragma once
 
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Game/Deck/GASC_DeckEngine.h"
 #include "DeckManagerGameInstanceSubsystem.generated.h"
 
+struct FStreamableHandle;
+
 /**
  * UDeckManagerGameInstanceSubsystem is a subsystem designed to manage deck-related functionality
  * within the game instance. It inherits from UGameInstanceSubsystem, leveraging its lifecycle
@@ -24,8 +27,33 @@ UCLASS()
 class GASCOURSE_API UDeckManagerGameInstanceSubsystem : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
-	
-	
-	
-	
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Returns the deck registered under DeckId. Decks live as long as the game instance, so they survive level
+	 * transitions while the components that use them are recreated. The reference is invalidated when another deck is added.
+	 *
+	 * @param bOutCreated Set to true if the deck did not exist and was created empty.
+	 */
+	FGASC_DeckEngine& FindOrAddDeck(FName DeckId, bool& bOutCreated);
+
+	FGASC_DeckEngine* FindDeck(FName DeckId);
+
+	void RemoveDeck(FName DeckId);
+
+	/**
+	 * Streams in every card data asset referenced by the deck and keeps it resident, so draws and activations resolve
+	 * card data without touching the disk. Call again after adding cards the deck did not reference before.
+	 */
+	void PreloadCardData(FName DeckId);
+
+private:
+
+	UPROPERTY()
+	TMap<FName, FGASC_DeckEngine> Decks;
+
+	TMap<FName, TSharedPtr<FStreamableHandle>> CardDataHandles;
 };
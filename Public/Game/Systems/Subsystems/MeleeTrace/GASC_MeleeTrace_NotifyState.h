@@ -33,12 +33,13 @@ public:
 	float HitCooldown = 0.2f;
 private:
 
-	FGuid MeleeTraceNotifyID;
-	FGASC_MeleeTrace_Subsystem_Data MeleeTraceSubsystemData;
+	// Active traces live in UGASC_MeleeTrace_Subsystem keyed by mesh and notify, since this object is shared by every mesh playing the montage
 
 	FGASC_MeleeTrace_Subsystem_Data CreateShapeDataFromRow(FGASC_MeleeTrace_TraceShapeData RowData);
 
 #if WITH_EDITORONLY_DATA
+	// Editor preview only
+	FGASC_MeleeTrace_Subsystem_Data MeleeTraceSubsystemData;
 	TWeakObjectPtr<UMeshComponent> DebugMeshComponent = nullptr;
 	TArray<FVector> PreviousFrameSamples;
 #endif
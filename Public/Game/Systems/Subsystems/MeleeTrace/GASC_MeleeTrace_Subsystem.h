@@ -4,13 +4,16 @@
 
 #include "Subsystems/WorldSubsystem.h"
 #include "GASCourse/Public/Game/Systems/Subsystems/MeleeTrace/Shapes/GASC_MeleeShape_Base.h"
-#include "Misc/Guid.h"
 #include "CollisionShape.h"
+#include "WorldCollision.h"
 #include "Engine/Engine.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Game/Systems/Subsystems/MeleeTrace/Settings/GASC_MeleeSubsystem_Settings.h" 
 #include "GASC_MeleeTrace_Subsystem.generated.h"
 
+class USkeletalMeshComponent;
+class UGASCourseAbilitySystemComponent;
+
 DECLARE_LOG_CATEGORY_EXTERN(LOG_GASC_MeleeTraceSubsystem, Log, All);
 
 UENUM(BlueprintType)
@@ -59,16 +62,30 @@ struct FGASC_MeleeTrace_TraceShapeData : public FTableRowBase
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Melee Trace|Socket Data")
 	int32 TraceDensity = 2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Melee Trace|Execution")
+	EGASC_MeleeTrace_ExecutionMode ExecutionMode = EGASC_MeleeTrace_ExecutionMode::ProjectDefault;
 	
 };
 
 /**
- * FGASC_MeleeTrace_Subsystem_Data is a data structure used for configuring and handling melee trace functionality.
- * It encapsulates configuration details required for performing melee traces, including trace shape, trace sockets,
- * trace density, and runtime metadata such as source mesh component, instigator actor, and collision data.
+ * A single sweep segment submitted through the async trace API, kept until its results are read back next frame.
+ */
+struct FGASC_MeleeTrace_PendingSweep
+{
+	FTraceHandle Handle;
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+};
+
+/**
+ * FGASC_MeleeTrace_Subsystem_Data is a data structure used for configuring melee trace requests.
+ * It encapsulates the configuration required to perform a melee trace: trace shape, trace sockets,
+ * trace density, execution mode and hit cooldown.
  *
- * This structure serves as the core data exchanged and processed by the melee trace subsystem, enabling precise
- * collision detection and multi-frame sample tracking during melee interactions.
+ * This structure is the request descriptor handed to the melee trace subsystem. Runtime state for an active swing
+ * lives in the subsystem's own storage and is addressed through an FGASC_MeleeTraceHandle.
  */
 USTRUCT(BlueprintType)
 struct FGASC_MeleeTrace_Subsystem_Data
@@ -90,32 +107,116 @@ struct FGASC_MeleeTrace_Subsystem_Data
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Melee Trace")
 	int32 TraceDensity = 1;
 
-	TWeakObjectPtr<UMeshComponent> SourceMeshComponent = nullptr;
-	
-	UPROPERTY()
-	AActor* InstigatorActor = nullptr;
-	
-	FCollisionShape TraceCollisionShape;
-	TArray<FVector> PreviousFrameSamples;
-	
-	UPROPERTY()
-	TArray<AActor*> HitActors;
-	
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Melee Trace")
+	EGASC_MeleeTrace_ExecutionMode ExecutionMode = EGASC_MeleeTrace_ExecutionMode::ProjectDefault;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee Trace")
+	float HitCooldownTime = 0.0f;
+
+	FGASC_MeleeTrace_Subsystem_Data() {}
+};
+
+/**
+ * @brief Generational handle to an active melee trace request.
+ *
+ * Index addresses a slot in the subsystem's slot table; Generation is bumped every time that slot is released,
+ * so a handle kept past the end of its swing can never alias a newer request that reused the slot.
+ */
+USTRUCT(BlueprintType)
+struct FGASC_MeleeTraceHandle
+{
+	GENERATED_BODY()
+
 	UPROPERTY()
-	TArray<AActor*> HitActors_PreviousFrames;
-	
+	int32 Index = INDEX_NONE;
+
 	UPROPERTY()
+	int32 Generation = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; Generation = 0; }
+
+	bool operator==(const FGASC_MeleeTraceHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FGASC_MeleeTraceHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FGASC_MeleeTraceHandle& Handle)
+	{
+		return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation));
+	}
+};
+
+/**
+ * Key for the per-frame socket location cache: one entry per (mesh component, socket) pair touched this frame.
+ */
+struct FGASC_MeleeTrace_SocketKey
+{
+	TObjectKey<UMeshComponent> MeshComponent;
+	FName SocketName;
+
+	bool operator==(const FGASC_MeleeTrace_SocketKey& Other) const
+	{
+		return MeshComponent == Other.MeshComponent && SocketName == Other.SocketName;
+	}
+
+	friend uint32 GetTypeHash(const FGASC_MeleeTrace_SocketKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.MeshComponent), GetTypeHash(Key.SocketName));
+	}
+};
+
+/**
+ * Key for traces started by an anim notify state. Notify states are shared by every mesh playing the animation,
+ * so the notify alone cannot own the trace; each (mesh component, notify) pair gets its own.
+ */
+struct FGASC_MeleeTrace_NotifyKey
+{
+	TObjectKey<USkeletalMeshComponent> MeshComponent;
+	TObjectKey<UObject> Notify;
+
+	bool operator==(const FGASC_MeleeTrace_NotifyKey& Other) const
+	{
+		return MeshComponent == Other.MeshComponent && Notify == Other.Notify;
+	}
+
+	friend uint32 GetTypeHash(const FGASC_MeleeTrace_NotifyKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.MeshComponent), GetTypeHash(Key.Notify));
+	}
+};
+
+/**
+ * Per-frame data for an active swing, read on every ProcessMeleeTraces pass.
+ * Kept in its own packed array so the sampling/sweep loop walks contiguous memory.
+ */
+struct FGASC_MeleeTrace_HotData
+{
+	TWeakObjectPtr<UMeshComponent> SourceMeshComponent;
+	FCollisionShape TraceCollisionShape;
+	FName TraceSocket_Start = NAME_None;
+	FName TraceSocket_End = NAME_None;
+	int32 TraceDensity = 1;
+
+	// Resolved from ExecutionMode when the request is added
+	bool bAsyncTrace = false;
+
+	// Set when cancelled while async sweeps are still in flight; the request lives one more frame to read them back
+	bool bCancelRequested = false;
+
+	TArray<FVector, TInlineAllocator<8>> PreviousFrameSamples;
+};
+
+/**
+ * Data only touched when a sweep actually hits something or an async sweep is resolved.
+ */
+struct FGASC_MeleeTrace_ColdData
+{
+	TWeakObjectPtr<AActor> InstigatorActor;
+	TSet<TWeakObjectPtr<AActor>> HitActors;
 	TArray<FHitResult> HitResults_PreviousFrames;
-	
-	UPROPERTY()
 	TMap<TWeakObjectPtr<AActor>, float> PerActorHitStamps;
-	
+	TArray<FGASC_MeleeTrace_PendingSweep> PendingAsyncSweeps;
 	float SwingStartTime = 0.0f;
 	float HitCooldownTime = 0.0f;
-	
-	FGuid TraceId;
-
-	FGASC_MeleeTrace_Subsystem_Data() {}
 };
 
 /**
@@ -197,16 +298,29 @@ public:
 	float LifeTime,
 	uint8 DepthPriority = 0);
 
+	/**
+	 * @brief Starts a melee trace for the instigator and returns a handle to it.
+	 * The returned handle is the only way to query or cancel the request; it is invalid if the request could not be started.
+	 */
 	UFUNCTION(BlueprintCallable, Category="GASCourse|MeleeTrace")
-	void RequestShapeMeleeTrace(AActor* Instigator, FGASC_MeleeTrace_Subsystem_Data TraceData, FGuid TraceId);
+	FGASC_MeleeTraceHandle RequestShapeMeleeTrace(AActor* Instigator, FGASC_MeleeTrace_Subsystem_Data TraceData);
 
 	UFUNCTION(BlueprintCallable, Category="GASCourse|MeleeTrace")
-	bool IsMeleeTraceInProgress(FGuid TraceId);
+	bool IsMeleeTraceInProgress(FGASC_MeleeTraceHandle TraceHandle) const;
 
 	FGASC_MeleeTrace_Subsystem_Data CreateShapeDataFromRow(const FGASC_MeleeTrace_TraceShapeData& RowData) const;
 
 	UFUNCTION(BlueprintCallable, Category="GASCourse|MeleeTrace")
-	bool CancelMeleeTrace(FGuid TraceId);
+	bool CancelMeleeTrace(FGASC_MeleeTraceHandle TraceHandle);
+
+	/** True while Notify has a trace running on MeshComp. */
+	bool IsNotifyMeleeTraceInProgress(const USkeletalMeshComponent* MeshComp, const UObject* Notify) const;
+
+	/** Starts Notify's trace on MeshComp's owner. A trace Notify already has running on MeshComp is kept. */
+	FGASC_MeleeTraceHandle BeginNotifyMeleeTrace(USkeletalMeshComponent* MeshComp, const UObject* Notify, const FGASC_MeleeTrace_Subsystem_Data& TraceData);
+
+	/** Cancels Notify's trace on MeshComp, leaving traces other meshes run for the same notify alone. */
+	void EndNotifyMeleeTrace(const USkeletalMeshComponent* MeshComp, const UObject* Notify);
 
 	UFUNCTION()
 	TWeakObjectPtr<UMeshComponent> GetMeshComponent(const AActor* Actor, const FGASC_MeleeTrace_Subsystem_Data& InTraceData);
@@ -223,12 +337,69 @@ public:
 	TArray<FVector>& OutSamples);
 
 private:
-	
-	TArray<FGASC_MeleeTrace_Subsystem_Data> MeleeTraceRequests;
+
+	/** Slot table entry: where a handle's request currently lives in the dense arrays. */
+	struct FMeleeTraceSlot
+	{
+		int32 DenseIndex = INDEX_NONE;
+		int32 Generation = 0;
+	};
+
+	/*
+	 * Active swings are stored as parallel dense arrays (hot/cold/owner slot), always packed and removed by swap.
+	 * Slots give O(1) handle -> dense index lookup and are recycled through FreeMeleeTraceSlots.
+	 */
+	TArray<FGASC_MeleeTrace_HotData> MeleeTraceHotData;
+	TArray<FGASC_MeleeTrace_ColdData> MeleeTraceColdData;
+	TArray<int32> MeleeTraceDenseToSlot;
+
+	TArray<FMeleeTraceSlot> MeleeTraceSlots;
+	TArray<int32> FreeMeleeTraceSlots;
+
+	/** Traces started through BeginNotifyMeleeTrace, one per mesh and notify. */
+	TMap<FGASC_MeleeTrace_NotifyKey, FGASC_MeleeTraceHandle> NotifyMeleeTraces;
+
+	/** True while ProcessMeleeTraces runs; cancels are deferred to the next frame so dense indices stay stable. */
+	bool bProcessingMeleeTraces = false;
+
+	/** Returns the dense index for a live handle, or INDEX_NONE if the handle is stale or invalid. */
+	int32 ResolveMeleeTraceHandle(const FGASC_MeleeTraceHandle& TraceHandle) const;
+
+	/** Swap-removes the request at DenseIndex and retires its slot so outstanding handles go stale. */
+	void RemoveMeleeTraceAt(int32 DenseIndex);
 
 	void ProcessMeleeTraces(float DeltaTime);
 
+	/*
+	 * Socket locations sampled this frame, shared by every swing on the same mesh. Reset (not freed) at the start of
+	 * each ProcessMeleeTraces pass, which runs after the world's tick groups so animation has already been evaluated.
+	 */
+	TMap<FGASC_MeleeTrace_SocketKey, FVector> SocketLocationCache;
+
+	/** Returns the socket location from the per-frame cache, sampling the mesh on first use this frame. */
+	FVector GetCachedSocketLocation(const UMeshComponent* MeshComponent, const FName& SocketName);
+
+	/** Scratch buffers reused across frames so steady-state processing does not touch the heap. */
+	TArray<FHitResult> SweepHitScratch;
+	TArray<FGASC_MeleeTrace_PendingSweep> ResolvingAsyncSweeps;
+	FTraceDatum TraceDatumScratch;
+
+	/** Reads back last frame's async sweeps for a request and applies their hits. */
+	void ResolveAsyncMeleeSweeps(int32 DenseIndex, bool bShouldDrawDebug);
+
+	/** Shared hit handling for sync and async sweeps: dedupe, hit stamps, damage pipeline and gameplay events. */
+	void HandleMeleeTraceHits(int32 DenseIndex, const TArray<FHitResult>& HitResults);
+
 	FCollisionObjectQueryParams ConfigureCollisionObjectParams(const TArray<TEnumAsByte<EObjectTypeQuery> > & ObjectTypes);
+
+	/**
+	 * Targets that were queued hit reactions this tick. Tickable subsystems run after every tick group, so these
+	 * queues are flushed at the end of Tick rather than waiting for the next frame's event queue flush.
+	 */
+	TArray<TWeakObjectPtr<UGASCourseAbilitySystemComponent>> HitReactionTargetASCs;
+
+	/** Built once from the settings' object types in OnWorldBeginPlay and shared by every sweep. */
+	FCollisionObjectQueryParams MeleeTraceObjectParams;
 	
 	UPROPERTY()
 	const UGASC_MeleeSubsystem_Settings* MeleeTraceSettings = nullptr;
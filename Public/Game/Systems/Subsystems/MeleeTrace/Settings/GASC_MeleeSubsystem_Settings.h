@@ -5,6 +5,20 @@
 #include "Engine/DeveloperSettings.h"
 #include "GASC_MeleeSubsystem_Settings.generated.h"
 
+/**
+ * @brief Selects how the melee trace subsystem executes the sweeps of a trace request.
+ *
+ * Synchronous sweeps resolve hits in the same frame they are issued. Asynchronous sweeps are
+ * batched through the world's async trace API and their hits are resolved on the following frame.
+ */
+UENUM(BlueprintType)
+enum class EGASC_MeleeTrace_ExecutionMode : uint8
+{
+	ProjectDefault UMETA(ToolTip = "Use DefaultExecutionMode from the melee trace system settings."),
+	Synchronous,
+	Asynchronous
+};
+
 /**
  * @brief The UGASC_MeleeSubsystem_Settings class is a configuration class derived from UDeveloperSettings.
  *
@@ -87,6 +101,16 @@ public:
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Melee Trace Subsystem")
 	TArray<TEnumAsByte<EObjectTypeQuery>> CollisionObjectTypes;
 
+	/**
+	 * @brief Execution mode used by trace requests that leave their own mode on ProjectDefault.
+	 *
+	 * @details
+	 * Asynchronous mode submits every sample segment of the frame through the world's async trace API
+	 * and applies hits one frame later, keeping blocking sweeps off the game thread when many swings overlap.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Melee Trace Subsystem", meta = (InvalidEnumValues = "ProjectDefault"))
+	EGASC_MeleeTrace_ExecutionMode DefaultExecutionMode = EGASC_MeleeTrace_ExecutionMode::Synchronous;
+
 	UGASC_MeleeSubsystem_Settings();
 	
 };
@@ -24,6 +24,31 @@ enum class EGASC_TimeDilation_Priority : uint8
 	Critical,
 };
 
+/**
+ * @struct FGASC_TimeDilation_CurveLUT
+ * @brief A time dilation blend curve pre-sampled over normalized alpha [0, 1].
+ *
+ * Baked once per (curve, blend mode, sample count) and shared between every request using that combination, so
+ * per-tick evaluation is a clamped table lookup instead of a curve or blend function evaluation.
+ */
+struct FGASC_TimeDilation_CurveLUT
+{
+	TArray<float> Samples;
+
+	float Evaluate(float Alpha) const
+	{
+		const int32 LastIndex = Samples.Num() - 1;
+		if (LastIndex <= 0)
+		{
+			return LastIndex == 0 ? Samples[0] : Alpha;
+		}
+
+		const float Position = FMath::Clamp(Alpha, 0.0f, 1.0f) * LastIndex;
+		const int32 Index = FMath::Min(FMath::FloorToInt32(Position), LastIndex - 1);
+		return FMath::Lerp(Samples[Index], Samples[Index + 1], Position - Index);
+	}
+};
+
 /**
  * @struct FGASC_TimeDilation_Subsystem_Data
  * @brief Represents the data structure used for configuring and managing time dilation effects in a game subsystem.
@@ -55,14 +80,18 @@ struct FGASC_TimeDilation_Subsystem_Data
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TimeDilation", meta = (EditCondition = "bUseTimeDilationCurve", EditConditionHides))
 	EAlphaBlendOption BlendMode = EAlphaBlendOption::Custom;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TimeDilation",  meta = (EditCondition = "BlendMode == EAlphaBlendOption::Custom",EditConditionHides))
+	/** When set, drives the dilation instead of BlendMode. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TimeDilation",  meta = (EditCondition = "bUseTimeDilationCurve",EditConditionHides))
 	UCurveFloat* CustomTimeDilationCurve = nullptr;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TimeDilation")
 	EGASC_TimeDilation_Priority Priority = EGASC_TimeDilation_Priority::Normal;
 
 	float ElapsedTime;
-	TArray<AActor*> AffectedActors;
+	TArray<TWeakObjectPtr<AActor>> AffectedActors;
+
+	/** Baked blend curve, assigned when the request is added if bUseTimeDilationCurve is set. */
+	TSharedPtr<const FGASC_TimeDilation_CurveLUT> CurveLUT;
 
 	FGASC_TimeDilation_Subsystem_Data() : TimeDilationDuration(0.0f), ElapsedTime(0.0f) {}
 	FGASC_TimeDilation_Subsystem_Data(float InTimeDilationDuration) : TimeDilationDuration(InTimeDilationDuration), ElapsedTime(0.0f) {}
@@ -113,8 +142,8 @@ public:
 	 * @brief Adds a local hit stop effect to specific actors using the provided data.
 	 *
 	 * This method applies a time dilation effect to a set of actors defined in the AffectedActors array.
-	 * If there is an existing active local time dilation effect and the new data has a higher priority,
-	 * it will replace the current effect. Otherwise, the new data is enqueued for later processing.
+	 * The request starts immediately on its own channel; actors affected by several channels at once resolve
+	 * to the highest priority channel, and to the strongest (lowest) dilation among channels of equal priority.
 	 *
 	 * @param HitStopData A structure containing the time dilation scale, duration, progression curve, and
 	 * priority for the local hit stop effect.
@@ -134,7 +163,9 @@ public:
 	 * the custom curve dilation duration. Any value above 0.0f will mean we want to override the duration.
 	 * @param TimeDilationMinValue The minimum time dilation value to apply. A value less than 1 slows time, greater than 1 speeds it up.
 	 * @param AlphaBlendOption Specifies the blending mode to transition into the time dilation effect. Example: Linear or Cubic.
-	 * @param Curve A float curve defining the progression of time dilation over the specified duration. If null, a constant time dilation is applied.
+	 * Ignored when Curve is set.
+	 * @param Curve A float curve defining the progression of time dilation over the specified duration, used whatever
+	 * AlphaBlendOption is. If null, the effect uses AlphaBlendOption.
 	 * @param Priority The priority of this time dilation effect. Higher priority effects override lower priority ones.
 	 */
 	UFUNCTION(BlueprintCallable, Category="GASCourse|TimeDilation")
@@ -145,15 +176,16 @@ public:
 	 * @brief Adds a local hit stop effect with a specified time dilation curve and properties.
 	 *
 	 * This method allows customizing a local hit stop effect by specifying the duration, minimum time dilation,
-	 * blending options, priority and optionally affected actors. If an active local time dilation is already present,
-	 * this method will override it if the priority of the new configuration is higher.
+	 * blending options, priority and optionally affected actors. The request starts immediately on its own channel and
+	 * is resolved per actor against any other active local hit stops by priority, then by the lowest dilation.
 	 *
 	 * @param TimeDilationDuration The duration of the hit stop effect in seconds. If -1.0f, the duration will be infinite. A value of 0 will mean that we want to use
 	 * the custom curve dilation duration. Any value above 0.0f will mean we want to override the duration.
 	 * @param TimeDilationMinValue The minimum time dilation value for the effect. Lower values slow time down further.
 	 * @param AlphaBlendOption The blending mode used to interpolate the time dilation effect over its duration.
-	 * @param Curve An optional float curve that defines how the time dilation progresses over its duration.
-	 * If null, the effect will use the specified blending mode.
+	 * Ignored when Curve is set.
+	 * @param Curve An optional float curve that defines how the time dilation progresses over its duration, used
+	 * whatever AlphaBlendOption is. If null, the effect will use the specified blending mode.
 	 * @param Priority The priority level of the time dilation effect. Effects with higher priority override lower ones.
 	 * @param AffectedActors A list of actors that should be specifically affected by this time dilation effect.
 	 */
@@ -182,8 +214,8 @@ public:
 	 * @brief Adds a local hit stop effect with a specified time dilation for a defined duration, priority, and affected actors.
 	 *
 	 * This method applies a time dilation effect locally to the subsystem, affecting specific actors.
-	 * It replaces the currently active local hit stop if the new effect has a higher priority.
-	 * Otherwise, the new effect is enqueued and will be applied when the current one finishes.
+	 * The effect starts immediately and runs concurrently with other local hit stops; each actor uses the
+	 * highest priority effect touching it, breaking ties with the lowest dilation value.
 	 *
 	 * @param TimeDilationDuration The duration, in seconds, for which the time dilation effect is applied.
 	 * @param TimeDilationMinValue The minimum value of the time dilation to apply, determining how slow time becomes.
@@ -235,11 +267,71 @@ public:
 
 private:
 	
+	/**
+	 * @brief Cache key for baked blend curves. Duration only affects the table resolution, so it is quantized to a
+	 * power-of-two sample count; arbitrary durations map onto a handful of tables.
+	 */
+	struct FCurveLUTKey
+	{
+		TObjectKey<UCurveFloat> Curve;
+		EAlphaBlendOption BlendMode = EAlphaBlendOption::Linear;
+		int32 NumSamples = 0;
+
+		bool operator==(const FCurveLUTKey& Other) const
+		{
+			return Curve == Other.Curve && BlendMode == Other.BlendMode && NumSamples == Other.NumSamples;
+		}
+
+		friend uint32 GetTypeHash(const FCurveLUTKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Curve), GetTypeHash(Key.BlendMode)), GetTypeHash(Key.NumSamples));
+		}
+	};
+
+	/** @brief Baked tables; emptied when it reaches its cap. Running hit stops keep their own reference to their table. */
+	TMap<FCurveLUTKey, TSharedPtr<const FGASC_TimeDilation_CurveLUT>> CurveLUTCache;
+
+#if WITH_EDITOR
+	/** @brief Drops the tables baked from a curve asset that is about to be edited. */
+	void OnObjectModified(UObject* Object);
+
+	FDelegateHandle ObjectModifiedHandle;
+#endif
+
+	/** @brief Returns the shared baked table for this request's curve/blend/duration, baking it on first use. */
+	TSharedPtr<const FGASC_TimeDilation_CurveLUT> FindOrBakeCurveLUT(const FGASC_TimeDilation_Subsystem_Data& HitStopData);
+
+	/** @brief Resolves the request's duration and bakes its curve; every add path goes through here. */
+	void PrepareHitStop(FGASC_TimeDilation_Subsystem_Data& HitStopData);
+
+	/** @brief Evaluates a hit stop's dilation at its current elapsed time. */
+	static float EvaluateHitStopTimeDilation(const FGASC_TimeDilation_Subsystem_Data& HitStopData);
+
+	void AddGlobalTimeDilation(FGASC_TimeDilation_Subsystem_Data&& HitStopData);
+
 	TQueue<FGASC_TimeDilation_Subsystem_Data> GlobalTimeDilationQueue;
-	TQueue<FGASC_TimeDilation_Subsystem_Data> LocalTimeDilationQueue;
 	
-	FGASC_TimeDilation_Subsystem_Data* ActiveGlobalTimeDilation;
-	FGASC_TimeDilation_Subsystem_Data* ActiveLocalTimeDilation;
+	FGASC_TimeDilation_Subsystem_Data* ActiveGlobalTimeDilation = nullptr;
+
+	/**
+	 * @brief Active local hit stops, one channel per request.
+	 *
+	 * Dense and swap-removed without shrinking, so the array's allocation is reused as a pool across requests.
+	 */
+	TArray<FGASC_TimeDilation_Subsystem_Data> ActiveLocalTimeDilations;
+
+	/** @brief Winning dilation for one actor this frame, resolved across all local channels touching it. */
+	struct FResolvedLocalTimeDilation
+	{
+		EGASC_TimeDilation_Priority Priority = EGASC_TimeDilation_Priority::Low;
+		float TimeDilation = 1.0f;
+	};
+
+	/** @brief Per-actor resolution for the current and previous frame; swapped each tick so neither reallocates. */
+	TMap<TWeakObjectPtr<AActor>, FResolvedLocalTimeDilation> ResolvedLocalTimeDilations;
+	TMap<TWeakObjectPtr<AActor>, FResolvedLocalTimeDilation> PreviousResolvedLocalTimeDilations;
+
+	void AddLocalTimeDilationChannel(FGASC_TimeDilation_Subsystem_Data&& HitStopData, const TArray<AActor*>& AffectedActors);
 
 	void ProcessGlobalHitStops(float DeltaTime);
 	void ProcessLocalHitStops(float DeltaTime);
@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "GASC_CursorQuerySubsystem.generated.h"
+
+/**
+ * @class UGASC_CursorQuerySubsystem
+ * @brief Per-frame cache of the local player's cursor ray and the world hits along it.
+ *
+ * Nothing is computed until a consumer asks. The first request in a frame deprojects the cursor, and the first
+ * request for a given trace channel runs one multi line trace along that ray, ignoring the player's pawn. Every
+ * later request in the same frame reads the cached result, so targeting actors, reticles and filters can all
+ * query the cursor without adding traces. Consumers apply their own filtering to the cached hits.
+ */
+UCLASS()
+class GASCOURSE_API UGASC_CursorQuerySubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UGASC_CursorQuerySubsystem* Get(const APlayerController* PlayerController);
+
+	/** The cursor ray for this frame; false when the player has no viewport or cursor to deproject. */
+	bool GetCursorRay(FVector& OutRayOrigin, FVector& OutRayDirection);
+
+	/**
+	 * Hits along this frame's cursor ray on Channel within MaxRange, nearest first, ending at the first blocking hit.
+	 * The view is only valid until the next call into this subsystem.
+	 */
+	TConstArrayView<FHitResult> GetCursorHits(ECollisionChannel Channel, float MaxRange);
+
+	/** Nearest blocking hit along the cursor ray on Channel within MaxRange. */
+	bool GetCursorHit(ECollisionChannel Channel, float MaxRange, FHitResult& OutHit);
+
+private:
+
+	struct FCachedCursorHits
+	{
+		TEnumAsByte<ECollisionChannel> Channel = ECC_Visibility;
+		float MaxRange = 0.0f;
+		TArray<FHitResult> Hits;
+	};
+
+	void RefreshForFrame();
+
+	uint64 CachedFrame = MAX_uint64;
+
+	FVector RayOrigin = FVector::ZeroVector;
+	FVector RayDirection = FVector::ForwardVector;
+	bool bHasRay = false;
+
+	// One entry per channel queried this frame; entries keep their arrays between frames
+	TArray<FCachedCursorHits, TInlineAllocator<2>> CachedHits;
+	int32 NumCachedHits = 0;
+};
@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "Engine/OverlapResult.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GASC_OverlapWatchSubsystem.generated.h"
+
+/**
+ * Called when actors enter a watcher's sphere. Actors already inside when the watcher registers are reported together
+ * as one FGameplayAbilityTargetData_ActorArray; each actor entering after that is reported on its own as a
+ * FGameplayAbilityTargetData_SingleTargetHit. Listeners may keep the handle: the watcher only rewrites target data
+ * that nobody else holds.
+ */
+DECLARE_DELEGATE_OneParam(FGASC_OnOverlapWatchTriggered, const FGameplayAbilityTargetDataHandle&);
+
+/** Identifies a watcher registered with UGASC_OverlapWatchSubsystem. */
+struct FGASC_OverlapWatchHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; Serial = 0; }
+};
+
+/**
+ * @class UGASC_OverlapWatchSubsystem
+ * @brief Reports actors entering a sphere around an avatar by polling scene queries on a fixed cadence.
+ *
+ * Watching an area used to mean creating, registering and destroying a sphere component for every ability cast.
+ * Watchers here are pooled records instead: nothing is added to the physics scene, and each poll runs one
+ * overlap query per avatar and radius, shared by every watcher on that avatar with that radius. Each actor is
+ * reported once per watcher, through target data the watcher reuses across polls unless a listener kept it.
+ * The poll interval is GASCourse.OverlapWatch.PollInterval.
+ */
+UCLASS()
+class GASCOURSE_API UGASC_OverlapWatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/* Tick (only while watchers are registered) */
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UGASC_OverlapWatchSubsystem, STATGROUP_Tickables);
+	}
+
+	/**
+	 * Starts watching a Radius sphere around Avatar. Actors already inside are reported before this returns.
+	 * OutHandle is written before that first report, so OnTriggered may unregister the watcher through it; it may
+	 * also register new watchers.
+	 */
+	void RegisterWatcher(FGASC_OverlapWatchHandle& OutHandle, AActor* Avatar, float Radius, FGASC_OnOverlapWatchTriggered OnTriggered, bool bDebugDraw = false);
+
+	/** Stops the watcher and returns its record to the pool. Resets Handle. */
+	void UnregisterWatcher(FGASC_OverlapWatchHandle& Handle);
+
+	int32 GetNumActiveWatchers() const { return Watchers.Num() - FreeWatchers.Num(); }
+
+private:
+
+	struct FWatcher
+	{
+		TWeakObjectPtr<AActor> Avatar;
+		float Radius = 0.0f;
+		FGASC_OnOverlapWatchTriggered OnTriggered;
+
+		// Actors already reported; kept across reuse so the set's storage is not reallocated
+		TSet<TObjectKey<AActor>> ReportedActors;
+
+		// OverlapResults entries for actors this poll reports for the first time
+		TArray<int32> NewOverlapIndices;
+
+		// Actors already inside on registration, as one actor array
+		FGameplayAbilityTargetDataHandle InitialTargetDataHandle;
+
+		// One actor entering later, as a single target hit refilled for each report
+		FGameplayAbilityTargetDataHandle EnteredTargetDataHandle;
+
+		uint32 Serial = 0;
+		bool bDebugDraw = false;
+		bool bInUse = false;
+
+		// Set while OnTriggered executes; releasing the record is deferred until it returns
+		bool bBroadcasting = false;
+	};
+
+	// One overlap query run during a poll, and where its results sit in OverlapResults
+	struct FPolledQuery
+	{
+		TObjectKey<AActor> Avatar;
+		float Radius = 0.0f;
+		int32 FirstResult = 0;
+		int32 NumResults = 0;
+	};
+
+	void PollWatchers();
+
+	/** Runs (or reuses this poll's) query for the watcher and reports the actors it has not seen yet. */
+	void PollWatcher(int32 WatcherIndex, bool bInitialReport);
+
+	/** Index into PolledQueries of this poll's query for Avatar and Radius, running it if needed. */
+	int32 FindOrRunQuery(AActor& Avatar, float Radius, bool bDebugDraw);
+
+	FWatcher* FindWatcher(const FGASC_OverlapWatchHandle& Handle);
+	void ReleaseWatcher(int32 WatcherIndex);
+
+	// Indirect so a record stays put while its callback registers more watchers
+	TIndirectArray<FWatcher> Watchers;
+	TArray<int32> FreeWatchers;
+
+	// Per poll scratch, reset rather than freed between polls
+	TArray<FPolledQuery> PolledQueries;
+	TArray<FOverlapResult> OverlapResults;
+	TArray<FOverlapResult> QueryResults;
+
+	float TimeSinceLastPoll = 0.0f;
+	uint32 NextSerial = 1;
+	bool bIsPolling = false;
+};
@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "Engine/DataAsset.h"
+#include "GASC_WaveDefinitionData.generated.h"
+
+/**
+ * A number of enemies of a single class spawned as part of a wave.
+ */
+USTRUCT(BlueprintType)
+struct GASCOURSE_API FGASC_WaveEnemyGroup
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Wave Manager")
+	TSoftClassPtr<APawn> EnemyClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Wave Manager", meta = (ClampMin = "1"))
+	int32 Count = 1;
+};
+
+/**
+ * A single wave: the enemy groups it contains and how far from the spawn origin they appear.
+ */
+USTRUCT(BlueprintType)
+struct GASCOURSE_API FGASC_WaveDefinition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Wave Manager")
+	TArray<FGASC_WaveEnemyGroup> EnemyGroups;
+
+	/** Enemies are placed at a random point this far from the spawn origin, projected onto the navmesh if there is one. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GASCourse|Wave Manager", meta = (ClampMin = "0.0"))
+	float SpawnRadius = 600.0f;
+};
+
+/**
+ * Ordered list of waves driven by UGASC_WaveManagerSubsystem.
+ */
+UCLASS(BlueprintType)
+class GASCOURSE_API UGASC_WaveDefinitionData : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GASCourse|Wave Manager")
+	TArray<FGASC_WaveDefinition> Waves;
+};
@@ -0,0 +1,179 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "AttributeSet.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "GameplayEffect.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GASC_WaveDefinitionData.h"
+#include "GASC_WaveManagerSubsystem.generated.h"
+
+struct FGameplayEventData;
+struct FStreamableHandle;
+
+DECLARE_LOG_CATEGORY_EXTERN(LOG_GASC_WaveManagerSubsystem, Log, All);
+
+/**
+ * Deactivated pawns of a single class waiting to be reused.
+ */
+USTRUCT()
+struct FGASC_WaveEnemyPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<APawn>> InactivePawns;
+};
+
+/**
+ * @class UGASC_WaveManagerSubsystem
+ * @brief Spawns data-driven enemy waves from per-class pools of pre-warmed pawns.
+ *
+ * Enemy classes are loaded asynchronously one wave ahead, and the pools for that wave are filled a few pawns per
+ * tick while the current wave plays out. Spawning an enemy then only reactivates and teleports a pooled pawn;
+ * released pawns have their gameplay effects, loose gameplay tags and attribute base values restored to their
+ * post-spawn state instead of being destroyed.
+ *
+ * Enemies return to their pool on their own a short while after they die. Enemies destroyed from outside (kill
+ * volumes, level unload) are dropped from the pools. Nothing here depends on a player or viewport: waves can be
+ * driven entirely through SetWaveDefinitions, SpawnNextWave and ReleaseEnemy.
+ * See GASC_WaveManagerSubsystemTests.cpp.
+ */
+UCLASS()
+class GASCOURSE_API UGASC_WaveManagerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/* Tick (only while pools are being pre-warmed or dead enemies are waiting to be released) */
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/** Replaces the wave list, restarts from the first wave and begins preloading it. */
+	UFUNCTION(BlueprintCallable, Category = "GASCourse|Wave Manager")
+	void SetWaveDefinitions(const TArray<FGASC_WaveDefinition>& InWaveDefinitions);
+
+	/**
+	 * Spawns the next wave around SpawnOrigin and starts preloading the wave after it.
+	 * If the wave's classes have not finished streaming yet, this blocks until they have.
+	 *
+	 * @return The pawns spawned for the wave; empty once every wave has been spawned.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GASCourse|Wave Manager")
+	TArray<APawn*> SpawnNextWave(const FVector& SpawnOrigin);
+
+	/** Reactivates a pooled pawn of EnemyClass at SpawnTransform, creating one only if the pool is empty. */
+	UFUNCTION(BlueprintCallable, Category = "GASCourse|Wave Manager")
+	APawn* SpawnEnemy(TSubclassOf<APawn> EnemyClass, const FTransform& SpawnTransform);
+
+	/** Deactivates an enemy spawned by this subsystem and returns it to its pool. */
+	UFUNCTION(BlueprintCallable, Category = "GASCourse|Wave Manager")
+	void ReleaseEnemy(APawn* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "GASCourse|Wave Manager")
+	FORCEINLINE int32 GetNextWaveIndex() const
+	{
+		return NextWaveIndex;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "GASCourse|Wave Manager")
+	FORCEINLINE int32 GetNumWaves() const
+	{
+		return WaveDefinitions.Num();
+	}
+
+	/** True once the classes for WaveIndex are loaded and its pools hold enough pawns for the whole wave. */
+	UFUNCTION(BlueprintPure, Category = "GASCourse|Wave Manager")
+	bool IsWaveReady(int32 WaveIndex) const;
+
+	UFUNCTION(BlueprintPure, Category = "GASCourse|Wave Manager")
+	int32 GetNumPooledEnemies(TSubclassOf<APawn> EnemyClass) const;
+
+	UFUNCTION(BlueprintPure, Category = "GASCourse|Wave Manager")
+	FORCEINLINE int32 GetNumActiveEnemies() const
+	{
+		return ActiveEnemies.Num();
+	}
+
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UGASC_WaveManagerSubsystem, STATGROUP_Tickables);
+	}
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** A gameplay effect active right after spawn, kept as a spec so it can be applied again once it is gone. */
+	struct FPooledEnemyBaselineEffect
+	{
+		FActiveGameplayEffectHandle Handle;
+		FGameplayEffectSpec Spec;
+	};
+
+	/** State captured right after a pooled pawn was first spawned and initialized. */
+	struct FPooledEnemyBaseline
+	{
+		TArray<TPair<FGameplayAttribute, float>> AttributeBaseValues;
+		TArray<FPooledEnemyBaselineEffect> Effects;
+		TMap<FGameplayTag, int32> TagCounts;
+	};
+
+	void PreloadWave(int32 WaveIndex);
+	void OnWavePreloaded(int32 WaveIndex);
+	void QueuePoolPrewarm(const FGASC_WaveDefinition& Wave);
+
+	APawn* CreatePooledEnemy(TSubclassOf<APawn> EnemyClass);
+
+	/** Death event from a pooled enemy's ability system; the enemy is released once the death delay has passed. */
+	void OnEnemyDeathEvent(FGameplayTag MatchingTag, const FGameplayEventData* Payload, TWeakObjectPtr<APawn> Enemy);
+
+	/** Drops a pooled enemy that was destroyed from outside the subsystem. */
+	UFUNCTION()
+	void OnEnemyEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	void ActivateEnemy(APawn* Enemy, const FTransform& SpawnTransform);
+	void DeactivateEnemy(APawn* Enemy);
+	void CaptureBaseline(APawn* Enemy);
+	void RestoreBaseline(APawn* Enemy);
+
+	/** Picks Count random points SpawnRadius from SpawnOrigin, projected onto the navmesh in a single batch. */
+	void FindSpawnLocations(const FVector& SpawnOrigin, float SpawnRadius, int32 Count, TArray<FVector>& OutLocations) const;
+
+	TArray<FGASC_WaveDefinition> WaveDefinitions;
+
+	int32 NextWaveIndex = 0;
+
+	// Keeps the classes of the preloaded wave resident until it has been spawned
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+	int32 PreloadedWaveIndex = INDEX_NONE;
+
+	UPROPERTY()
+	TMap<TSubclassOf<APawn>, FGASC_WaveEnemyPool> EnemyPools;
+
+	// Pawns currently out in the world, mapped to the pool they return to
+	UPROPERTY()
+	TMap<TObjectPtr<APawn>, TSubclassOf<APawn>> ActiveEnemies;
+
+	// One entry per pawn still to be created for the upcoming wave
+	UPROPERTY()
+	TArray<TSubclassOf<APawn>> PendingPrewarm;
+
+	TMap<TObjectKey<APawn>, FPooledEnemyBaseline> EnemyBaselines;
+
+	// Dead enemies and the world time at which they return to their pool
+	TArray<TPair<TWeakObjectPtr<APawn>, double>> PendingReleases;
+
+	int32 MaxPrewarmSpawnsPerTick = 2;
+	float ReleaseDelayAfterDeath = 3.0f;
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/DeveloperSettings.h"
+#include "GASC_WaveDefinitionData.h"
 #include "GASC_WaveManagerSystemSettings.generated.h"
 
 /**
@@ -18,4 +19,16 @@ public:
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "GASCourse|Wave Manager|Enemy")
 	TArray<TSoftClassPtr<APawn>> EnemyList;
 	
+	/** Waves loaded by UGASC_WaveManagerSubsystem when the world begins play. */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "GASCourse|Wave Manager|Waves")
+	TSoftObjectPtr<UGASC_WaveDefinitionData> WaveDefinitions;
+
+	/** Pooled enemies created per tick while pre-warming the pools for the upcoming wave. */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "GASCourse|Wave Manager|Pooling", meta = (ClampMin = "1"))
+	int32 MaxPoolPrewarmSpawnsPerTick = 2;
+
+	/** Seconds a pooled enemy stays in the world after dying before it is returned to its pool. */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "GASCourse|Wave Manager|Pooling", meta = (ClampMin = "0.0"))
+	float EnemyReleaseDelayAfterDeath = 3.0f;
+	
 };
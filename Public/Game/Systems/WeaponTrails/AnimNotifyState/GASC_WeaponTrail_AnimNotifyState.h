@@ -18,6 +18,9 @@ DECLARE_LOG_CATEGORY_EXTERN(LogGASCourseWeaponTrail, Log, All);
  *
  * It is highly customizable and supports options like socket attachment, offset adjustments, and
  * whether to destroy or stop the effect at the end of the notify.
+ *
+ * The notify is shared by every mesh playing its animation, so it holds no per-mesh state: the spawned
+ * trails are owned by UGASC_WeaponTrailSubsystem, keyed by mesh component and notify.
  */
 UCLASS(Blueprintable, meta = (DisplayName = "Weapon Trail"))
 class GASCOURSE_API UGASC_WeaponTrail_AnimNotifyState : public UAnimNotifyState
@@ -53,14 +56,7 @@ class GASCOURSE_API UGASC_WeaponTrail_AnimNotifyState : public UAnimNotifyState
 	UFUNCTION(BlueprintCallable, Category = "AnimNotify")
 	UNiagaraComponent* GetSpawnedEffect(UMeshComponent* MeshComp);
 
-private:
-
-	UPROPERTY()
-	UNiagaraComponent* WeaponTrailNiagaraComponent = nullptr;
-
-	void SetWeaponTrailMaterialInterface(UNiagaraComponent* InWeaponTrailNiagaraComponent) const;
-	void SetWeaponTrailColorArrayAtTime(UNiagaraComponent* InWeaponTrailNiagaraComponent, float InTime) const;
-	void SetWeaponTrailLifeTime(UNiagaraComponent* InWeaponTrailNiagaraComponent, float InLifeTime) const;
-
-	void DestroyWeaponTrailVFX() const;
+	// Return the trail this notify currently has running on MeshComp, if any
+	UFUNCTION(BlueprintCallable, Category = "AnimNotify")
+	UNiagaraComponent* GetActiveTrail(USkeletalMeshComponent* MeshComp) const;
 };
@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "GASC_WeaponTrailSubsystem.generated.h"
+
+class UNiagaraComponent;
+class UNiagaraSystem;
+class UGASC_WeaponTrail_AnimNotifyState;
+class UGASC_WeaponTrails_DataAsset;
+
+/**
+ * User parameters a weapon trail system exposes, resolved once per Niagara system.
+ * A parameter the system does not expose is skipped instead of being written every frame.
+ */
+struct FGASC_WeaponTrailBindings
+{
+	FName MaterialInterfaceName;
+	FName LifeTimeName;
+	FName ColorArrayName;
+
+	uint8 bHasMaterialInterface : 1 = false;
+	uint8 bHasLifeTime : 1 = false;
+	uint8 bHasColorArray : 1 = false;
+};
+
+/**
+ * @class UGASC_WeaponTrailSubsystem
+ * @brief Owns the weapon trails started by UGASC_WeaponTrail_AnimNotifyState, one per mesh and notify.
+ *
+ * Anim notifies are shared by every mesh playing the same animation, so a notify cannot hold the component it
+ * spawned. Trails live here instead, keyed by the mesh component and the notify that started them. Trail records
+ * are pooled, the Niagara components come from the Niagara component pool, and each trail's color is read from
+ * the data asset's baked color table and written through bindings resolved when the system was first used, so
+ * updating a trail does not allocate.
+ */
+UCLASS()
+class GASCOURSE_API UGASC_WeaponTrailSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/** Spawns Notify's trail on MeshComp. A trail Notify already has on MeshComp is ended first. */
+	UNiagaraComponent* BeginTrail(USkeletalMeshComponent* MeshComp, UGASC_WeaponTrail_AnimNotifyState* Notify);
+
+	/** Updates the trail's color for TimeRatio (0-1) through the notify. */
+	void UpdateTrail(const USkeletalMeshComponent* MeshComp, const UGASC_WeaponTrail_AnimNotifyState* Notify, float TimeRatio);
+
+	/** Stops the trail, or deactivates it immediately if the notify asks to destroy it at the end. */
+	void EndTrail(const USkeletalMeshComponent* MeshComp, const UGASC_WeaponTrail_AnimNotifyState* Notify);
+
+	UNiagaraComponent* FindTrailComponent(const USkeletalMeshComponent* MeshComp, const UGASC_WeaponTrail_AnimNotifyState* Notify) const;
+
+	int32 GetNumActiveTrails() const { return TrailInstances.Num() - FreeTrailInstances.Num(); }
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	struct FTrailInstance
+	{
+		TWeakObjectPtr<UNiagaraComponent> NiagaraComponent;
+		TWeakObjectPtr<const UGASC_WeaponTrails_DataAsset> TrailData;
+		TObjectKey<USkeletalMeshComponent> MeshComp;
+		TObjectKey<UGASC_WeaponTrail_AnimNotifyState> Notify;
+		FGASC_WeaponTrailBindings Bindings;
+		FLinearColor LastColor = FLinearColor::Transparent;
+		bool bDestroyAtEnd = false;
+		bool bInUse = false;
+	};
+
+	const FGASC_WeaponTrailBindings& FindOrResolveBindings(const UNiagaraSystem* System);
+
+	int32 FindTrailIndex(const USkeletalMeshComponent* MeshComp, const UGASC_WeaponTrail_AnimNotifyState* Notify) const;
+	int32 AllocateTrailInstance();
+	void ReleaseTrailInstance(int32 InstanceIndex);
+
+	/** Releases trails whose mesh or component went away without their notify ending. */
+	void PruneStaleTrails();
+
+	void PushColor(FTrailInstance& Instance, UNiagaraComponent& NiagaraComponent, const FLinearColor& Color) const;
+
+	TArray<FTrailInstance> TrailInstances;
+	TArray<int32> FreeTrailInstances;
+
+	// Active trail slots per mesh; a mesh rarely has more than one trail notify open at a time
+	TMap<TObjectKey<USkeletalMeshComponent>, TArray<int32, TInlineAllocator<2>>> MeshTrails;
+
+	TMap<TObjectKey<UNiagaraSystem>, FGASC_WeaponTrailBindings> SystemBindings;
+};
@@ -8,6 +8,9 @@
 #include "GASCourse/Public/Game/Systems/WeaponTrails/Settings/GASC_WeaponTrails_Settings.h"
 #include "GASC_WeaponTrails_DataAsset.generated.h"
 
+class UCurveBase;
+class UCurveLinearColor;
+
 /**
  * Manages the configuration and data references for weapon trail effects within the game.
  * This class functions as a data asset that encapsulates all properties and assets necessary
@@ -42,5 +45,40 @@ public:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon Trails")
 	float TrailLifeTime = 0.35f;
-	
+
+	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/** Color at Ratio (0-1) through the trail, interpolated from the baked table rather than the curve. */
+	FLinearColor GetBakedColor(float Ratio) const;
+
+	bool HasBakedColorSamples() const { return !BakedColorSamples.IsEmpty(); }
+
+private:
+
+	/** Samples ColorCurve into BakedColorSamples. Only this asset rebakes: on load, on edit, and when its curve is edited. */
+	void BakeColorSamples();
+
+#if WITH_EDITOR
+	/** Watches ColorCurve for edits made in the curve editor or its details panel, dropping any previous curve. */
+	void BindColorCurveChanged();
+	void UnbindColorCurveChanged();
+
+	void OnColorCurveUpdated(UCurveBase* Curve, EPropertyChangeType::Type ChangeType);
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+#endif
+
+	static constexpr int32 NumBakedColorSamples = 32;
+
+	TArray<FLinearColor> BakedColorSamples;
+
+#if WITH_EDITORONLY_DATA
+	TWeakObjectPtr<UCurveLinearColor> BoundColorCurve;
+	FDelegateHandle ColorCurveUpdatedHandle;
+	FDelegateHandle ObjectPropertyChangedHandle;
+#endif
 };